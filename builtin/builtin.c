@@ -6,64 +6,47 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 18:05:42 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/06 15:58:41 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
-extern volatile sig_atomic_t	g_exit_status;
-
 /**
  * @brief Checks if a command is a builtin command.
  * @param tokens Array of command tokens to check.
  * @return 1 if the command is a builtin, 0 otherwise.
- * @note Checks against predefined list of builtin commands.
+ * @note Looks the name up in the builtin table.
  */
 int	is_builtin(char **tokens)
 {
-	const char	*builtins[] = {"echo", "cd", "pwd", "export",
-		"unset", "env", "exit", NULL};
-	int			i;
-
 	if (!tokens || !tokens[0])
 		return (0);
-	i = 0;
-	while (builtins[i])
-	{
-		if (ft_strcmp(tokens[0], builtins[i]) == 0)
-			return (1);
-		i++;
-	}
-	return (0);
+	return (get_builtin_fn(tokens[0]) != NULL);
 }
 
 /**
  * @brief Executes the appropriate builtin function.
  * @param args Command arguments including builtin name.
  * @return Exit status of the executed builtin.
- * @note Dispatches to specific builtin implementations based on first argument.
+ * @note Dispatches through the builtin table. Anything but the test
+ * builtins may change the filesystem, so the stat cache is dropped.
  */
 int	exec_builtin(char **args)
 {
-	if (ft_strcmp(args[0], "echo") == 0)
-		return (exec_echo(args));
-	if (ft_strcmp(args[0], "cd") == 0)
-		return (exec_cd(args));
-	if (ft_strcmp(args[0], "pwd") == 0)
-		return (exec_pwd(args));
-	if (ft_strcmp(args[0], "export") == 0)
-		return (exec_export(args));
-	if (ft_strcmp(args[0], "unset") == 0)
-		return (exec_unset(args));
-	if (ft_strcmp(args[0], "env") == 0)
-		return (exec_env(args));
+	t_builtin_fn	fn;
+
+	if (!is_test_builtin(args))
+		invalidate_stat_cache();
 	if (ft_strcmp(args[0], "exit") == 0)
 	{
 		exec_exit(args);
 		return (EXIT_CODE_EXIT);
 	}
-	return (0);
+	fn = get_builtin_fn(args[0]);
+	if (!fn)
+		return (0);
+	return (fn(args));
 }
 
 /**
@@ -105,34 +88,18 @@ char	**ft_copy_env(char **original)
 /**
  * @brief Updates or adds an environment variable.
  * @param var Variable name (ownership transferred).
- * @param value Variable value (ownership transferred).
+ * @param value Variable value (ownership transferred, NULL for empty).
+ * @note The replaced entry is freed, so a long-lived shell does not grow
+ * with every assignment.
  */
 void	update_env_var(char *var, char *value)
 {
-	extern char	**environ;
-	char		*new_entry;
-	char		*eq;
-	char		**env_ptr;
-
-	if (value != NULL)
-		new_entry = ft_strjoin3(var, "=", value);
+	if (value)
+		set_env_value(var, value);
 	else
-		new_entry = ft_strjoin(var, "=");
-	env_ptr = environ;
-	while (*env_ptr)
-	{
-		eq = ft_strchr(*env_ptr, '=');
-		if (eq && ft_strncmp(*env_ptr, var, eq - *env_ptr) == 0)
-		{
-			*env_ptr = new_entry;
-			return ;
-		}
-		env_ptr++;
-	}
-	environ = ft_array_append(environ, new_entry);
+		set_env_value(var, "");
 	free(var);
-	if (value)
-		free(value);
+	free(value);
 }
 
 /**
@@ -141,13 +108,12 @@ void	update_env_var(char *var, char *value)
 */
 void	ensure_var_exported(char *var_name)
 {
-	extern char	**environ;
-	char		**env_ptr;
-	int			exists;
-	char		*eq;
+	char	**env_ptr;
+	int		exists;
+	char	*eq;
 
 	exists = 0;
-	env_ptr = environ;
+	env_ptr = *get_env();
 	while (*env_ptr && !exists)
 	{
 		eq = ft_strchr(*env_ptr, '=');
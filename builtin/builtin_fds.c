@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_fds.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 03:52:19 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the descriptor map builtins write through.
+ * @return Map of stdin, stdout and stderr of the current context.
+ * @note The identity map unless a builtin run by the shell itself has
+ * its redirections resolved in the map instead of with dup2.
+ */
+int	*builtin_fds(void)
+{
+	return (get_shell_ctx()->fds);
+}
+
+/**
+ * @brief Gives the descriptor a builtin uses for a standard stream.
+ * @param fd STDIN_FILENO, STDOUT_FILENO or STDERR_FILENO.
+ * @return The descriptor currently standing for it (-1 once closed).
+ */
+int	builtin_fd(int fd)
+{
+	return (builtin_fds()[fd]);
+}
+
+/**
+ * @brief perror() for builtins, written to their mapped stderr.
+ * @param prefix Text printed before the error message.
+ */
+void	builtin_perror(const char *prefix)
+{
+	char	*reason;
+
+	reason = strerror(errno);
+	ft_putstr_fd((char *)prefix, builtin_fd(STDERR_FILENO));
+	ft_putstr_fd(": ", builtin_fd(STDERR_FILENO));
+	ft_putendl_fd(reason, builtin_fd(STDERR_FILENO));
+}
+
+/**
+ * @brief Applies the redirections of a builtin run by the shell itself.
+ * @param plan Receives the plan, undone by builtin_redirect_pop.
+ * @param cmd Builtin command (heredocs already collected).
+ * @return 0 on success, -1 on error.
+ * @note Steps on stdin, stdout and stderr only go to the descriptor map,
+ * so `echo x > f` writes straight to the file and `cd dir` makes no
+ * descriptor system call. `exec` and `source` need the real
+ * descriptors, as do other numbers and `>&N` copies.
+ */
+int	builtin_redirect_push(t_fdplan *plan, t_cmd *cmd)
+{
+	char	*name;
+
+	if (fdplan_build(plan, cmd->redirections) == -1)
+		return (-1);
+	name = cmd->args[0];
+	if (ft_strcmp(name, "exec") && ft_strcmp(name, "source")
+		&& ft_strcmp(name, ".") && fdplan_virtual(plan, builtin_fds()) == 0)
+		return (0);
+	if (fdplan_apply(plan, 1) == 0)
+		return (0);
+	fdplan_restore(plan);
+	return (-1);
+}
+
+/**
+ * @brief Ends the redirections set by builtin_redirect_push.
+ * @param plan Plan of the builtin.
+ */
+void	builtin_redirect_pop(t_fdplan *plan)
+{
+	int	*map;
+
+	if (!plan->mapped)
+	{
+		redirect_pop(plan);
+		return ;
+	}
+	fdplan_close(plan);
+	map = builtin_fds();
+	map[STDIN_FILENO] = STDIN_FILENO;
+	map[STDOUT_FILENO] = STDOUT_FILENO;
+	map[STDERR_FILENO] = STDERR_FILENO;
+	get_exec_ctl()->keep_fds = 0;
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_table.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the table of builtins.
+ * @return Array of name/function pairs, ended by a NULL name.
+ * @note The table is the single source of truth for is_builtin,
+ * exec_builtin and command completion.
+ */
+const t_builtin	*builtin_table(void)
+{
+	static const t_builtin	builtins[] = {
+	{"echo", exec_echo}, {"cd", exec_cd}, {"pwd", exec_pwd},
+	{"export", exec_export}, {"unset", exec_unset}, {"env", exec_env},
+	{"exit", exec_exit}, {"test", exec_test}, {"[", exec_test},
+	{"true", exec_true}, {"false", exec_false}, {"printf", exec_printf},
+	{"read", exec_read}, {"break", exec_break},
+	{"continue", exec_continue}, {"return", exec_return},
+	{"shift", exec_shift}, {"source", exec_source}, {".", exec_source},
+	{"exec", exec_exec}, {"history", exec_history}, {NULL, NULL}};
+
+	return (builtins);
+}
+
+/**
+ * @brief Looks up the function implementing a builtin.
+ * @param name Command name to look up.
+ * @return Pointer to the builtin function, or NULL if not a builtin.
+ */
+t_builtin_fn	get_builtin_fn(const char *name)
+{
+	const t_builtin	*builtins;
+	int				i;
+
+	if (!name)
+		return (NULL);
+	builtins = builtin_table();
+	i = 0;
+	while (builtins[i].name)
+	{
+		if (ft_strcmp(name, builtins[i].name) == 0)
+			return (builtins[i].fn);
+		i++;
+	}
+	return (NULL);
+}
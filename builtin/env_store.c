@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_store.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Finds the environment slot holding a variable.
+ * @param name Exact variable name (no '=').
+ * @return Pointer into the environment, or NULL if the variable is not
+ * set.
+ */
+char	**find_env_entry(const char *name)
+{
+	char	**env;
+	size_t	len;
+
+	len = ft_strlen(name);
+	env = *get_env();
+	while (env && *env)
+	{
+		if (ft_strncmp(*env, name, len) == 0
+			&& ((*env)[len] == '=' || (*env)[len] == '\0'))
+			return (env);
+		env++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Sets a variable in the environment, replacing any previous value.
+ * @param name Variable name (copied).
+ * @param value Variable value (copied).
+ * @return 0 on success, -1 on allocation failure.
+ * @note Unlike update_env_var, ownership of the arguments stays with the
+ * caller and the replaced entry is freed.
+ */
+int	set_env_value(const char *name, const char *value)
+{
+	char	*entry;
+	char	**slot;
+	char	**grown;
+
+	entry = ft_strjoin3(name, "=", value);
+	if (!entry)
+		return (-1);
+	slot = find_env_entry(name);
+	if (slot)
+	{
+		free(*slot);
+		*slot = entry;
+		return (0);
+	}
+	grown = ft_array_append(*get_env(), entry);
+	if (!grown)
+	{
+		free(entry);
+		return (-1);
+	}
+	*get_env() = grown;
+	return (0);
+}
+
+/**
+ * @brief Returns the environment of the shell.
+ * @return Pointer to the array of the current shell context, which may
+ * be replaced when it grows.
+ * @note Takes the place of the process-wide `environ`, so every context
+ * keeps its own variables.
+ */
+char	***get_env(void)
+{
+	return (&get_shell_ctx()->env);
+}
+
+/**
+ * @brief getenv() on the environment of the shell.
+ * @param name Variable name.
+ * @return Its value (owned by the environment), NULL if the variable is
+ * unset or was exported without a value.
+ */
+char	*env_value(const char *name)
+{
+	char	**slot;
+	char	*eq;
+
+	slot = find_env_entry(name);
+	if (!slot)
+		return (NULL);
+	eq = ft_strchr(*slot, '=');
+	if (!eq)
+		return (NULL);
+	return (eq + 1);
+}
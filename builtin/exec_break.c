@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_break.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the loop and abort state of the script executor.
+ * @return State of the current shell context.
+ */
+t_exec_ctl	*get_exec_ctl(void)
+{
+	return (&get_shell_ctx()->ctl);
+}
+
+/**
+ * @brief Tells whether the current command list must stop.
+ * @return 1 while a `break`, `continue`, `return` or abort is pending,
+ * or once `exit` has run.
+ */
+int	exec_interrupted(void)
+{
+	t_exec_ctl	*ctl;
+
+	ctl = get_exec_ctl();
+	return (ctl->brk || ctl->cont || ctl->ret || ctl->abort || ctl->exited);
+}
+
+/**
+ * @brief Parses the optional loop count of `break` and `continue`.
+ * @param args Command arguments.
+ * @return The count (capped to the loop depth), 0 on error.
+ */
+int	loop_count_arg(char **args)
+{
+	int	n;
+
+	if (!get_exec_ctl()->loop_depth)
+	{
+		ft_putstr_fd("minishell: ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(args[0], builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(": only meaningful in a loop\n",
+			builtin_fd(STDERR_FILENO));
+		return (0);
+	}
+	n = 1;
+	if (args[1])
+		n = ft_atoi(args[1]);
+	if (args[1] && (!ft_isnumber(args[1]) || n < 1))
+	{
+		ft_putstr_fd("minishell: ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(args[0], builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(": loop count out of range\n", builtin_fd(STDERR_FILENO));
+		return (0);
+	}
+	if (n > get_exec_ctl()->loop_depth)
+		n = get_exec_ctl()->loop_depth;
+	return (n);
+}
+
+/**
+ * @brief Leaves the N innermost enclosing loops.
+ * @param args Command arguments (`break [n]`).
+ * @return 0 on success, 1 on a bad count.
+ * @note Only has an effect when run by the shell itself, not inside a
+ * pipeline.
+ */
+int	exec_break(char **args)
+{
+	int	n;
+
+	n = loop_count_arg(args);
+	get_exec_ctl()->brk = n;
+	return (n == 0 && args[1] != NULL);
+}
+
+/**
+ * @brief Starts the next pass of the Nth enclosing loop.
+ * @param args Command arguments (`continue [n]`).
+ * @return 0 on success, 1 on a bad count.
+ */
+int	exec_continue(char **args)
+{
+	int	n;
+
+	n = loop_count_arg(args);
+	get_exec_ctl()->cont = n;
+	return (n == 0 && args[1] != NULL);
+}
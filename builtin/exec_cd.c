@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 10:38:13 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/07 19:38:46 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,18 +25,18 @@ int	exec_cd(char **args)
 
 	oldpwd = getcwd(NULL, 0);
 	if (!oldpwd)
-		return (perror("cd"), 1);
+		return (builtin_perror("cd"), 1);
 	if (handle_cd_arguments(args, oldpwd) != 0)
 		return (1);
 	newpwd = getcwd(NULL, 0);
 	if (!newpwd)
 	{
 		free(oldpwd);
-		return (perror("cd"), 1);
+		return (builtin_perror("cd"), 1);
 	}
-	update_env_var("OLDPWD", oldpwd);
+	set_env_value("OLDPWD", oldpwd);
 	free(oldpwd);
-	update_env_var("PWD", newpwd);
+	set_env_value("PWD", newpwd);
 	free(newpwd);
 	return (0);
 }
@@ -52,29 +52,23 @@ int	exec_cd(char **args)
 char	*resolve_cd_path(char **args, char *oldpwd)
 {
 	char	*path;
+	char	*name;
 
+	name = NULL;
 	if (!args[1] || ft_strcmp(args[1], "~") == 0)
-	{
-		path = getenv("HOME");
-		if (!path)
-		{
-			ft_putstr_fd("minishell: cd: HOME not set\n", STDERR_FILENO);
-			free(oldpwd);
-			return (NULL);
-		}
-	}
+		name = "HOME";
 	else if (ft_strcmp(args[1], "-") == 0)
+		name = "OLDPWD";
+	if (!name)
+		return (args[1]);
+	path = env_value(name);
+	if (!path)
 	{
-		path = getenv("OLDPWD");
-		if (!path)
-		{
-			ft_putstr_fd("minishell: cd: OLDPWD not set\n", STDERR_FILENO);
-			free(oldpwd);
-			return (NULL);
-		}
+		ft_putstr_fd("minishell: cd: ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(name, builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(" not set\n", builtin_fd(STDERR_FILENO));
+		free(oldpwd);
 	}
-	else
-		path = args[1];
 	return (path);
 }
 
@@ -92,7 +86,8 @@ int	handle_cd_arguments(char **args, char *oldpwd)
 
 	if (args[1] && args[2])
 	{
-		ft_putstr_fd("minishell: cd: too many arguments\n", STDERR_FILENO);
+		ft_putstr_fd("minishell: cd: too many arguments\n",
+			builtin_fd(STDERR_FILENO));
 		free(oldpwd);
 		set_exit_status(1);
 		return (1);
@@ -102,7 +97,7 @@ int	handle_cd_arguments(char **args, char *oldpwd)
 		return (1);
 	if (chdir(path) != 0)
 	{
-		perror("cd");
+		builtin_perror("cd");
 		set_exit_status(1);
 		free(oldpwd);
 		return (1);
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 10:48:11 by jcologne          #+#    #+#             */
-/*   Updated: 2025/04/28 19:14:23 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -32,11 +32,11 @@ int	exec_echo(char **args)
 	}
 	while (args[i])
 	{
-		ft_putstr_fd(args[i], STDOUT_FILENO);
+		ft_putstr_fd(args[i], builtin_fd(STDOUT_FILENO));
 		if (args[++i])
-			ft_putchar_fd(' ', STDOUT_FILENO);
+			ft_putchar_fd(' ', builtin_fd(STDOUT_FILENO));
 	}
 	if (!nl_flag)
-		ft_putchar_fd('\n', STDOUT_FILENO);
+		ft_putchar_fd('\n', builtin_fd(STDOUT_FILENO));
 	return (0);
 }
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/21 14:46:59 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/02 16:52:04 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,21 +16,30 @@
  * @brief Prints environment variables to stdout.
  * @param args Ignored parameter.
  * @return Always returns 0.
- * @note Uses extern environ directly.
+ * @note Lists the environment of the current shell context. The listing
+ * is written at once to the builtin's stdout.
  */
 int	exec_env(char **args)
 {
-	extern char	**environ;
+	char		**env;
+	t_strbuf	sb;
 	int			i;
 
 	(void)args;
+	env = *get_env();
+	sb_init(&sb);
 	i = 0;
-	while (environ[i])
+	while (env[i])
 	{
-		if (ft_strncmp(environ[i], "COLUMNS=", 8) != 0
-			&& ft_strncmp(environ[i], "LINES=", 6) != 0)
-			printf("%s\n", environ[i]);
+		if (ft_strncmp(env[i], "COLUMNS=", 8) != 0
+			&& ft_strncmp(env[i], "LINES=", 6) != 0)
+		{
+			sb_append(&sb, env[i], ft_strlen(env[i]));
+			sb_putc(&sb, '\n');
+		}
 		i++;
 	}
+	sb_flush(&sb, builtin_fd(STDOUT_FILENO));
+	sb_free(&sb);
 	return (0);
 }
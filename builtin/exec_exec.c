@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_exec.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:51:09 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Prints an `exec` error and returns its status.
+ * @param name Command that could not be run.
+ * @param status CMD_NOT_FOUND or PERM_DENIED.
+ * @return `status`.
+ */
+int	exec_exec_error(const char *name, int status)
+{
+	ft_putstr_fd("minishell: exec: ", builtin_fd(STDERR_FILENO));
+	ft_putstr_fd((char *)name, builtin_fd(STDERR_FILENO));
+	if (status == CMD_NOT_FOUND)
+		ft_putstr_fd(": not found\n", builtin_fd(STDERR_FILENO));
+	else
+		ft_putstr_fd(": cannot execute\n", builtin_fd(STDERR_FILENO));
+	return (status);
+}
+
+/**
+ * @brief Replaces the shell with a command, or keeps its redirections.
+ * @param args Command arguments (`exec [cmd [args...]]`).
+ * @return Only returns on failure (127 or 126), or 0 without a command.
+ * @note Without a command, the redirections of the `exec` line are left
+ * in place for the rest of the session (see release_std_fds). The
+ * command is looked up in PATH only, never as a builtin or function.
+ */
+int	exec_exec(char **args)
+{
+	char	*path;
+
+	if (!args[1])
+	{
+		get_exec_ctl()->keep_fds = 1;
+		return (0);
+	}
+	path = get_cmd_path(args[1]);
+	if (!path && access(args[1], F_OK) == 0)
+		return (exec_exec_error(args[1], PERM_DENIED));
+	if (!path)
+		return (exec_exec_error(args[1], CMD_NOT_FOUND));
+	setup_child_signals();
+	execve(path, args + 1, *get_env());
+	free(path);
+	setup_parent_signals();
+	return (exec_exec_error(args[1], PERM_DENIED));
+}
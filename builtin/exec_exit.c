@@ -6,17 +6,34 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 10:43:27 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/08 17:19:43 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
+/**
+ * @brief Ends the shell with a status.
+ * @param status Exit status.
+ * @return `status` when run by the shell itself.
+ * @note A forked child exits at once. The shell itself only records the
+ * request: every running list unwinds (see exec_interrupted) and the
+ * caller of script_run, the front-end loop or a library user, stops.
+ */
+int	exit_shell(int status)
+{
+	if (*in_subshell())
+		exit(status);
+	set_exit_status(status);
+	get_exec_ctl()->exited = 1;
+	return (status);
+}
+
 /**
  * @brief Terminates the shell with optional status code.
  * @param args Command arguments (optional exit code).
- * @return Special exit code (4242) or error status.
- * @note Handles numeric validation and cleanup before exit.
+ * @return The exit status, or 1 when there are too many arguments.
+ * @note Handles numeric validation before exit.
  */
 int	exec_exit(char **args)
 {
@@ -25,20 +42,21 @@ int	exec_exit(char **args)
 	status = 0;
 	if (args[1] && args[2])
 	{
-		ft_putstr_fd("minishell: exit: too many arguments\n", STDERR_FILENO);
+		ft_putstr_fd("minishell: exit: too many arguments\n",
+			builtin_fd(STDERR_FILENO));
 		set_exit_status(2);
 		return (1);
 	}
 	if (args[1] && !ft_isnumber(args[1]))
 	{
 		ft_putstr_fd("minishell: exit: numeric argument required\n",
-			STDERR_FILENO);
-		set_exit_status(2);
-		exit(2);
+			builtin_fd(STDERR_FILENO));
+		return (exit_shell(2));
 	}
 	if (args[1])
 		status = ft_atoi(args[1]) % 256;
-	ft_putstr_fd("Exiting minishell, goodbye!\n", STDOUT_FILENO);
-	rl_clear_history();
-	exit(status);
+	if (!*in_subshell())
+		ft_putstr_fd("Exiting minishell, goodbye!\n",
+			builtin_fd(STDOUT_FILENO));
+	return (exit_shell(status));
 }
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/21 14:50:18 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/05 17:40:18 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -49,9 +49,9 @@ int	handle_invalid_identifier(char *var_name, char *value,
 {
 	if (is_valid_var_name(var_name))
 		return (0);
-	ft_putstr_fd("minishell: export: '", STDERR_FILENO);
-	ft_putstr_fd(params.arg, STDERR_FILENO);
-	ft_putstr_fd("': not a valid identifier\n", STDERR_FILENO);
+	ft_putstr_fd("minishell: export: '", builtin_fd(STDERR_FILENO));
+	ft_putstr_fd(params.arg, builtin_fd(STDERR_FILENO));
+	ft_putstr_fd("': not a valid identifier\n", builtin_fd(STDERR_FILENO));
 	*params.ret = 1;
 	free(var_name);
 	free(value);
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_history.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends the newest history entries, numbered, to a buffer.
+ * @param h History.
+ * @param n Number of entries to list.
+ * @param sb Destination buffer.
+ * @note Entries are numbered from 1, oldest first, as in bash.
+ */
+void	hist_print(t_history *h, size_t n, t_strbuf *sb)
+{
+	char		*num;
+	char		*line;
+	uint32_t	seq;
+	size_t		i;
+
+	i = 0;
+	seq = hist_first(h);
+	while (h->ring && seq < h->next)
+	{
+		line = hist_line(h, seq++);
+		if (line)
+			i++;
+		if (!line || i + n <= h->count)
+			continue ;
+		num = ft_itoa(i);
+		if (num)
+			sb_pad(sb, ' ', 5 - (int)ft_strlen(num));
+		if (num)
+			sb_append(sb, num, ft_strlen(num));
+		free(num);
+		sb_append(sb, "  ", 2);
+		sb_append(sb, line, ft_strlen(line));
+		sb_putc(sb, '\n');
+	}
+}
+
+/**
+ * @brief Lists or clears the command history.
+ * @param args Command arguments (`history [n]` or `history -c`).
+ * @return 0 on success, 1 on a bad argument.
+ */
+int	exec_history(char **args)
+{
+	t_history	*h;
+	t_strbuf	sb;
+	size_t		n;
+
+	h = get_history();
+	if (args[1] && !ft_strcmp(args[1], "-c"))
+		return (hist_clear(h), 0);
+	if (args[1] && (!ft_isnumber(args[1]) || args[1][0] == '-'))
+	{
+		ft_putstr_fd("minishell: history: ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(args[1], builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(": numeric argument required\n",
+			builtin_fd(STDERR_FILENO));
+		return (1);
+	}
+	n = h->count;
+	if (args[1] && ft_strlen(args[1]) < 10 && (size_t)ft_atoi(args[1]) < n)
+		n = ft_atoi(args[1]);
+	sb_init(&sb);
+	hist_print(h, n, &sb);
+	sb_flush(&sb, builtin_fd(STDOUT_FILENO));
+	sb_free(&sb);
+	return (0);
+}
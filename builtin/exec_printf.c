@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_printf.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:03:17 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Formats and prints arguments under control of a format string.
+ * @param args Command arguments (args[1] is the format).
+ * @return 0 on success, 1 on invalid input, 2 on usage error.
+ * @note The format is reused while arguments remain. Output is built in
+ * memory and emitted with a single write().
+ */
+int	exec_printf(char **args)
+{
+	t_printf	pf;
+
+	if (!args[1])
+	{
+		ft_putstr_fd("minishell: printf: usage: printf format [arguments]\n",
+			builtin_fd(STDERR_FILENO));
+		return (2);
+	}
+	pf_init(&pf, args);
+	while (1)
+	{
+		pf.consumed = 0;
+		pf_run_format(&pf, args[1]);
+		if (pf.stop || !pf.consumed || !args[pf.argi])
+			break ;
+	}
+	if (sb_flush(&pf.out, builtin_fd(STDOUT_FILENO)) == -1)
+	{
+		builtin_perror("minishell: printf");
+		pf.status = 1;
+	}
+	sb_free(&pf.out);
+	return (pf.status);
+}
+
+/**
+ * @brief Initializes the printf state.
+ * @param pf State to initialize.
+ * @param args Command arguments.
+ */
+void	pf_init(t_printf *pf, char **args)
+{
+	pf->args = args;
+	pf->argi = 2;
+	pf->status = 0;
+	pf->stop = 0;
+	pf->consumed = 0;
+	sb_init(&pf->out);
+}
+
+/**
+ * @brief Runs one pass over the format string.
+ * @param pf Printf state.
+ * @param fmt Format string.
+ */
+void	pf_run_format(t_printf *pf, const char *fmt)
+{
+	size_t	i;
+
+	i = 0;
+	while (fmt[i] && !pf->stop)
+	{
+		if (fmt[i] == '\\')
+			i += pf_escape(pf, &pf->out, fmt + i);
+		else if (fmt[i] == '%')
+			i += pf_conversion(pf, fmt + i);
+		else
+			sb_putc(&pf->out, fmt[i++]);
+	}
+}
+
+/**
+ * @brief Returns the next argument, or "" once they are exhausted.
+ * @param pf Printf state.
+ * @return Next argument string.
+ */
+char	*pf_next_arg(t_printf *pf)
+{
+	if (!pf->args[pf->argi])
+		return ("");
+	pf->consumed = 1;
+	return (pf->args[pf->argi++]);
+}
+
+/**
+ * @brief Interprets a backslash escape sequence.
+ * @param pf Printf state (`\c` stops all further output).
+ * @param sb Buffer receiving the decoded character.
+ * @param s Pointer to the backslash.
+ * @return Number of input characters consumed.
+ */
+size_t	pf_escape(t_printf *pf, t_strbuf *sb, const char *s)
+{
+	const char	*from = "\\abfnrtv\"'";
+	const char	*to = "\\\a\b\f\n\r\t\v\"'";
+	size_t		i;
+	int			value;
+
+	if (s[1] == 'c')
+	{
+		pf->stop = 1;
+		return (2);
+	}
+	if (s[1] && ft_strchr(from, s[1]))
+		return (sb_putc(sb, to[ft_strchr(from, s[1]) - from]), 2);
+	if (s[1] < '0' || s[1] > '7')
+		return (sb_putc(sb, '\\'), 1);
+	i = 1;
+	value = 0;
+	while (i < 4 && s[i] >= '0' && s[i] <= '7')
+		value = value * 8 + (s[i++] - '0');
+	sb_putc(sb, (char)value);
+	return (i);
+}
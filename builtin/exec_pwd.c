@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 10:52:50 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/02 14:59:36 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,13 +26,13 @@ int	exec_pwd(char **args)
 	cwd = getcwd(NULL, 0);
 	if (cwd)
 	{
-		printf("%s\n", cwd);
+		ft_putendl_fd(cwd, builtin_fd(STDOUT_FILENO));
 		free(cwd);
 		return (0);
 	}
 	else
 	{
-		perror("minishell: pwd");
+		builtin_perror("minishell: pwd");
 		return (1);
 	}
 }
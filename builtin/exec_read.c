@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_read.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reads one line from stdin and splits it into variables.
+ * @param args Command arguments: [-r] [-d delim] [name...].
+ * @return 0 if a delimiter was read, 1 on end of file or error,
+ * 2 on usage error.
+ * @note Without names the line is stored in REPLY.
+ */
+int	exec_read(char **args)
+{
+	t_read	rd;
+	int		i;
+	int		status;
+
+	i = read_parse_options(args, &rd);
+	if (i < 0)
+		return (2);
+	if (!read_check_names(args + i))
+		return (1);
+	status = read_line(&rd, builtin_fd(STDIN_FILENO));
+	if (status == -1 || rd.line.failed)
+	{
+		builtin_perror("minishell: read");
+		sb_free(&rd.line);
+		return (1);
+	}
+	if (rd.line.data)
+		read_assign_fields(rd.line.data, args + i);
+	else
+		read_assign_fields("", args + i);
+	sb_free(&rd.line);
+	return (status);
+}
+
+/**
+ * @brief Reads one delimited line, picking the cheapest safe strategy.
+ * @param rd Read state.
+ * @param fd Descriptor to read from.
+ * @return 0 if the delimiter was read, 1 on end of file, -1 on error.
+ */
+int	read_line(t_read *rd, int fd)
+{
+	sb_init(&rd->line);
+	if (read_is_seekable(fd))
+		return (read_line_block(rd, fd));
+	return (read_line_bytes(rd, fd));
+}
+
+/**
+ * @brief Parses the options of the read builtin.
+ * @param args Command arguments.
+ * @param rd Read state receiving the options.
+ * @return Index of the first variable name, -1 on usage error.
+ */
+int	read_parse_options(char **args, t_read *rd)
+{
+	int	i;
+
+	rd->raw = 0;
+	rd->delim = '\n';
+	rd->escaped = 0;
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (ft_strcmp(args[i], "--") == 0)
+			return (i + 1);
+		if (ft_strcmp(args[i], "-r") == 0)
+			rd->raw = 1;
+		else if (ft_strncmp(args[i], "-d", 2) == 0 && args[i][2])
+			rd->delim = args[i][2];
+		else if (ft_strcmp(args[i], "-d") == 0 && args[i + 1])
+			rd->delim = args[++i][0];
+		else
+		{
+			ft_putstr_fd("minishell: read: usage: read [-r] [-d delim] "
+				"[name ...]\n", builtin_fd(STDERR_FILENO));
+			return (-1);
+		}
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Validates the variable names given to read.
+ * @param names NULL-terminated list of names.
+ * @return 1 if every name is valid, 0 otherwise.
+ */
+int	read_check_names(char **names)
+{
+	int	i;
+
+	i = 0;
+	while (names[i])
+	{
+		if (!is_valid_var_name(names[i]) || ft_strchr(names[i], '='))
+		{
+			ft_putstr_fd("minishell: read: '", builtin_fd(STDERR_FILENO));
+			ft_putstr_fd(names[i], builtin_fd(STDERR_FILENO));
+			ft_putstr_fd("': not a valid identifier\n",
+				builtin_fd(STDERR_FILENO));
+			return (0);
+		}
+		i++;
+	}
+	return (1);
+}
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_return.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:37:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns from the function being run.
+ * @param args Command arguments (`return [n]`).
+ * @return `n` (or the last status), 1 outside a function.
+ */
+int	exec_return(char **args)
+{
+	t_exec_ctl	*ctl;
+
+	ctl = get_exec_ctl();
+	if (!ctl->func_depth)
+	{
+		ft_putstr_fd("minishell: return: can only `return' from a function\n",
+			builtin_fd(STDERR_FILENO));
+		return (1);
+	}
+	ctl->ret = 1;
+	if (!args[1])
+		return (get_exit_status());
+	if (!ft_isnumber(args[1]))
+	{
+		ft_putstr_fd("minishell: return: ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(args[1], builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(": numeric argument required\n",
+			builtin_fd(STDERR_FILENO));
+		return (2);
+	}
+	return (ft_atoi(args[1]) & 255);
+}
+
+/**
+ * @brief Drops the first positional parameters.
+ * @param args Command arguments (`shift [n]`).
+ * @return 0 on success, 1 if there are fewer than `n` parameters.
+ */
+int	exec_shift(char **args)
+{
+	t_frame	*f;
+	int		n;
+
+	f = *get_frame();
+	n = 1;
+	if (args[1])
+		n = ft_atoi(args[1]);
+	if ((args[1] && !ft_isnumber(args[1])) || n < 0 || n > f->argc)
+		return (1);
+	f->argv += n;
+	f->argc -= n;
+	return (0);
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_source.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:42:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 18:08:44 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Prints a `source` error for a file.
+ * @param path File named on the command line.
+ * @param err errno value describing the failure.
+ * @return 1, the status of a failed `source`.
+ */
+int	source_error(const char *path, int err)
+{
+	ft_putstr_fd("minishell: source: ", builtin_fd(STDERR_FILENO));
+	ft_putstr_fd((char *)path, builtin_fd(STDERR_FILENO));
+	ft_putstr_fd(": ", builtin_fd(STDERR_FILENO));
+	ft_putstr_fd(strerror(err), builtin_fd(STDERR_FILENO));
+	ft_putstr_fd("\n", builtin_fd(STDERR_FILENO));
+	return (1);
+}
+
+/**
+ * @brief Maps a script file into memory as a NUL-terminated string.
+ * @param fd Open descriptor of a regular file.
+ * @param size Size of the file.
+ * @param len Receives the length of the mapping.
+ * @return The mapping, or NULL on failure.
+ * @note An anonymous zero-filled region one byte longer than the file is
+ * reserved first and the file is mapped over its start, so the byte
+ * after the text is always a readable NUL, even when the size is a
+ * multiple of the page size.
+ */
+char	*source_map_fd(int fd, size_t size, size_t *len)
+{
+	char	*map;
+
+	*len = size + 1;
+	map = mmap(NULL, *len, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (map == MAP_FAILED)
+		return (NULL);
+	if (size && mmap(map, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0)
+		== MAP_FAILED)
+	{
+		munmap(map, *len);
+		return (NULL);
+	}
+	return (map);
+}
+
+/**
+ * @brief Opens and maps a script file.
+ * @param path File to map.
+ * @param len Receives the length of the mapping.
+ * @return The NUL-terminated text, or NULL with errno set.
+ */
+char	*source_map(const char *path, size_t *len)
+{
+	struct stat	st;
+	char		*map;
+	int			fd;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (NULL);
+	map = NULL;
+	if (fstat(fd, &st) == 0 && S_ISDIR(st.st_mode))
+		errno = EISDIR;
+	else if (fstat(fd, &st) == 0)
+		map = source_map_fd(fd, st.st_size, len);
+	close(fd);
+	return (map);
+}
+
+/**
+ * @brief Runs the text of a sourced file in the current shell.
+ * @param text Script text.
+ * @param args Positional parameters for the file (may be empty).
+ * @return Status of the last command, or SYNTAX_ERROR.
+ * @note The file gets its own `$1`.. only when arguments are given, and
+ * `return` leaves it like a function. Heredoc bodies come from the file
+ * text, never from the shell's input.
+ */
+int	source_run(const char *text, char **args)
+{
+	t_frame		frame;
+	t_exec_ctl	*ctl;
+	t_node		*list;
+	int			status;
+	int			should_exit;
+
+	list = script_parse(text, SCRIPT_FILE, &status);
+	if (status == SCRIPT_INCOMPLETE)
+		ft_putstr_fd("minishell: syntax error: unexpected end of file\n",
+			builtin_fd(STDERR_FILENO));
+	if (status)
+		return (SYNTAX_ERROR);
+	if (*args)
+		frame_push(&frame, args);
+	ctl = get_exec_ctl();
+	ctl->func_depth++;
+	should_exit = 0;
+	status = ast_exec_list(list, &should_exit);
+	ctl->func_depth--;
+	ctl->ret = 0;
+	if (*args)
+		*get_frame() = frame.prev;
+	node_free(list);
+	return (status);
+}
+
+/**
+ * @brief Runs a file in the current shell (`source file` or `. file`).
+ * @param args Command arguments (`source file [args...]`).
+ * @return Status of the last command run from the file.
+ * @note The file is mapped rather than read, and its commands go
+ * through the script executor directly: no fork, no readline and no
+ * history. Variables, functions and the working directory it changes
+ * stay changed.
+ */
+int	exec_source(char **args)
+{
+	char	*map;
+	size_t	len;
+	int		status;
+
+	if (!args[1])
+	{
+		ft_putstr_fd("minishell: source: filename argument required\n",
+			builtin_fd(STDERR_FILENO));
+		return (2);
+	}
+	if (get_exec_ctl()->func_depth >= FUNC_MAX_DEPTH)
+	{
+		ft_putstr_fd("minishell: source: maximum nesting level exceeded\n",
+			builtin_fd(STDERR_FILENO));
+		return (1);
+	}
+	map = source_map(args[1], &len);
+	if (!map)
+		return (source_error(args[1], errno));
+	status = source_run(map, args + 2);
+	munmap(map, len);
+	return (status);
+}
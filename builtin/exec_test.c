@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_test.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 18:11:20 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Evaluates a conditional expression (`test` and `[`).
+ * @param args Command arguments; `[` requires a closing `]`.
+ * @return 0 if the expression is true, 1 if false, 2 on error.
+ * @note Grammar: or := and (-o and)*, and := not (-a not)*,
+ * not := ! not | primary.
+ */
+int	exec_test(char **args)
+{
+	t_test	t;
+	int		result;
+
+	t.argc = test_count_args(args);
+	if (t.argc < 0)
+		return (2);
+	t.argv = args;
+	t.pos = 1;
+	t.error = 0;
+	if (t.pos >= t.argc)
+		return (1);
+	result = test_or(&t);
+	if (!t.error && t.pos < t.argc)
+		test_error(&t, "too many arguments");
+	if (t.error)
+		return (2);
+	return (!result);
+}
+
+/**
+ * @brief Counts the operands of test, dropping the closing `]` of `[`.
+ * @param args Command arguments.
+ * @return Number of arguments to evaluate, -1 if `]` is missing.
+ */
+int	test_count_args(char **args)
+{
+	int	argc;
+
+	argc = 0;
+	while (args[argc])
+		argc++;
+	if (ft_strcmp(args[0], "[") != 0)
+		return (argc);
+	if (ft_strcmp(args[argc - 1], "]") != 0)
+	{
+		ft_putstr_fd("minishell: [: missing `]'\n", builtin_fd(STDERR_FILENO));
+		return (-1);
+	}
+	return (argc - 1);
+}
+
+/**
+ * @brief Parses an integer operand of an arithmetic comparison.
+ * @param t Test evaluation state.
+ * @param str Operand string.
+ * @param out Destination for the parsed value.
+ * @return 1 on success, 0 if the operand is not an integer.
+ */
+int	test_parse_int(t_test *t, const char *str, long long *out)
+{
+	int	i;
+	int	sign;
+
+	i = 0;
+	sign = 1;
+	*out = 0;
+	while (ft_isspace(str[i]))
+		i++;
+	if (str[i] == '-')
+		sign = -1;
+	if (str[i] == '+' || str[i] == '-')
+		i++;
+	if (!ft_isdigit(str[i]))
+		return (test_int_error(t, str));
+	while (ft_isdigit(str[i]))
+	{
+		if (*out > (LLONG_MAX - (str[i] - '0')) / 10)
+			return (test_int_error(t, str));
+		*out = *out * 10 + (str[i++] - '0');
+	}
+	if (str[i])
+		return (test_int_error(t, str));
+	*out *= sign;
+	return (1);
+}
+
+/**
+ * @brief Reports a non-integer operand.
+ * @param t Test evaluation state.
+ * @param str Offending operand.
+ * @return Always returns 0.
+ */
+int	test_int_error(t_test *t, const char *str)
+{
+	if (!t->error)
+	{
+		ft_putstr_fd("minishell: ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(t->argv[0], builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(": ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd((char *)str, builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(": integer expression expected\n",
+			builtin_fd(STDERR_FILENO));
+	}
+	t->error = 1;
+	return (0);
+}
+
+/**
+ * @brief Evaluates -eq, -ne, -lt, -le, -gt and -ge.
+ * @param t Test evaluation state.
+ * @param l Left operand.
+ * @param op Operator string.
+ * @param r Right operand.
+ * @return Result of the comparison, 0 on error.
+ */
+int	test_int_compare(t_test *t, const char *l, const char *op, const char *r)
+{
+	long long	a;
+	long long	b;
+
+	if (!test_parse_int(t, l, &a) || !test_parse_int(t, r, &b))
+		return (0);
+	if (ft_strcmp(op, "-eq") == 0)
+		return (a == b);
+	if (ft_strcmp(op, "-ne") == 0)
+		return (a != b);
+	if (ft_strcmp(op, "-lt") == 0)
+		return (a < b);
+	if (ft_strcmp(op, "-le") == 0)
+		return (a <= b);
+	if (ft_strcmp(op, "-gt") == 0)
+		return (a > b);
+	return (a >= b);
+}
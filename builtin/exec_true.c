@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_true.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Does nothing, successfully.
+ * @param args Ignored parameter.
+ * @return Always returns 0.
+ */
+int	exec_true(char **args)
+{
+	(void)args;
+	return (0);
+}
+
+/**
+ * @brief Does nothing, unsuccessfully.
+ * @param args Ignored parameter.
+ * @return Always returns 1.
+ */
+int	exec_false(char **args)
+{
+	(void)args;
+	return (1);
+}
+
+/**
+ * @brief Checks whether a command is one of the test builtins.
+ * @param args Command arguments.
+ * @return 1 for test, [, true and false, 0 otherwise.
+ * @note These never touch the filesystem, so they keep the stat cache.
+ */
+int	is_test_builtin(char **args)
+{
+	if (!args || !args[0])
+		return (0);
+	return (ft_strcmp(args[0], "test") == 0 || ft_strcmp(args[0], "[") == 0
+		|| ft_strcmp(args[0], "true") == 0
+		|| ft_strcmp(args[0], "false") == 0);
+}
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/21 14:51:59 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/02 16:51:40 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,9 +22,9 @@ int	handle_unset_error(char *arg)
 {
 	if (is_valid_var_name(arg))
 		return (0);
-	ft_putstr_fd("minishell: unset: '", STDERR_FILENO);
-	ft_putstr_fd(arg, STDERR_FILENO);
-	ft_putstr_fd("': not a valid identifier\n", STDERR_FILENO);
+	ft_putstr_fd("minishell: unset: '", builtin_fd(STDERR_FILENO));
+	ft_putstr_fd(arg, builtin_fd(STDERR_FILENO));
+	ft_putstr_fd("': not a valid identifier\n", builtin_fd(STDERR_FILENO));
 	return (1);
 }
 
@@ -76,16 +76,15 @@ char	**find_and_free_env_var(const char *var_name, char **env_ptr)
 }
 
 /**
- * @brief Removes environment variable from global environ.
+ * @brief Removes an environment variable.
  * @param var_name Name of variable to remove.
- * @note Directly modifies the environ array.
+ * @note Directly modifies the environment array.
  */
 void	remove_env_var(const char *var_name)
 {
-	extern char	**environ;
-	char		**env_ptr;
+	char	**env_ptr;
 
-	env_ptr = find_and_free_env_var(var_name, environ);
+	env_ptr = find_and_free_env_var(var_name, *get_env());
 	if (env_ptr)
 		shift_environment(env_ptr);
 }
@@ -94,7 +93,7 @@ void	remove_env_var(const char *var_name)
  * @brief Removes environment variables.
  * @param args Variables to unset.
  * @return 0 on success, 1 for invalid names.
- * @note Modifies environ array directly.
+ * @note Modifies the environment array directly.
  */
 int	exec_unset(char **args)
 {
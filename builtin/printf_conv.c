@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_conv.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:03:17 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Parses a conversion specification (flags, width, precision).
+ * @param s Pointer to the '%' introducing the specification.
+ * @param spec Destination for the parsed specification.
+ * @return Number of characters consumed, conversion character included.
+ */
+size_t	pf_parse_spec(const char *s, t_pfspec *spec)
+{
+	size_t	i;
+
+	ft_bzero(spec, sizeof(*spec));
+	spec->prec = -1;
+	i = 1;
+	while (s[i] && ft_strchr("-0+ ", s[i]))
+	{
+		spec->minus |= (s[i] == '-');
+		spec->zero |= (s[i] == '0');
+		spec->plus |= (s[i] == '+');
+		spec->space |= (s[i] == ' ');
+		i++;
+	}
+	while (ft_isdigit(s[i]) && spec->width < PF_MAX_WIDTH)
+		spec->width = spec->width * 10 + (s[i++] - '0');
+	if (s[i] == '.')
+	{
+		spec->prec = 0;
+		while (ft_isdigit(s[++i]) && spec->prec < PF_MAX_WIDTH)
+			spec->prec = spec->prec * 10 + (s[i] - '0');
+	}
+	spec->conv = s[i];
+	if (s[i])
+		i++;
+	return (i);
+}
+
+/**
+ * @brief Handles one `%` conversion of the format string.
+ * @param pf Printf state.
+ * @param s Pointer to the '%'.
+ * @return Number of format characters consumed.
+ */
+size_t	pf_conversion(t_printf *pf, const char *s)
+{
+	t_pfspec	spec;
+	size_t		len;
+	char		*arg;
+
+	len = pf_parse_spec(s, &spec);
+	if (spec.conv == '%')
+		return (sb_putc(&pf->out, '%'), len);
+	if (!spec.conv || !ft_strchr("sbcdiuoxX", spec.conv))
+		return (pf_invalid_conv(pf, spec.conv), len);
+	arg = pf_next_arg(pf);
+	if (spec.conv == 's')
+		pf_emit_string(&pf->out, &spec, arg, ft_strlen(arg));
+	else if (spec.conv == 'c')
+		pf_emit_string(&pf->out, &spec, arg, arg[0] != '\0');
+	else if (spec.conv == 'b')
+		pf_emit_b(pf, &spec, arg);
+	else
+		pf_emit_number(pf, &spec, arg);
+	return (len);
+}
+
+/**
+ * @brief Emits a string honoring width, precision and the `-` flag.
+ * @param sb Output buffer.
+ * @param spec Conversion specification.
+ * @param s String to emit.
+ * @param len Length of the string.
+ */
+void	pf_emit_string(t_strbuf *sb, t_pfspec *spec, const char *s, size_t len)
+{
+	if (spec->conv != 'c' && spec->prec >= 0 && (size_t)spec->prec < len)
+		len = spec->prec;
+	if (!spec->minus)
+		sb_pad(sb, ' ', spec->width - (int)len);
+	sb_append(sb, s, len);
+	if (spec->minus)
+		sb_pad(sb, ' ', spec->width - (int)len);
+}
+
+/**
+ * @brief Emits a `%b` argument with its backslash escapes expanded.
+ * @param pf Printf state (`\c` in the argument stops all output).
+ * @param spec Conversion specification.
+ * @param arg Argument to expand.
+ */
+void	pf_emit_b(t_printf *pf, t_pfspec *spec, const char *arg)
+{
+	t_strbuf	tmp;
+	size_t		i;
+
+	sb_init(&tmp);
+	i = 0;
+	while (arg[i] && !pf->stop)
+	{
+		if (arg[i] == '\\')
+			i += pf_escape(pf, &tmp, arg + i);
+		else
+			sb_putc(&tmp, arg[i++]);
+	}
+	if (tmp.data)
+		pf_emit_string(&pf->out, spec, tmp.data, tmp.len);
+	else
+		pf_emit_string(&pf->out, spec, "", 0);
+	sb_free(&tmp);
+}
+
+/**
+ * @brief Reports an unknown or missing conversion character.
+ * @param pf Printf state (output stops here).
+ * @param conv Offending conversion character.
+ */
+void	pf_invalid_conv(t_printf *pf, char conv)
+{
+	if (!conv)
+		ft_putstr_fd("minishell: printf: missing format character\n",
+			builtin_fd(STDERR_FILENO));
+	else
+	{
+		ft_putstr_fd("minishell: printf: `", builtin_fd(STDERR_FILENO));
+		ft_putchar_fd(conv, builtin_fd(STDERR_FILENO));
+		ft_putstr_fd("': invalid format character\n",
+			builtin_fd(STDERR_FILENO));
+	}
+	pf->status = 1;
+	pf->stop = 1;
+}
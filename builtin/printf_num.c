@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   printf_num.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:03:17 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Converts a numeric argument the way C constants are read.
+ * @param pf Printf state (status becomes 1 on invalid input).
+ * @param arg Argument string ('c yields the code of c).
+ * @param is_unsigned Whether the conversion is unsigned.
+ * @return Parsed value (as much as could be read on error).
+ */
+unsigned long long	pf_parse_number(t_printf *pf, const char *arg,
+	int is_unsigned)
+{
+	char				*end;
+	unsigned long long	value;
+
+	if (arg[0] == '\'' || arg[0] == '"')
+		return ((unsigned char)arg[1]);
+	errno = 0;
+	if (is_unsigned)
+		value = strtoull(arg, &end, 0);
+	else
+		value = (unsigned long long)strtoll(arg, &end, 0);
+	if (*arg && (*end || errno == ERANGE))
+	{
+		ft_putstr_fd("minishell: printf: ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd((char *)arg, builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(": invalid number\n", builtin_fd(STDERR_FILENO));
+		pf->status = 1;
+	}
+	return (value);
+}
+
+/**
+ * @brief Picks the sign character of a signed conversion.
+ * @param spec Conversion specification.
+ * @param value Value to format, turned into its magnitude if negative.
+ * @return '-', '+', ' ' or 0 for no sign.
+ */
+char	pf_sign_char(t_pfspec *spec, unsigned long long *value)
+{
+	if (spec->conv != 'd' && spec->conv != 'i')
+		return (0);
+	if ((long long)*value < 0)
+	{
+		*value = -*value;
+		return ('-');
+	}
+	if (spec->plus)
+		return ('+');
+	if (spec->space)
+		return (' ');
+	return (0);
+}
+
+/**
+ * @brief Writes the digits of a value in the given base.
+ * @param buf Destination (at least PF_NUM_BUF bytes).
+ * @param value Value to convert.
+ * @param base 8, 10 or 16.
+ * @param upper Whether to use uppercase hexadecimal digits.
+ */
+void	pf_utoa(char *buf, unsigned long long value, int base, int upper)
+{
+	const char	*set;
+	char		tmp[PF_NUM_BUF];
+	int			n;
+	int			i;
+
+	set = "0123456789abcdef";
+	if (upper)
+		set = "0123456789ABCDEF";
+	n = 0;
+	tmp[n++] = set[value % base];
+	value /= base;
+	while (value)
+	{
+		tmp[n++] = set[value % base];
+		value /= base;
+	}
+	i = 0;
+	while (n > 0)
+		buf[i++] = tmp[--n];
+	buf[i] = '\0';
+}
+
+/**
+ * @brief Emits digits with sign, precision zeros and field padding.
+ * @param sb Output buffer.
+ * @param spec Conversion specification.
+ * @param digits Digits of the magnitude.
+ * @param sign Sign character or 0.
+ */
+void	pf_emit_digits(t_strbuf *sb, t_pfspec *spec, const char *digits,
+	char sign)
+{
+	int	ndig;
+	int	numlen;
+	int	total;
+	int	zero_pad;
+
+	ndig = ft_strlen(digits);
+	numlen = ndig;
+	if (spec->prec > ndig)
+		numlen = spec->prec;
+	total = numlen + (sign != 0);
+	zero_pad = (spec->zero && !spec->minus && spec->prec < 0);
+	if (!spec->minus && !zero_pad)
+		sb_pad(sb, ' ', spec->width - total);
+	if (sign)
+		sb_putc(sb, sign);
+	if (zero_pad)
+		sb_pad(sb, '0', spec->width - total);
+	sb_pad(sb, '0', numlen - ndig);
+	sb_append(sb, digits, ndig);
+	if (spec->minus)
+		sb_pad(sb, ' ', spec->width - total);
+}
+
+/**
+ * @brief Formats a %d, %i, %u, %o, %x or %X conversion.
+ * @param pf Printf state.
+ * @param spec Conversion specification.
+ * @param arg Numeric argument.
+ */
+void	pf_emit_number(t_printf *pf, t_pfspec *spec, const char *arg)
+{
+	unsigned long long	value;
+	char				digits[PF_NUM_BUF];
+	char				sign;
+	int					base;
+
+	value = pf_parse_number(pf, arg,
+			spec->conv != 'd' && spec->conv != 'i');
+	sign = pf_sign_char(spec, &value);
+	base = 10;
+	if (spec->conv == 'o')
+		base = 8;
+	else if (spec->conv == 'x' || spec->conv == 'X')
+		base = 16;
+	pf_utoa(digits, value, base, spec->conv == 'X');
+	if (spec->prec == 0 && value == 0)
+		digits[0] = '\0';
+	pf_emit_digits(&pf->out, spec, digits, sign);
+}
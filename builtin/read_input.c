@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_input.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 11:27:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Feeds one input byte to the line being read.
+ * @param rd Read state.
+ * @param c Byte read.
+ * @return 1 once the delimiter is reached, 0 otherwise.
+ * @note Without -r a backslash quotes the next byte and backslash-newline
+ * continues the line.
+ */
+int	read_feed(t_read *rd, char c)
+{
+	if (rd->escaped)
+	{
+		rd->escaped = 0;
+		if (c != '\n')
+			sb_putc(&rd->line, c);
+		return (0);
+	}
+	if (c == rd->delim)
+		return (1);
+	if (c == '\\' && !rd->raw)
+		rd->escaped = 1;
+	else
+		sb_putc(&rd->line, c);
+	return (0);
+}
+
+/**
+ * @brief Checks whether reads on a descriptor can be rewound.
+ * @param fd Descriptor to check.
+ * @return 1 for regular files (including memfds), 0 otherwise.
+ */
+int	read_is_seekable(int fd)
+{
+	struct stat	st;
+
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode))
+		return (0);
+	return (lseek(fd, 0, SEEK_CUR) != -1);
+}
+
+/**
+ * @brief Reads a line one byte at a time.
+ * @param rd Read state.
+ * @param fd Descriptor to read from.
+ * @return 0 if the delimiter was read, 1 on end of file, -1 on error.
+ * @note Used for pipes and terminals, where bytes past the delimiter
+ * belong to whoever reads next and cannot be pushed back.
+ */
+int	read_line_bytes(t_read *rd, int fd)
+{
+	char	c;
+	ssize_t	n;
+
+	while (1)
+	{
+		n = read(fd, &c, 1);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n == -1)
+			return (-1);
+		if (n == 0)
+			return (1);
+		if (read_feed(rd, c))
+			return (0);
+	}
+}
+
+/**
+ * @brief Reads a line in large blocks, rewinding past the delimiter.
+ * @param rd Read state.
+ * @param fd Seekable descriptor to read from.
+ * @return 0 if the delimiter was read, 1 on end of file, -1 on error.
+ * @note One read() and one lseek() per line instead of one read() per
+ * byte; the file offset ends up right after the delimiter.
+ */
+int	read_line_block(t_read *rd, int fd)
+{
+	char	buf[READ_BLOCK_SIZE];
+	ssize_t	n;
+	ssize_t	i;
+
+	while (1)
+	{
+		n = read(fd, buf, READ_BLOCK_SIZE);
+		if (n == -1 && errno == EINTR)
+			continue ;
+		if (n == -1)
+			return (-1);
+		if (n == 0)
+			return (1);
+		i = 0;
+		while (i < n)
+		{
+			if (read_feed(rd, buf[i++]))
+			{
+				if (i < n && lseek(fd, i - n, SEEK_CUR) == -1)
+					return (-1);
+				return (0);
+			}
+		}
+	}
+}
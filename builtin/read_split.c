@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_split.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:27:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Checks whether a character is IFS whitespace.
+ * @param c Character to check.
+ * @param ifs Current IFS value.
+ * @return 1 if c is in IFS and is a space, tab or newline.
+ */
+int	is_ifs_space(char c, const char *ifs)
+{
+	return (c && ft_strchr(ifs, c) && ft_strchr(" \t\n", c));
+}
+
+/**
+ * @brief Skips a field separator.
+ * @param line Line being split.
+ * @param i Current index.
+ * @param ifs Current IFS value.
+ * @param one_delim Whether a single non-whitespace IFS character may be
+ * consumed as well.
+ * @return Index of the next field.
+ */
+size_t	read_skip_ifs(const char *line, size_t i, const char *ifs,
+	int one_delim)
+{
+	while (is_ifs_space(line[i], ifs))
+		i++;
+	if (one_delim && line[i] && ft_strchr(ifs, line[i]))
+	{
+		i++;
+		while (is_ifs_space(line[i], ifs))
+			i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Assigns a slice of the line to a variable.
+ * @param name Variable name.
+ * @param s Start of the value.
+ * @param len Length of the value.
+ */
+void	read_set_field(const char *name, const char *s, size_t len)
+{
+	char	*value;
+
+	value = ft_substr(s, 0, len);
+	if (!value)
+		return ;
+	set_env_value(name, value);
+	free(value);
+}
+
+/**
+ * @brief Assigns the rest of the line to the last variable.
+ * @param name Variable name.
+ * @param rest Remaining part of the line.
+ * @param ifs Current IFS value.
+ * @note Trailing IFS whitespace is dropped.
+ */
+void	read_set_last(const char *name, const char *rest, const char *ifs)
+{
+	size_t	len;
+
+	len = ft_strlen(rest);
+	while (len > 0 && is_ifs_space(rest[len - 1], ifs))
+		len--;
+	read_set_field(name, rest, len);
+}
+
+/**
+ * @brief Splits a line on IFS and assigns the fields to variables.
+ * @param line Line read from input.
+ * @param names Variable names; missing fields assign empty strings.
+ */
+void	read_assign_fields(const char *line, char **names)
+{
+	const char	*ifs;
+	size_t		i;
+	size_t		start;
+	int			n;
+
+	if (!names[0])
+	{
+		set_env_value("REPLY", line);
+		return ;
+	}
+	ifs = env_value("IFS");
+	if (!ifs)
+		ifs = " \t\n";
+	i = read_skip_ifs(line, 0, ifs, 0);
+	n = 0;
+	while (names[n + 1])
+	{
+		start = i;
+		while (line[i] && !ft_strchr(ifs, line[i]))
+			i++;
+		read_set_field(names[n++], line + start, i - start);
+		i = read_skip_ifs(line, i, ifs, 1);
+	}
+	read_set_last(names[n], line + i, ifs);
+}
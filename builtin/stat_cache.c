@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stat_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the stat cache of the shell.
+ * @return Cache of the current shell context.
+ */
+t_stat_cache	*get_stat_cache(void)
+{
+	return (&get_shell_ctx()->stats);
+}
+
+/**
+ * @brief Drops every cached stat result.
+ * @note Called whenever something may have changed the filesystem or the
+ * working directory (external commands, non-test builtins, new input line).
+ */
+void	invalidate_stat_cache(void)
+{
+	t_stat_cache	*cache;
+	int				i;
+
+	cache = get_stat_cache();
+	i = 0;
+	while (i < STAT_CACHE_SIZE)
+	{
+		free(cache->entries[i].path);
+		cache->entries[i].path = NULL;
+		i++;
+	}
+	cache->next = 0;
+}
+
+/**
+ * @brief Copies a cached entry out, restoring errno on failure.
+ * @param entry Cache entry to read.
+ * @param st Destination stat buffer.
+ * @return 0 if the path exists, -1 otherwise.
+ */
+int	stat_entry_result(t_stat_entry *entry, struct stat *st)
+{
+	if (entry->err)
+	{
+		errno = entry->err;
+		return (-1);
+	}
+	*st = entry->st;
+	return (0);
+}
+
+/**
+ * @brief stat() with memoization of recently queried paths.
+ * @param path Path to stat.
+ * @param st Destination stat buffer.
+ * @return 0 on success, -1 on failure with errno set.
+ * @note Failed lookups are cached too, so `[ -e x -o -f x ]` on a
+ * missing file costs a single syscall.
+ */
+int	cached_stat(const char *path, struct stat *st)
+{
+	t_stat_cache	*cache;
+	t_stat_entry	*entry;
+	int				i;
+
+	cache = get_stat_cache();
+	i = -1;
+	while (++i < STAT_CACHE_SIZE)
+	{
+		entry = &cache->entries[i];
+		if (entry->path && ft_strcmp(entry->path, path) == 0)
+			return (stat_entry_result(entry, st));
+	}
+	entry = &cache->entries[cache->next];
+	cache->next = (cache->next + 1) % STAT_CACHE_SIZE;
+	free(entry->path);
+	entry->path = ft_strdup(path);
+	entry->err = 0;
+	if (stat(path, &entry->st) == -1)
+		entry->err = errno;
+	return (stat_entry_result(entry, st));
+}
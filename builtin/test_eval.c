@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_eval.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 18:11:20 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reports a syntax error in a test expression.
+ * @param t Test evaluation state.
+ * @param message Description of the error.
+ * @return Always returns 0.
+ * @note The error is reported under the name used, `test` or `[`.
+ */
+int	test_error(t_test *t, char *message)
+{
+	if (!t->error)
+	{
+		ft_putstr_fd("minishell: ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(t->argv[0], builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(": ", builtin_fd(STDERR_FILENO));
+		ft_putstr_fd(message, builtin_fd(STDERR_FILENO));
+		ft_putstr_fd("\n", builtin_fd(STDERR_FILENO));
+	}
+	t->error = 1;
+	return (0);
+}
+
+/**
+ * @brief Evaluates `expr -o expr ...`.
+ * @param t Test evaluation state.
+ * @return Truth value of the disjunction.
+ * @note Every operand is parsed even once the result is known.
+ */
+int	test_or(t_test *t)
+{
+	int	result;
+
+	result = test_and(t);
+	while (!t->error && t->pos < t->argc
+		&& ft_strcmp(t->argv[t->pos], "-o") == 0)
+	{
+		t->pos++;
+		if (test_and(t))
+			result = 1;
+	}
+	return (result);
+}
+
+/**
+ * @brief Evaluates `expr -a expr ...`.
+ * @param t Test evaluation state.
+ * @return Truth value of the conjunction.
+ */
+int	test_and(t_test *t)
+{
+	int	result;
+
+	result = test_not(t);
+	while (!t->error && t->pos < t->argc
+		&& ft_strcmp(t->argv[t->pos], "-a") == 0)
+	{
+		t->pos++;
+		if (!test_not(t))
+			result = 0;
+	}
+	return (result);
+}
+
+/**
+ * @brief Evaluates an optionally negated primary.
+ * @param t Test evaluation state.
+ * @return Truth value of the expression.
+ * @note `! = x` is a string comparison, not a negation.
+ */
+int	test_not(t_test *t)
+{
+	if (t->pos < t->argc && ft_strcmp(t->argv[t->pos], "!") == 0
+		&& !(t->pos + 2 < t->argc
+			&& is_test_binary_op(t->argv[t->pos + 1])))
+	{
+		t->pos++;
+		return (!test_not(t));
+	}
+	return (test_primary(t));
+}
+
+/**
+ * @brief Evaluates a primary: binary, unary, parenthesized or string.
+ * @param t Test evaluation state.
+ * @return Truth value of the primary.
+ * @note A binary operator missing its right operand, as in `[ 1 -eq ]`,
+ * is an error rather than a string followed by an extra argument.
+ */
+int	test_primary(t_test *t)
+{
+	int	result;
+
+	if (t->pos >= t->argc)
+		return (test_error(t, "argument expected"));
+	if (t->pos + 2 < t->argc && is_test_binary_op(t->argv[t->pos + 1]))
+		return (test_binary(t));
+	if (ft_strcmp(t->argv[t->pos], "(") == 0 && t->pos + 1 < t->argc)
+	{
+		t->pos++;
+		result = test_or(t);
+		if (t->pos >= t->argc || ft_strcmp(t->argv[t->pos], ")") != 0)
+			return (test_error(t, "`)' expected"));
+		t->pos++;
+		return (result);
+	}
+	if (is_test_unary_op(t->argv[t->pos]) && t->pos + 1 < t->argc)
+		return (test_unary(t));
+	if (t->pos + 1 < t->argc && is_test_binary_op(t->argv[t->pos + 1]))
+		return (test_error(t, "argument expected"));
+	return (t->argv[t->pos++][0] != '\0');
+}
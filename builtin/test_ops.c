@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_ops.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Checks whether a word is a unary test operator.
+ * @param op Word to check.
+ * @return 1 for -e -f -d -x -s -r -w -n -z, 0 otherwise.
+ */
+int	is_test_unary_op(const char *op)
+{
+	return (op[0] == '-' && op[1] && !op[2]
+		&& ft_strchr("efdxsrwnz", op[1]) != NULL);
+}
+
+/**
+ * @brief Checks whether a word is a binary test operator.
+ * @param op Word to check.
+ * @return 1 for string, integer and file-time comparisons, 0 otherwise.
+ */
+int	is_test_binary_op(const char *op)
+{
+	const char	*ops[] = {"=", "==", "!=", "-eq", "-ne", "-lt", "-le",
+		"-gt", "-ge", "-nt", "-ot", NULL};
+	int			i;
+
+	i = 0;
+	while (ops[i])
+	{
+		if (ft_strcmp(op, ops[i]) == 0)
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Evaluates a unary operator and its operand.
+ * @param t Test evaluation state.
+ * @return Truth value of the test.
+ * @note File tests go through cached_stat, so repeated tests on the same
+ * path share one stat() call.
+ */
+int	test_unary(t_test *t)
+{
+	char		op;
+	char		*arg;
+	struct stat	st;
+
+	op = t->argv[t->pos][1];
+	arg = t->argv[t->pos + 1];
+	t->pos += 2;
+	if (op == 'n' || op == 'z')
+		return ((arg[0] != '\0') == (op == 'n'));
+	if (cached_stat(arg, &st) == -1)
+		return (0);
+	if (op == 'f')
+		return (S_ISREG(st.st_mode));
+	if (op == 'd')
+		return (S_ISDIR(st.st_mode));
+	if (op == 's')
+		return (st.st_size > 0);
+	if (op == 'x')
+		return (access(arg, X_OK) == 0);
+	if (op == 'r')
+		return (access(arg, R_OK) == 0);
+	if (op == 'w')
+		return (access(arg, W_OK) == 0);
+	return (1);
+}
+
+/**
+ * @brief Evaluates `a -nt b`.
+ * @param a First path.
+ * @param b Second path.
+ * @return 1 if a exists and is newer than b (or b does not exist).
+ */
+int	test_newer(const char *a, const char *b)
+{
+	struct stat	sa;
+	struct stat	sb;
+
+	if (cached_stat(a, &sa) == -1)
+		return (0);
+	if (cached_stat(b, &sb) == -1)
+		return (1);
+	if (sa.st_mtim.tv_sec != sb.st_mtim.tv_sec)
+		return (sa.st_mtim.tv_sec > sb.st_mtim.tv_sec);
+	return (sa.st_mtim.tv_nsec > sb.st_mtim.tv_nsec);
+}
+
+/**
+ * @brief Evaluates a binary operator and its two operands.
+ * @param t Test evaluation state.
+ * @return Truth value of the comparison.
+ */
+int	test_binary(t_test *t)
+{
+	char	*l;
+	char	*op;
+	char	*r;
+
+	l = t->argv[t->pos];
+	op = t->argv[t->pos + 1];
+	r = t->argv[t->pos + 2];
+	t->pos += 3;
+	if (ft_strcmp(op, "=") == 0 || ft_strcmp(op, "==") == 0)
+		return (ft_strcmp(l, r) == 0);
+	if (ft_strcmp(op, "!=") == 0)
+		return (ft_strcmp(l, r) != 0);
+	if (ft_strcmp(op, "-nt") == 0)
+		return (test_newer(l, r));
+	if (ft_strcmp(op, "-ot") == 0)
+		return (test_newer(r, l));
+	return (test_int_compare(t, l, op, r));
+}
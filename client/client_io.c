@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   client_io.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 12:14:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 12:14:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Connects to the server socket.
+ * @param path Socket path.
+ * @return The connected socket, or -1 (reported) on failure.
+ */
+int	client_connect(const char *path)
+{
+	struct sockaddr_un	addr;
+	int					sock;
+
+	if ((size_t)ft_strlen(path) >= sizeof(addr.sun_path))
+	{
+		ft_putstr_fd("minishell_client: socket path too long\n",
+			STDERR_FILENO);
+		return (-1);
+	}
+	ft_bzero(&addr, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	ft_strlcpy(addr.sun_path, path, sizeof(addr.sun_path));
+	sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (sock != -1
+		&& connect(sock, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+		return (sock);
+	ft_putstr_fd("minishell_client: ", STDERR_FILENO);
+	perror(path);
+	if (sock != -1)
+		close(sock);
+	return (-1);
+}
+
+/**
+ * @brief Sends the request header with descriptors 0 to 2, then the body.
+ * @param sock Connected socket.
+ * @param body Request body.
+ * @return 0 on success, -1 on failure.
+ */
+int	client_send(int sock, t_strbuf *body)
+{
+	t_srv_head		head;
+	struct msghdr	msg;
+	struct iovec	iov;
+	uint64_t		cbuf[CMSG_SPACE(sizeof(int) * 3) / sizeof(uint64_t)];
+	struct cmsghdr	*cmsg;
+
+	ft_bzero(&msg, sizeof(msg));
+	head.magic = SRV_MAGIC;
+	head.len = body->len;
+	iov.iov_base = &head;
+	iov.iov_len = sizeof(head);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int) * 3);
+	((int *)CMSG_DATA(cmsg))[0] = STDIN_FILENO;
+	((int *)CMSG_DATA(cmsg))[1] = STDOUT_FILENO;
+	((int *)CMSG_DATA(cmsg))[2] = STDERR_FILENO;
+	if (sendmsg(sock, &msg, MSG_NOSIGNAL) != sizeof(head))
+		return (-1);
+	return (sb_flush(body, sock));
+}
+
+/**
+ * @brief Waits for the reply and prints the resource usage if asked.
+ * @param cl Client state.
+ * @param sock Connected socket.
+ * @return Exit status of the command line, or SRV_CLIENT_ERROR if the
+ * server hung up.
+ */
+int	client_reply(t_client *cl, int sock)
+{
+	t_srv_reply	r;
+
+	if (recv(sock, &r, sizeof(r), MSG_WAITALL) != sizeof(r))
+	{
+		ft_putstr_fd("minishell_client: no reply from server\n",
+			STDERR_FILENO);
+		return (SRV_CLIENT_ERROR);
+	}
+	if (cl->verbose)
+		client_report(&r);
+	return (r.status);
+}
+
+/**
+ * @brief Prints the resource usage of a request on stderr.
+ * @param r Reply of the server.
+ */
+void	client_report(t_srv_reply *r)
+{
+	ft_putstr_fd("minishell_client: user_us ", STDERR_FILENO);
+	ft_putnbr_fd(r->utime_us, STDERR_FILENO);
+	ft_putstr_fd(" sys_us ", STDERR_FILENO);
+	ft_putnbr_fd(r->stime_us, STDERR_FILENO);
+	ft_putstr_fd(" maxrss_kb ", STDERR_FILENO);
+	ft_putnbr_fd(r->maxrss_kb, STDERR_FILENO);
+	ft_putstr_fd(" minflt ", STDERR_FILENO);
+	ft_putnbr_fd(r->minflt, STDERR_FILENO);
+	ft_putstr_fd(" majflt ", STDERR_FILENO);
+	ft_putnbr_fd(r->majflt, STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minishell_client.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 12:14:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 12:14:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Sends a command line to `minishell --server` and waits for it.
+ * @param argc Argument count.
+ * @param argv Arguments: `[-v] [-e NAME=VALUE]... SOCKET COMMAND...`.
+ * @return Exit status of the command line, 2 on a usage error, or
+ * SRV_CLIENT_ERROR if the server could not be reached.
+ * @note The command runs in the client's directory, on the client's own
+ * stdin, stdout and stderr, which are passed to the server.
+ */
+int	main(int argc, char **argv)
+{
+	t_client	cl;
+	int			sock;
+	int			status;
+
+	if (client_args(&cl, argc, argv) == -1)
+		return (SYNTAX_ERROR);
+	signal(SIGPIPE, SIG_IGN);
+	status = SRV_CLIENT_ERROR;
+	sock = -1;
+	if (client_body(&cl, argc, argv) == -1)
+		ft_putstr_fd("minishell_client: bad request\n", STDERR_FILENO);
+	else
+		sock = client_connect(cl.socket);
+	if (sock != -1 && client_send(sock, &cl.body) == -1)
+		perror("minishell_client: send");
+	else if (sock != -1)
+		status = client_reply(&cl, sock);
+	if (sock != -1)
+		close(sock);
+	sb_free(&cl.body);
+	return (status);
+}
+
+/**
+ * @brief Parses the options of `minishell_client`.
+ * @param cl Client state to fill.
+ * @param argc Argument count.
+ * @param argv Arguments.
+ * @return 0 on success, -1 (with the usage printed) otherwise.
+ */
+int	client_args(t_client *cl, int argc, char **argv)
+{
+	int	i;
+
+	ft_bzero(cl, sizeof(t_client));
+	cl->socket = "";
+	i = 1;
+	while (i < argc && argv[i][0] == '-')
+	{
+		if (ft_strncmp(argv[i], "-v", 3) == 0)
+			cl->verbose = 1;
+		else if (ft_strncmp(argv[i], "-e", 3) == 0 && i + 1 < argc)
+			i++;
+		else
+			break ;
+		i++;
+	}
+	if (i + 2 > argc || argv[i][0] == '-')
+	{
+		ft_putstr_fd("usage: minishell_client [-v] [-e NAME=VALUE]... "
+			"SOCKET COMMAND...\n", STDERR_FILENO);
+		return (-1);
+	}
+	cl->first = i;
+	cl->socket = argv[i];
+	return (0);
+}
+
+/**
+ * @brief Builds the request body: directory, command line, overlay.
+ * @param cl Client state, after client_args.
+ * @param argc Argument count.
+ * @param argv Arguments.
+ * @return 0 on success, -1 on failure.
+ * @note The command words are joined with spaces, as `sh -c "$*"`
+ * would see them, and parsed by the server.
+ */
+int	client_body(t_client *cl, int argc, char **argv)
+{
+	char	*cwd;
+	int		i;
+
+	cwd = getcwd(NULL, 0);
+	if (!cwd)
+		return (-1);
+	sb_append(&cl->body, cwd, ft_strlen(cwd) + 1);
+	free(cwd);
+	i = cl->first + 1;
+	while (i < argc)
+	{
+		sb_append(&cl->body, argv[i], ft_strlen(argv[i]));
+		sb_putc(&cl->body, ' ');
+		i++;
+	}
+	if (!cl->body.failed)
+		cl->body.data[cl->body.len - 1] = '\0';
+	i = 1;
+	while (!cl->body.failed && i < cl->first)
+	{
+		if (ft_strncmp(argv[i++], "-e", 3) == 0)
+			sb_append(&cl->body, argv[i], ft_strlen(argv[i]) + 1);
+	}
+	return (-(cl->body.failed || cl->body.len > SRV_MAX_BODY));
+}
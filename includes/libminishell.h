@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   libminishell.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:57:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LIBMINISHELL_H
+# define LIBMINISHELL_H
+
+/**
+ * @file libminishell.h
+ * @brief Embedding interface of minishell (libminishell.a, linked with
+ * libft.a and -ldl).
+ * @note Every shell lives in its own t_shell_ctx: environment, `$?`,
+ * functions, positional parameters, caches and history. Distinct
+ * contexts may be used from different threads at the same time, each by
+ * one thread at a time. The working directory, signal dispositions and
+ * standard descriptors stay process-wide, so `cd` and `exec` affect the
+ * whole process.
+ */
+typedef struct s_shell_ctx	t_shell_ctx;
+struct s_node;
+
+/**
+ * @file shell_ctx.c
+ * @brief Contains the creation and release of shell contexts.
+ */
+// SHELL CTX
+t_shell_ctx		*shell_ctx_new(char **envp);
+void			shell_ctx_free(t_shell_ctx *ctx);
+
+/**
+ * @file shell_api.c
+ * @brief Contains the parse, expand and execute entry points.
+ */
+// SHELL API
+struct s_node	*shell_parse(t_shell_ctx *ctx, const char *text, int *status);
+char			**shell_expand(t_shell_ctx *ctx, const char *words);
+int				shell_exec(t_shell_ctx *ctx, struct s_node *tree);
+int				shell_run(t_shell_ctx *ctx, const char *text);
+
+/**
+ * @file shell_api_state.c
+ * @brief Contains the accessors of a context's state.
+ */
+// SHELL API STATE
+void			shell_tree_free(struct s_node *tree);
+int				shell_status(t_shell_ctx *ctx);
+int				shell_exited(t_shell_ctx *ctx);
+const char		*shell_getenv(t_shell_ctx *ctx, const char *name);
+int				shell_setenv(t_shell_ctx *ctx, const char *name,
+					const char *value);
+
+#endif
@@ -6,14 +6,17 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/03 18:15:03 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/13 15:24:36 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 18:06:02 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef MINISHELL_H
 # define MINISHELL_H
 
+# define _GNU_SOURCE
+
 # include "../libft/libft.h"
+# include "libminishell.h"
 
 # include <stdio.h>
 # include <stdlib.h>
@@ -22,17 +25,89 @@
 # include <sys/types.h>
 # include <sys/wait.h>
 # include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
 # include <errno.h>
 # include <signal.h>
-# include <readline/readline.h>
-# include <readline/history.h>
+# include <dlfcn.h>
 # include <dirent.h>
+# include <poll.h>
+# include <sys/syscall.h>
+# include <sys/epoll.h>
+# include <sys/signalfd.h>
+# include <sys/file.h>
+# include <sys/socket.h>
+# include <sys/un.h>
+# include <sys/resource.h>
 # include <limits.h>
+# include <stdint.h>
+# include <spawn.h>
+# include <time.h>
 
 # define CMD_NOT_FOUND 127
 # define PERM_DENIED 126
 # define SYNTAX_ERROR 2
 # define EXIT_CODE_EXIT 4242
+# define STAT_CACHE_SIZE 8
+# define SB_MIN_CAP 64
+# define PF_MAX_WIDTH 1000000
+# define PF_NUM_BUF 32
+# define READ_BLOCK_SIZE 4096
+# define SB_READ_CHUNK 65536
+# define PROCSUB_MAX 16
+# define ARITH_NAME_MAX 256
+# define ARITH_MAX_DEPTH 64
+# define SCRIPT_SYNTAX 1
+# define SCRIPT_INCOMPLETE 2
+# define SCRIPT_QUIET 1
+# define SCRIPT_FILE 2
+# define EXPAND_PLAIN 0
+# define EXPAND_WORD 1
+# define EXPAND_DQUOTE 2
+# define FUNC_MAX_DEPTH 1000
+# define STRVEC_MIN_CAP 16
+# define DIRSCAN_BUF_SIZE 32768
+# define FDPLAN_MAX 32
+# define FDPLAN_MIN_FD 10
+# define FD_INHERIT_MAX 64
+# define EVLOOP_MAX_EVENTS 16
+# define EVLOOP_MAX_WATCH 64
+# define EV_TAG_SIGNAL 0
+# define EV_TAG_STDIN 1
+# define EV_TAG_ZYGOTE 2
+# define EV_TAG_CHILD 3
+# define RL_LIBRARY "libreadline.so.8"
+# define RL_LIBRARY_DEV "libreadline.so"
+# define COMPLETE_WORD_BREAKS " \t\n\"'`@$><=;|&{("
+# define COMPLETE_QUOTE_CHARS " \t\n\\\"'`$<>;|&()*?[]{}!#"
+# define CMD_INDEX_MAGIC "MSHIDX1"
+# define CMD_INDEX_ENV "MINISHELL_CMD_INDEX"
+# define CMD_INDEX_MAX_DIRS 9999
+# define CMD_INDEX_SEP '\1'
+# define HIST_DEFAULT_SIZE 1000
+# define HIST_MAX_SIZE 10000000
+# define HIST_FILE_NAME "/.minishell_history"
+# define HIST_MIN_TABLE 64
+# define HIST_INDEX_SLACK 4096
+# define HIST_COMPACT_RATIO 2
+# define SRV_MAGIC 0x4d534831
+# define SRV_MAX_BODY 1048576
+# define SRV_MAX_JOBS 64
+# define SRV_BACKLOG 128
+# define SRV_RECV_TIMEOUT 5
+# define SRV_TAG_LISTEN 0
+# define SRV_TAG_SIGNAL 1
+# define SRV_TAG_JOB 2
+# define SRV_CLIENT_ERROR 255
+# define ZYG_ENV "MINISHELL_ZYGOTE"
+# define ZYG_MAX_LIVE 256
+# define ZYG_MAX_MSG 131072
+# define ZYG_NFDS 4
+# define ZYG_PENDING -2
+# define EV_UNWATCHED -3
+# define EV_REAPED -4
+# define PIPE_STATS_ENV "MINISHELL_PIPE_STATS"
+# define PIPE_PARENT_FDS 6
 
 /**
  * @enum e_token
@@ -47,6 +122,9 @@
  * - `T_REDIR_IN`: A redirection input ('<') token.
  * - `T_APPEND`: An append ('>>') token.
  * - `T_HEREDOC`: A heredoc ('<<') token.
+ * - `T_HERESTRING`: A here-string ('<<<') token.
+ * - `T_DUP_OUT`: An output duplication ('>&') token.
+ * - `T_DUP_IN`: An input duplication ('<&') token.
  * - `T_EOF`: End-of-file token.
  * - `T_SEMICOLON`: A semicolon (';') token.
  */
@@ -61,9 +139,53 @@ typedef enum e_token
 	T_APPEND,
 	T_HEREDOC,
 	T_EOF,
-	T_SEMICOLON
+	T_SEMICOLON,
+	T_HERESTRING,
+	T_DUP_OUT,
+	T_DUP_IN
 }	t_token;
 
+/**
+ * @enum e_glob_type
+ * @brief Kinds of tokens in a compiled shell pattern.
+ */
+typedef enum e_glob_type
+{
+	GLOB_LIT,
+	GLOB_ANY,
+	GLOB_STAR,
+	GLOB_CLASS
+}	t_glob_type;
+
+/**
+ * @enum e_node_type
+ * @brief Kinds of nodes in a parsed script.
+ *
+ * @note
+ * - `N_PIPELINE`: A pipeline of simple commands, kept as raw text.
+ * - `N_PIPE`: A pipeline with compound stages, listed in `body`.
+ * - `N_AND`, `N_OR`: `cond && body`, `cond || body`.
+ * - `N_IF`, `N_WHILE`, `N_UNTIL`, `N_FOR`, `N_CASE`: Compound commands.
+ * - `N_CASE_ITEM`: One `patterns) list ;;` item of a case.
+ * - `N_GROUP`: A `{ list; }` group, run in the current shell.
+ * - `N_FUNCDEF`: A `name() compound-command` function definition.
+ */
+typedef enum e_node_type
+{
+	N_PIPELINE,
+	N_PIPE,
+	N_AND,
+	N_OR,
+	N_IF,
+	N_WHILE,
+	N_UNTIL,
+	N_FOR,
+	N_CASE,
+	N_CASE_ITEM,
+	N_GROUP,
+	N_FUNCDEF
+}	t_node_type;
+
 /**
  * @struct s_parse
  * @brief Represents the state of the parser during input parsing.
@@ -74,8 +196,11 @@ typedef enum e_token
  * - `curr_char`: Current character being processed.
  * - `token_type`: Type of the current token.
  * - `token_value`: Value of the current token.
+ * - `token_start`: Position where the current token starts.
  * - `redir_fd`: File descriptor for redirection.
  * - `syntax_error`: Flag indicating a syntax error.
+ * - `heredocs`: t_heredoc bodies left for the `<<` of the command (see
+ *   heredoc_take).
  */
 typedef struct s_parse
 {
@@ -84,8 +209,10 @@ typedef struct s_parse
 	char	curr_char;
 	t_token	token_type;
 	char	*token_value;
+	int		token_start;
 	int		redir_fd;
 	int		syntax_error;
+	t_list	*heredocs;
 }	t_parse;
 
 /**
@@ -97,7 +224,11 @@ typedef struct s_parse
  * - `filename`: Filename for the redirection.
  * - `next`: Pointer to the next redirection.
  * - `heredoc_quoted`: Indicates if the heredoc is quoted.
- * - `fd`: File descriptor for the redirection.
+ * - `fd`: Heredoc or here-string descriptor, -1 when none.
+ * - `io_number`: Descriptor redirected (`2` in `2>f`), -1 for the
+ *   default of the operator.
+ * - `body`: Heredoc body read with the script text (not owned), NULL
+ *   when the body is read from the input.
  */
 typedef struct s_redir {
 	t_token			type;
@@ -105,6 +236,8 @@ typedef struct s_redir {
 	struct s_redir	*next;
 	int				heredoc_quoted;
 	int				fd;
+	int				io_number;
+	char			*body;
 }	t_redir;
 
 /**
@@ -115,11 +248,15 @@ typedef struct s_redir {
  * - `args`: Arguments for the command.
  * - `redirections`: Linked list of redirections.
  * - `next`: Pointer to the next command in the pipeline.
+ * - `script`: Compound command run by this stage instead of `args`.
+ * - `plan`: Redirections compiled by the shell before forking the stage.
  */
 typedef struct s_cmd {
 	char			**args;
 	t_redir			*redirections;
 	struct s_cmd	*next;
+	struct s_node	*script;
+	struct s_fdplan	*plan;
 }	t_cmd;
 
 /**
@@ -129,10 +266,13 @@ typedef struct s_cmd {
  * @note
  * - `value`: The value of the argument.
  * - `type`: The type of the argument.
+ * - `raw`: Source text of the argument, quotes included (NULL when the
+ *   argument was not read from a command line).
  */
 typedef struct s_arg {
 	char	*value;
 	t_token	type;
+	char	*raw;
 }	t_arg;
 
 /**
@@ -247,301 +387,2429 @@ typedef struct s_word_state
 
 typedef struct s_heredoc_context
 {
-	int					pipefd[2];
-	struct sigaction	sa;
-	struct sigaction	old_sa;
-	int					was_signaled;
+	int	pipefd[2];
+	int	was_signaled;
 }	t_heredoc_context;
 
-/*
-** Global variable to store the exit status of commands
-** volatile sig_atomic_t ensures safe access in signal handlers
-*/
-extern volatile sig_atomic_t	g_exit_status;
-
 /**
- * @file builtin.c
- * @brief Contains functions related to built-in shell commands.
+ * @typedef t_builtin_fn
+ * @brief Signature shared by every builtin implementation.
  */
-// BUILTIN
-int			is_builtin(char **tokens);
-int			exec_builtin(char **args);
-char		**ft_copy_env(char **original);
-void		update_env_var(char *var, char *value);
-void		ensure_var_exported(char *var_name);
+typedef int	(*t_builtin_fn)(char **args);
 
 /**
- * @file exec_cd.c
- * @brief Contains functions for handling the `cd` built-in command.
+ * @struct s_builtin
+ * @brief Associates a builtin name with its implementation.
+ *
+ * @note
+ * - `name`: Command name as typed by the user.
+ * - `fn`: Function implementing the builtin.
  */
-// EXEC CD
-int			exec_cd(char **args);
-char		*resolve_cd_path(char **args, char *oldpwd);
-int			handle_cd_arguments(char **args, char *oldpwd);
+typedef struct s_builtin
+{
+	const char		*name;
+	t_builtin_fn	fn;
+}	t_builtin;
 
 /**
- * @file exec_echo.c
- * @brief Contains functions for handling the `echo` built-in command.
+ * @struct s_stat_entry
+ * @brief A memoized stat() result.
+ *
+ * @note
+ * - `path`: Path that was queried (NULL if the slot is free).
+ * - `st`: Result of the stat() call.
+ * - `err`: errno of a failed call, 0 on success.
  */
-// EXEC ECHO
-int			exec_echo(char **args);
+typedef struct s_stat_entry
+{
+	char		*path;
+	struct stat	st;
+	int			err;
+}	t_stat_entry;
 
 /**
- * @file exec_env.c
- * @brief Contains functions for handling the `env` built-in command.
+ * @struct s_stat_cache
+ * @brief Small round-robin cache of stat() results for file tests.
+ *
+ * @note
+ * - `entries`: Cached results.
+ * - `next`: Slot to evict on the next miss.
  */
-// EXEC ENV
-int			exec_env(char **args);
+typedef struct s_stat_cache
+{
+	t_stat_entry	entries[STAT_CACHE_SIZE];
+	int				next;
+}	t_stat_cache;
 
 /**
- * @file exec_exit.c
- * @brief Contains functions for handling the `exit` built-in command.
+ * @struct s_test
+ * @brief State of the `test` / `[` expression evaluator.
+ *
+ * @note
+ * - `argv`: Command arguments.
+ * - `argc`: Number of arguments to evaluate (without the closing `]`).
+ * - `pos`: Index of the next argument to consume.
+ * - `error`: Set once a syntax or operand error was reported.
  */
-// EXEC EXIT
-int			exec_exit(char **args);
+typedef struct s_test
+{
+	char	**argv;
+	int		argc;
+	int		pos;
+	int		error;
+}	t_test;
 
 /**
- * @file exec_export.c
- * @brief Contains functions for handling the `export` built-in command.
+ * @struct s_strbuf
+ * @brief Growable byte buffer, always kept NUL-terminated.
+ *
+ * @note
+ * - `data`: Buffer contents (NULL until the first append).
+ * - `len`: Number of bytes used.
+ * - `cap`: Allocated size.
+ * - `failed`: Set after an allocation failure; further appends are no-ops.
  */
-// EXEC EXPORT
-int			exec_export(char **args);
-int			handle_invalid_identifier(char *var_name, char *value,
-				t_export_params params);
-int			handle_export_argument(char *arg, int *i, int *ret);
+typedef struct s_strbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+	int		failed;
+}	t_strbuf;
 
 /**
- * @file exec_pwd.c
- * @brief Contains functions for handling the `pwd` built-in command.
+ * @struct s_strvec
+ * @brief Growable array of owned strings, always kept NULL-terminated.
+ *
+ * @note
+ * - `items`: The strings (NULL until the first push).
+ * - `len`: Number of strings.
+ * - `cap`: Allocated slots, including the terminator.
+ * - `failed`: Set after an allocation failure; further pushes are no-ops.
  */
-// EXEC PWD
-int			exec_pwd(char **args);
+typedef struct s_strvec
+{
+	char	**items;
+	size_t	len;
+	size_t	cap;
+	int		failed;
+}	t_strvec;
 
 /**
- * @file exec_unset.c
- * @brief Contains functions for handling the `unset` built-in command.
+ * @struct s_dirent64
+ * @brief Directory entry as returned by the getdents64 system call.
+ *
+ * @note
+ * - `reclen`: Size of this record; the next one follows it.
+ * - `type`: DT_DIR, DT_REG, ..., or DT_UNKNOWN.
+ * - `name`: NUL-terminated entry name.
  */
-// EXEC UNSET
-int			handle_unset_error(char *arg);
-void		shift_environment(char **env_ptr);
-char		**find_and_free_env_var(const char *var_name, char **env_ptr);
-void		remove_env_var(const char *var_name);
-int			exec_unset(char **args);
+typedef struct s_dirent64
+{
+	unsigned long long	ino;
+	long long			off;
+	unsigned short		reclen;
+	unsigned char		type;
+	char				name[];
+}	t_dirent64;
 
 /**
- * @file create_heredoc.c
- * @brief Contains functions for handling heredoc creation.
+ * @struct s_dirscan
+ * @brief State of a directory scan.
+ *
+ * @note
+ * - `buf`: Batch of entries, `len` bytes long, read up to `pos`.
  */
-// CREATE HEREDOC
-int			setup_and_restore_signals(struct sigaction *sa,
-				struct sigaction *old_sa);
-pid_t		setup_pipe_and_fork(int pipefd[2], struct sigaction *old_sa);
-void		setup_child_process(int write_fd, const char *delimiter);
-int			create_heredoc(const char *delimiter);
+typedef struct s_dirscan
+{
+	int		fd;
+	char	*buf;
+	long	len;
+	long	pos;
+}	t_dirscan;
 
 /**
- * @file execute_pipe.c
- * @brief Contains functions for handling pipeline execution.
+ * @struct s_pfspec
+ * @brief A parsed printf conversion specification.
+ *
+ * @note
+ * - `minus`, `zero`, `plus`, `space`: Flags.
+ * - `width`: Minimum field width.
+ * - `prec`: Precision, -1 if absent.
+ * - `conv`: Conversion character.
  */
-// EXECUTE PIPE
-void		execute_child_process(int prev_pipe[2],
-				int next_pipe[2], t_cmd *current);
-int			fork_and_execute(int *pipes[2], t_cmd *current,
-				pid_t *child_pids, int *i);
-int			process_pipeline_command(t_pipeline_context *ctx, int *pipes[2]);
-int			process_all_pipeline_commands(t_pipeline_context *ctx,
-				int *pipes[2], struct sigaction *old_sa);
-int			execute_pipeline(t_cmd *pipeline);
+typedef struct s_pfspec
+{
+	int		minus;
+	int		zero;
+	int		plus;
+	int		space;
+	int		width;
+	int		prec;
+	char	conv;
+}	t_pfspec;
 
 /**
- * @file exit_status.c
- * @brief Contains functions for managing the shell's exit status.
+ * @struct s_printf
+ * @brief State of one `printf` builtin invocation.
+ *
+ * @note
+ * - `args`: Command arguments.
+ * - `argi`: Index of the next argument to consume.
+ * - `out`: Output buffer, written once at the end.
+ * - `status`: Exit status accumulated so far.
+ * - `stop`: Set by `\c` or a fatal format error.
+ * - `consumed`: Whether the current pass used any argument.
  */
-// EXIT STATUS
-void		set_exit_status(int status);
-int			get_exit_status(void);
+typedef struct s_printf
+{
+	char		**args;
+	int			argi;
+	t_strbuf	out;
+	int			status;
+	int			stop;
+	int			consumed;
+}	t_printf;
 
 /**
- * @file get_cmd_path.c
- * @brief Contains functions for resolving command paths.
+ * @struct s_read
+ * @brief State of one `read` builtin invocation.
+ *
+ * @note
+ * - `raw`: Set by -r; backslashes are not special.
+ * - `delim`: Line delimiter (-d), newline by default.
+ * - `escaped`: The previous byte was an unquoted backslash.
+ * - `line`: Bytes collected so far.
  */
-// GET CMD PATH
-char		*check_path_for_cmd(const char *dir_path, const char *cmd);
-char		**get_path_directories(void);
-char		*check_direct_path(char *cmd);
-char		*get_cmd_path(char *cmd);
-void		execute_command(t_cmd *cmd, int pipe_in, int pipe_out);
+typedef struct s_read
+{
+	int			raw;
+	char		delim;
+	int			escaped;
+	t_strbuf	line;
+}	t_read;
 
 /**
- * @file handle_commands.c
- * @brief Contains functions for handling command execution.
+ * @struct s_arith
+ * @brief State of one arithmetic expansion `$((...))`.
+ *
+ * @note
+ * - `s`: Current position in the expression.
+ * - `end`: End of the expression (it is not NUL-terminated).
+ * - `expr`: Start of the expression, used in error messages.
+ * - `noeval`: Non-zero while parsing a branch whose effects are skipped
+ *   (short-circuited `&&`/`||`, unused side of `?:`).
+ * - `error`: Set once an error has been reported.
+ * - `depth`: Nesting of variables whose values are expressions.
  */
-// HANDLE COMMANDS
-void		execute_non_builtin(t_cmd *cmd, char **environ);
-void		handle_child_exit(pid_t pid, struct sigaction *old_sa);
-void		setup_and_execute_child(t_cmd *cmd, int pipe_in, int pipe_out);
-void		handle_builtin_in_parent(t_cmd *pipeline);
-int			handle_command_pipeline(char *command, int *should_exit);
-
-// HANDLE HEREDOC
-void		write_line_to_pipe(int write_fd, const char *line,
-				int quoted_delimiter);
-int			is_quoted_delimiter(const char *delimiter);
-void		handle_child_process(int write_fd, const char *delimiter);
-int			handle_parent_process(pid_t pid, int read_fd, int *was_signaled);
+typedef struct s_arith
+{
+	const char	*s;
+	const char	*end;
+	const char	*expr;
+	int			noeval;
+	int			error;
+	int			depth;
+}	t_arith;
 
 /**
- * @file handle_parse_args.c
- * @brief Contains functions for parsing command arguments.
+ * @struct s_glob_tok
+ * @brief One token of a compiled pattern.
+ *
+ * @note
+ * - `c`: Character for GLOB_LIT.
+ * - `set`: Bitmap of the characters of a GLOB_CLASS.
+ * - `negate`: The class was written `[!...]`.
  */
-// HANDLE PARSE ARGS
-t_redir		*handle_redir_error(t_parse *p, t_list **args, t_redir *redirs);
-int			handle_argument_token(t_parse *p, t_list **args, t_redir *redirs);
-int			handle_redirection_token(t_parse *p, t_list **args,
-				t_redir **redir_tail, t_redir *redirs);
-t_cmd		*handle_syntax_error(t_parse *p, t_list *args, t_redir *redirs,
-				char *error_message);
+typedef struct s_glob_tok
+{
+	t_glob_type		type;
+	unsigned char	c;
+	int				negate;
+	unsigned char	set[32];
+}	t_glob_tok;
 
 /**
- * @file handle_parse.c
- * @brief Contains functions for parsing input.
+ * @struct s_glob
+ * @brief Compiled shell pattern (`*`, `?`, `[...]`).
  */
-// HANDLE PARSE
-void		handle_unmatched_quote(t_parse *p);
-void		handle_quotes(t_parse *p, char quote);
-char		*handle_quoted_segment(t_parse *p,
-				char *value, t_quote_state *quote_state);
-char		*handle_end_of_quote(t_parse *p, char *value,
-				size_t *segment_start, int *in_quote);
-char		*handle_unquoted_segment(t_parse *p, char *value,
-				size_t *segment_start);
+typedef struct s_glob
+{
+	t_glob_tok	*toks;
+	size_t		n;
+}	t_glob;
 
 /**
- * @file handle_pipe.c
- * @brief Contains functions for managing pipes in command execution.
+ * @struct s_pathglob
+ * @brief A pathname pattern split into compiled components.
+ *
+ * @note
+ * - `comps`: Components between slashes.
+ * - `globs`: Compiled components (`toks` is NULL for literal ones).
+ * - `n`: Number of components.
+ * - `dirs_only`: The pattern ends with '/', so only directories match.
+ * - `out`: Vector receiving the matches.
  */
-// HANDLE PIPE
-int			wait_for_children(pid_t *child_pids, int cmd_count,
-				int *was_signaled);
-void		close_and_update_pipes(int prev_pipe[2], int next_pipe[2]);
-void		close_remaining_pipes(int prev_pipe[2]);
-int			handle_heredoc_redirections(t_redir *redirections);
-void		handle_last_command(t_cmd *pipeline, int last_status,
-				pid_t *child_pids);
+typedef struct s_pathglob
+{
+	char		**comps;
+	t_glob		*globs;
+	size_t		n;
+	int			dirs_only;
+	t_strvec	*out;
+}	t_pathglob;
 
 /**
- * @file handle_redirect.c
- * @brief Contains functions for managing redirections.
+ * @struct s_param
+ * @brief Parsed `${...}` parameter expansion.
+ *
+ * @note
+ * - `name`: Parameter name ("?" for the exit status).
+ * - `op`: Operator (`:-`, `#`, `%%`, `//`, ...), empty for `${name}`.
+ * - `word`: Unexpanded text after the operator (points into the body).
+ * - `value`: Copy of the value, NULL when the parameter is unset.
+ * - `length`: Set for `${#name}`.
  */
-// HANDLE REDIRECT
-int			open_redirection_fd(t_redir *redir);
-int			duplicate_fd(int fd, int target);
-int			handle_file_redirections(t_redir *redirections);
-int			handle_single_redirection(t_redir *redir);
-int			handle_redirections(int pipe_in,
-				int pipe_out, t_redir *redirections);
+typedef struct s_param
+{
+	char		*name;
+	char		op[3];
+	const char	*word;
+	char		*value;
+	int			length;
+}	t_param;
 
 /**
- * @file handle_special.c
- * @brief Contains functions for handling special tokens and cases.
+ * @struct s_procsub
+ * @brief A running `<(...)` or `>(...)` substitution.
+ *
+ * @note
+ * - `fd`: The shell's end of the pipe, passed as /dev/fd/N.
+ * - `pid`: Child running the substituted command.
+ * - `owner`: Pipeline stage using the path (NULL until claimed).
  */
-// HANDLE SPECIAL
-void		assign_value(t_parse *p, enum e_token t, char *v, int n);
-void		handle_file_descriptor(t_parse *p);
-void		handle_output_redirection(t_parse *p);
-void		handle_input_redirection(t_parse *p);
-void		handle_special(t_parse *p);
+typedef struct s_procsub
+{
+	int		fd;
+	pid_t	pid;
+	t_cmd	*owner;
+}	t_procsub;
 
 /**
- * @file init.c
- * @brief Contains functions for initializing shell components.
+ * @struct s_procsub_table
+ * @brief Process substitutions of the pipeline being run.
  */
-// INIT
-void		init_parser(t_parse *p, char *input);
-void		init_word_and_quote_states(t_parse *p,
-				t_word_state *word_state, t_quote_state *quote_state);
-int			initialize_pipeline_resources(t_cmd *pipeline, int prev_pipe[2],
-				int next_pipe[2], pid_t **child_pids);
-int			initialize_pipeline(t_cmd *pipeline,
-				t_pipeline_context *ctx, struct sigaction *old_sa);
+typedef struct s_procsub_table
+{
+	t_procsub	entries[PROCSUB_MAX];
+	int			count;
+}	t_procsub_table;
 
 /**
- * @file input.c
- * @brief Contains functions for handling user input and variable expansion.
+ * @struct s_fd_inherit
+ * @brief Descriptors from FDPLAN_MIN_FD up the shell was started with.
  */
-// INPUT
-char		*expand_variable(const char *input, size_t *i);
-char		*expand_and_append_variable(const char *input,
-				size_t *i, char *result);
-char		*expand_variables(const char *input);
-void		exec_external_command(t_cmd *cmd);
-int			handle_redirection(t_redir *current, int fd);
+typedef struct s_fd_inherit
+{
+	int	fds[FD_INHERIT_MAX];
+	int	count;
+}	t_fd_inherit;
 
 /**
- * @file main.c
- * @brief Contains the main entry point and core logic for the shell.
+ * @struct s_fdop
+ * @brief One step of a redirection plan.
+ *
+ * @note
+ * - `src`: Descriptor copied onto `dst`, -1 to close `dst`.
+ * - `dst`: Descriptor changed, -1 once a later step made this one moot.
+ * - `owned`: Whether `src` was opened for the plan and is closed by it.
+ * - `saved`: Copy of `dst` taken before the step (-1: `dst` was closed,
+ *   -2: not saved).
  */
-// MAIN
-t_cmd		*parse_and_validate_pipeline(char *command, t_parse *parser);
-void		free_pipeline(t_cmd *pipeline);
-void		execute_command(t_cmd *cmd, int pipe_in, int pipe_out);
-int			process_commands(char **commands, int *should_exit);
-int			handle_shell_loop(char **env_copy,
-				char **original_environ, int *exit_status);
+typedef struct s_fdop
+{
+	int	src;
+	int	dst;
+	int	owned;
+	int	saved;
+}	t_fdop;
 
 /**
- * @file parse_args.c
- * @brief Contains functions for parsing command arguments.
+ * @struct s_fdplan
+ * @brief Redirections of a command compiled to dup2/close steps.
+ *
+ * @note
+ * - `base`: Lowest descriptor used for opened files and saved copies,
+ *   above every descriptor the steps name.
+ * - `done`: Steps applied so far, undone by fdplan_restore.
+ * - `failed`: The plan could not be built; the stage only exits 1.
+ * - `mapped`: The steps went to the builtin descriptor map instead.
  */
-// PARSE ARGS
-void		process_argument(t_parse *p, t_list **args);
-t_redir		*process_redirection(t_parse *p, t_list **args, t_redir *redirs);
-t_cmd		*create_command(t_list *args, t_redir *redirs);
-int			process_tokens(t_parse *p, t_token_state *state);
-t_cmd		*parse_args(t_parse *p);
+typedef struct s_fdplan
+{
+	t_fdop	ops[FDPLAN_MAX];
+	int		n;
+	int		base;
+	int		done;
+	int		failed;
+	int		mapped;
+}	t_fdplan;
 
 /**
- * @file parse_pipeline.c
- * @brief Contains functions for parsing pipelines.
+ * @struct s_arith_op
+ * @brief Binary arithmetic operator: spelling, code and precedence.
  */
-// PARSE PIPELINE
-int			is_pipe_or_semicolon(t_parse *p);
-int			handle_cmd_result(t_parse *p, t_cmd **head,
-				t_cmd *cmd, t_cmd ***curr);
-int			check_pipe_error(t_parse *p, t_cmd *head);
-int			check_final_error(t_parse *p, t_cmd *head);
-t_cmd		*parse_pipeline(t_parse *p);
+typedef struct s_arith_op
+{
+	const char	*text;
+	char		code;
+	int			prec;
+}	t_arith_op;
 
 /**
- * @file parsers.c
- * @brief Contains utility functions for parsing input.
+ * @struct s_node
+ * @brief Node of a parsed script.
+ *
+ * @note
+ * - `text`: Pipeline text, for variable name, case word or function name.
+ * - `words`: Raw for list, case item patterns or function body.
+ * - `cond`: Condition list, or left side of `&&`/`||`.
+ * - `body`: Branch or loop body, or right side of `&&`/`||`.
+ * - `alt`: Else branch, first case item, or next case item.
+ * - `redirs`: Raw redirections following a compound command.
+ * - `heredocs`: t_heredoc bodies of the `<<` in `text` or `redirs`.
+ * - `next`: Next command of the list.
+ * Leaves keep their text so that every run re-expands it: the regular
+ * parser turns it into a t_cmd pipeline just before execution.
  */
-// PARSERS
-int			advance_to_closing_quote(t_parse *p, char quote);
-char		*add_segment(char *value, const char *input, size_t start,
-				size_t end);
-char		*process_quoted_segment(t_parse *p,
-				char *value, t_quote_state *quote_state);
-void		next_token(t_parse *p);
-void		handle_word(t_parse *p);
-char		**build_expanded_args(t_list *args);
-
-// PIPE SIGNALS
-int			setup_signal_handling(struct sigaction *sa,
-				struct sigaction *old_sa);
-int			manage_signal_handling(struct sigaction *old_sa, int was_signaled);
-int			create_pipe(int next_pipe[2], pid_t *child_pids);
+typedef struct s_node
+{
+	t_node_type		type;
+	char			*text;
+	char			*words;
+	struct s_node	*cond;
+	struct s_node	*body;
+	struct s_node	*alt;
+	char			*redirs;
+	t_list			*heredocs;
+	struct s_node	*next;
+}	t_node;
 
 /**
- * @file signals.c
- * @brief Contains functions for handling signals.
- */
+ * @struct s_heredoc
+ * @brief Heredoc whose body is part of the script text.
+ *
+ * @note
+ * - `delim`: Delimiter line, quotes removed.
+ * - `quoted`: The delimiter was quoted, so the body is not expanded.
+ * - `body`: Lines up to the delimiter, NULL while the line holding the
+ *   `<<` has not ended (the body is then read from the input).
+ */
+typedef struct s_heredoc
+{
+	char	*delim;
+	int		quoted;
+	char	*body;
+}	t_heredoc;
+
+/**
+ * @struct s_script
+ * @brief State of the script parser.
+ *
+ * @note
+ * - `error`: 0, SCRIPT_SYNTAX or SCRIPT_INCOMPLETE.
+ * - `quiet`: Do not print syntax errors (used to probe for more input).
+ * - `file`: The text is a whole file, so a heredoc still open at its end
+ *   ends with it instead of reading the shell's input.
+ * - `heredocs`: Heredocs of the command being scanned.
+ * - `pending`: Heredocs whose body starts after the next newline (the
+ *   t_heredoc belong to their nodes).
+ */
+typedef struct s_script
+{
+	const char	*src;
+	size_t		pos;
+	int			error;
+	int			quiet;
+	int			file;
+	t_list		*heredocs;
+	t_list		*pending;
+}	t_script;
+
+/**
+ * @struct s_exec_ctl
+ * @brief Loop control shared by the executor and `break`/`continue`.
+ *
+ * @note
+ * - `loop_depth`: Number of loops currently running.
+ * - `func_depth`: Number of function calls currently running.
+ * - `brk`, `cont`: Pending `break n` / `continue n` levels.
+ * - `ret`: Set by `return` until the function call unwinds.
+ * - `abort`: Reason (SYNTAX_ERROR or 130) to drop the rest of the input.
+ * - `sigint`: The shell itself got Ctrl+C while the last pipeline ran
+ *   (see child_status).
+ * - `last_line`: The shell exits once the current script is done.
+ * - `tail`: The pipeline about to run is the last thing the shell does.
+ * - `keep_fds`: Set by `exec` to make its redirections permanent.
+ * - `exited`: `exit` ran in the shell itself; everything unwinds and
+ *   nothing runs afterwards.
+ * - `heredocs`: Heredoc bodies of the script node about to be parsed
+ *   (see parse_and_validate_pipeline).
+ */
+typedef struct s_exec_ctl
+{
+	int		loop_depth;
+	int		func_depth;
+	int		brk;
+	int		cont;
+	int		ret;
+	int		abort;
+	int		sigint;
+	int		last_line;
+	int		tail;
+	int		keep_fds;
+	int		exited;
+	t_list	*heredocs;
+}	t_exec_ctl;
+
+/**
+ * @struct s_reap
+ * @brief A set of children being waited for (see evloop_reap).
+ *
+ * @note
+ * - `pids`: Children.
+ * - `status`: Wait status of each, once reaped.
+ * - `fds`: pidfd of each watched child, or EV_UNWATCHED, -1 (cannot be
+ *   watched), ZYG_PENDING (started by the zygote) or EV_REAPED.
+ * - `n`: Number of children.
+ */
+typedef struct s_reap
+{
+	pid_t	*pids;
+	int		*status;
+	int		*fds;
+	int		n;
+}	t_reap;
+
+/**
+ * @struct s_evloop
+ * @brief Event loop the shell waits in, for input as well as children.
+ *
+ * @note
+ * - `epfd`: epoll instance (-1 until first needed).
+ * - `sigfd`: signalfd reading the blocked SIGINT, SIGQUIT and SIGCHLD
+ *   (-1 in forked children, where those signals are unblocked again).
+ * - `interactive`: Standard input was a terminal at startup.
+ * - `line`: Line handed over by readline's callback.
+ * - `line_done`: The callback ran (`line` is NULL on end of input).
+ * - `watching`: pidfds open for the children being waited for.
+ */
+typedef struct s_evloop
+{
+	int		epfd;
+	int		sigfd;
+	int		interactive;
+	char	*line;
+	int		line_done;
+	int		watching;
+}	t_evloop;
+
+/**
+ * @struct s_rl_api
+ * @brief readline entry points, resolved with dlsym on an interactive run.
+ *
+ * @note
+ * - `handle`: dlopen handle, NULL when readline is not loaded.
+ * - `tty`: Standard input was a terminal at startup (prompts are shown).
+ * - The other members are the readline functions of the same name, then
+ *   pointers to the readline variables used by completion and history
+ *   navigation (see rl_front_bind).
+ */
+typedef struct s_rl_api
+{
+	void	*handle;
+	int		tty;
+	char	*(*readline)(const char *);
+	void	(*handler_install)(const char *, void (*)(char *));
+	void	(*read_char)(void);
+	void	(*handler_remove)(void);
+	void	(*sigcleanup)(void);
+	void	(*replace_line)(const char *, int);
+	int		(*on_new_line)(void);
+	void	(*redisplay)(void);
+	void	(*echo_signal_char)(int);
+	int		(*crlf)(void);
+	int		(*ding)(void);
+	int		(*bind_keyseq)(const char *, int (*)(int, int));
+	char	**(**attempted)(const char *, int, int);
+	char	**line_buffer;
+	int		*completion_over;
+	int		*suppress_append;
+	int		*point;
+	int		*end;
+	int		(**char_quoted)(char *, int);
+	char	**quote_chars;
+	char	**word_breaks;
+}	t_rl_api;
+
+/**
+ * @struct s_trie
+ * @brief Node of a compressed trie (radix tree) of names.
+ *
+ * @note
+ * - `edge`: Label of the edge leading to this node, `len` bytes long.
+ * - `term`: A name ends at this node.
+ * - `child`: First child; siblings are sorted by the first byte of their
+ *   edge, so a walk lists names in byte order.
+ * - `next`: Next sibling.
+ */
+typedef struct s_trie
+{
+	char			*edge;
+	size_t			len;
+	int				term;
+	struct s_trie	*child;
+	struct s_trie	*next;
+}	t_trie;
+
+/**
+ * @struct s_complete
+ * @brief Caches behind tab completion.
+ *
+ * @note
+ * - `commands`: Trie of builtins and executables found along PATH.
+ * - `path`: PATH value the trie was built from.
+ * - `stamps`: Modification time of each PATH directory (`ndirs` of them)
+ *   when it was scanned; a change rebuilds the trie.
+ * - `dir`: Directory last listed for path completion.
+ * - `dir_stamp`: Its modification time at that point.
+ * - `files`: Its entries, directories with a trailing '/'.
+ */
+typedef struct s_complete
+{
+	t_trie			*commands;
+	char			*path;
+	struct timespec	*stamps;
+	size_t			ndirs;
+	char			*dir;
+	struct timespec	dir_stamp;
+	t_strvec		files;
+}	t_complete;
+
+/**
+ * @struct s_idx_head
+ * @brief Header of an on-disk command index.
+ *
+ * @note
+ * - `magic`: CMD_INDEX_MAGIC, NUL included.
+ * - `ndirs`: Number of PATH directories, whose modification times follow
+ *   the header.
+ * - `count`: Number of t_idx_entry records after the times.
+ * - `pool_len`: Length of the string pool closing the file; it starts
+ *   with the PATH value the index was built from.
+ * - `size`: Total file size, so a truncated file is rejected.
+ */
+typedef struct s_idx_head
+{
+	char		magic[8];
+	uint32_t	ndirs;
+	uint32_t	count;
+	uint64_t	pool_len;
+	uint64_t	size;
+}	t_idx_head;
+
+/**
+ * @struct s_idx_entry
+ * @brief One command of an on-disk index, sorted by name.
+ *
+ * @note
+ * - `name`, `path`: Offsets of the command name and its full path in the
+ *   string pool.
+ */
+typedef struct s_idx_entry
+{
+	uint32_t	name;
+	uint32_t	path;
+}	t_idx_entry;
+
+/**
+ * @struct s_cmd_index
+ * @brief Mapped command index of the shell.
+ *
+ * @note
+ * - `checked`: Set once the mapping is validated for the current input
+ *   line (see cmd_index_expire).
+ * - `path`: PATH value of the last validation.
+ * - `map`, `size`: Read-only mapping of the index file, NULL when there
+ *   is no usable index; forked commands inherit it.
+ * - `entries`, `count`, `pool`, `pool_len`: Views into the mapping.
+ */
+typedef struct s_cmd_index
+{
+	int					checked;
+	char				*path;
+	unsigned char		*map;
+	size_t				size;
+	const t_idx_entry	*entries;
+	size_t				count;
+	const char			*pool;
+	size_t				pool_len;
+}	t_cmd_index;
+
+/**
+ * @struct s_idx_build
+ * @brief State of a command index rebuild.
+ *
+ * @note
+ * - `path`: PATH value, split into `dirs` (`ndirs` of them).
+ * - `stamps`: Modification time of each directory before the scan.
+ * - `names`: Executables found, as "name" CMD_INDEX_SEP "dir number".
+ */
+typedef struct s_idx_build
+{
+	const char		*path;
+	char			**dirs;
+	size_t			ndirs;
+	struct timespec	*stamps;
+	t_strvec		names;
+}	t_idx_build;
+
+/**
+ * @struct s_hist_slot
+ * @brief One slot of the history ring.
+ *
+ * @note
+ * - `line`: Entry text, NULL once erased.
+ * - `seq`: Sequence number of the entry; entry `seq` lives in slot
+ *   `seq % slots`, so an overwritten entry no longer matches its slot.
+ * - `grams`: Postings the entry added to the gram index.
+ */
+typedef struct s_hist_slot
+{
+	char		*line;
+	uint32_t	seq;
+	uint32_t	grams;
+}	t_hist_slot;
+
+/**
+ * @struct s_hist_post
+ * @brief Posting list of one gram (three bytes of text).
+ *
+ * @note
+ * - `gram`: Packed bytes, 0 for an unused table slot.
+ * - `seqs`: Entries containing the gram, oldest first (`len` of `cap`);
+ *   erased entries linger until hist_index_prune.
+ */
+typedef struct s_hist_post
+{
+	uint32_t	gram;
+	uint32_t	len;
+	uint32_t	cap;
+	uint32_t	*seqs;
+}	t_hist_post;
+
+/**
+ * @struct s_history
+ * @brief Command history of an interactive shell.
+ *
+ * @note
+ * - `ring`: `slots` (twice `cap`) slots holding the newest entries;
+ *   `count` of them, at most `cap`, are live.
+ * - `next`: Sequence number of the next entry (numbers start at 1);
+ *   `oldest`: No live entry is older.
+ * - `nav`: Entry shown by history navigation, `next` on the typed line.
+ * - `lines`: Deduplication table of sequence numbers, hashed by line
+ *   (`lines_cap` slots, `lines_used` of them ever filled).
+ * - `grams`: Gram index (`grams_cap` slots, `grams_used` filled);
+ *   `postings` counts all sequence numbers listed, `live` those of live
+ *   entries.
+ * - `draft`: Typed line saved while navigating; `query`: Ctrl-R text.
+ * - `file`, `fd`: History file and its append descriptor (-1 if none).
+ */
+typedef struct s_history
+{
+	t_hist_slot	*ring;
+	size_t		slots;
+	size_t		cap;
+	size_t		count;
+	uint32_t	next;
+	uint32_t	oldest;
+	uint32_t	nav;
+	uint32_t	*lines;
+	size_t		lines_cap;
+	size_t		lines_used;
+	t_hist_post	*grams;
+	size_t		grams_cap;
+	size_t		grams_used;
+	size_t		postings;
+	size_t		live;
+	char		*draft;
+	char		*query;
+	char		*file;
+	int			fd;
+}	t_history;
+
+/**
+ * @struct s_frame
+ * @brief Positional parameters of a function call.
+ *
+ * @note
+ * - `argv`: `$1`, `$2`, ... (borrowed from the call's arguments).
+ * - `argc`: Value of `$#`.
+ * - `prev`: Frame of the caller.
+ */
+typedef struct s_frame
+{
+	char			**argv;
+	int				argc;
+	struct s_frame	*prev;
+}	t_frame;
+
+/**
+ * @struct s_func
+ * @brief A defined shell function.
+ *
+ * @note
+ * - `name`: Function name.
+ * - `body`: Body parsed once at definition time.
+ * - `busy`: Number of calls running the body (kept alive on redefinition).
+ * - `next`: Next function of the table.
+ */
+typedef struct s_func
+{
+	char			*name;
+	t_node			*body;
+	int				busy;
+	struct s_func	*next;
+}	t_func;
+
+/**
+ * @struct s_srv_head
+ * @brief Fixed-size start of a server request.
+ *
+ * @note
+ * - `magic`: SRV_MAGIC.
+ * - `len`: Size of the body that follows: the working directory, the
+ *   command line, then `NAME=value` entries, each NUL-terminated.
+ * The client's stdin, stdout and stderr ride along as SCM_RIGHTS.
+ */
+typedef struct s_srv_head
+{
+	uint32_t	magic;
+	uint32_t	len;
+}	t_srv_head;
+
+/**
+ * @struct s_srv_req
+ * @brief A request read by the server.
+ *
+ * @note
+ * - `head`: Request header.
+ * - `fds`: Client's stdin, stdout and stderr (-1 until received).
+ * - `body`: Request body, `head.len` bytes.
+ */
+typedef struct s_srv_req
+{
+	t_srv_head	head;
+	int			fds[3];
+	char		*body;
+}	t_srv_req;
+
+/**
+ * @struct s_srv_reply
+ * @brief Sent back once the request has run.
+ *
+ * @note
+ * - `status`: Exit status of the command line (128+N if killed).
+ * - `utime_us`, `stime_us`: CPU time, its commands included.
+ * - `maxrss_kb`: Largest resident set of the process or its commands.
+ * - `minflt`, `majflt`: Page faults.
+ */
+typedef struct s_srv_reply
+{
+	int64_t	status;
+	int64_t	utime_us;
+	int64_t	stime_us;
+	int64_t	maxrss_kb;
+	int64_t	minflt;
+	int64_t	majflt;
+}	t_srv_reply;
+
+/**
+ * @struct s_srv_job
+ * @brief A request being run by the server.
+ *
+ * @note
+ * - `pid`: Process running it (0 when the slot is free).
+ * - `pidfd`: Its pidfd, watched by the server's epoll instance.
+ * - `conn`: Connection the reply goes back on.
+ */
+typedef struct s_srv_job
+{
+	pid_t	pid;
+	int		pidfd;
+	int		conn;
+}	t_srv_job;
+
+/**
+ * @struct s_server
+ * @brief State of `minishell --server`.
+ *
+ * @note
+ * - `lfd`: Listening socket (-1 once shutting down).
+ * - `sigfd`: signalfd reading SIGINT and SIGTERM.
+ * - `epfd`: epoll instance: the socket, the signalfd and each pidfd.
+ * - `path`: Socket path, removed on shutdown.
+ * - `running`: Number of busy job slots.
+ * - `jobs`: Job slots.
+ */
+typedef struct s_server
+{
+	int			lfd;
+	int			sigfd;
+	int			epfd;
+	const char	*path;
+	int			running;
+	t_srv_job	jobs[SRV_MAX_JOBS];
+}	t_server;
+
+/**
+ * @struct s_client
+ * @brief Command line of `minishell_client`.
+ *
+ * @note
+ * - `socket`: Server socket path.
+ * - `verbose`: Print the resource usage to stderr (`-v`).
+ * - `first`: Index of the socket argument; options come before it.
+ * - `body`: Request body being built.
+ */
+typedef struct s_client
+{
+	const char	*socket;
+	int			verbose;
+	int			first;
+	t_strbuf	body;
+}	t_client;
+
+/**
+ * @struct s_zyg_head
+ * @brief Start of a launch request sent to the zygote.
+ *
+ * @note
+ * - `argc`, `envc`: Number of arguments and environment entries.
+ * The path, the arguments and the environment follow, NUL-terminated.
+ * stdin, stdout, stderr and the working directory ride along as
+ * SCM_RIGHTS.
+ */
+typedef struct s_zyg_head
+{
+	uint32_t	argc;
+	uint32_t	envc;
+}	t_zyg_head;
+
+/**
+ * @struct s_zyg_msg
+ * @brief Message from the zygote.
+ *
+ * @note
+ * - `pid`: Command started (-1: the zygote could not start it), or the
+ *   command that exited.
+ * - `status`: Wait status, when `exited` is set.
+ * - `exited`: 0 for the reply to a launch, 1 for an exit.
+ */
+typedef struct s_zyg_msg
+{
+	pid_t	pid;
+	int		status;
+	int		exited;
+}	t_zyg_msg;
+
+/**
+ * @struct s_zygote
+ * @brief The shell's side of the zygote (see zygote_start).
+ *
+ * @note
+ * - `fd`: Socket to the zygote (-1 without one).
+ * - `pid`: Zygote process (0 without one).
+ * - `watched`: Whether `fd` is in the event loop's epoll set.
+ * - `live`: Commands started by the zygote and not reaped yet (0: free).
+ * - `status`, `done`: Wait status of each, once the zygote relayed it.
+ */
+typedef struct s_zygote
+{
+	int		fd;
+	pid_t	pid;
+	int		watched;
+	pid_t	live[ZYG_MAX_LIVE];
+	int		status[ZYG_MAX_LIVE];
+	int		done[ZYG_MAX_LIVE];
+}	t_zygote;
+
+/**
+ * @struct s_pipe_stats
+ * @brief Measures of the running pipeline (see pipe_stats_start).
+ *
+ * @note
+ * - `on`: MINISHELL_PIPE_STATS is set and a pipeline is running.
+ * - `stages`: Number of stages.
+ * - `fds_peak`: Most descriptors seen open in the shell.
+ * - `start`, `launched`: When the first stage and the last one started.
+ */
+typedef struct s_pipe_stats
+{
+	int				on;
+	int				stages;
+	int				fds_peak;
+	struct timespec	start;
+	struct timespec	launched;
+}	t_pipe_stats;
+
+/**
+ * @struct s_shell_ctx
+ * @brief One shell: everything it owns (t_shell_ctx, see libminishell.h).
+ *
+ * @note
+ * - `env`: Environment, `name=value` entries (`name` alone when exported
+ *   without a value); children get it through execve.
+ * - `status`: Value of `$?`.
+ * - `ctl`: Loop, function and abort state of the executor.
+ * - `funcs`: Defined functions.
+ * - `root`, `frame`: Positional parameters of the shell itself, and the
+ *   frame of the innermost function call.
+ * - `procsubs`: Process substitutions of the pipeline being run.
+ * - `inherited`: Descriptors commands inherit from the shell's parent.
+ * - `fds`: Descriptor map builtins write through.
+ * - `expand_error`, `subshell`: See raise_expand_error and in_subshell.
+ * - `stats`, `cmd_index`, `complete`, `history`, `ev`: Stat cache,
+ *   command index, completion caches, history and event loop.
+ * - `zygote`: Launch helper of the front-end (see zygote_start).
+ * - `pipe_stats`: Measures of the running pipeline.
+ */
+struct s_shell_ctx
+{
+	char			**env;
+	int				status;
+	t_exec_ctl		ctl;
+	t_func			*funcs;
+	t_frame			root;
+	t_frame			*frame;
+	t_procsub_table	procsubs;
+	t_fd_inherit	inherited;
+	int				fds[3];
+	int				expand_error;
+	int				subshell;
+	t_stat_cache	stats;
+	t_cmd_index		cmd_index;
+	t_complete		complete;
+	t_history		history;
+	t_evloop		ev;
+	t_zygote		zygote;
+	t_pipe_stats	pipe_stats;
+};
+
+/**
+ * @file builtin.c
+ * @brief Contains functions related to built-in shell commands.
+ */
+// BUILTIN
+int			is_builtin(char **tokens);
+int			exec_builtin(char **args);
+char		**ft_copy_env(char **original);
+void		update_env_var(char *var, char *value);
+void		ensure_var_exported(char *var_name);
+
+/**
+ * @file builtin_fds.c
+ * @brief Contains the descriptor map builtins write through.
+ */
+// BUILTIN FDS
+int			*builtin_fds(void);
+int			builtin_fd(int fd);
+void		builtin_perror(const char *prefix);
+int			builtin_redirect_push(t_fdplan *plan, t_cmd *cmd);
+void		builtin_redirect_pop(t_fdplan *plan);
+
+/**
+ * @file builtin_table.c
+ * @brief Contains the table mapping builtin names to implementations.
+ */
+// BUILTIN TABLE
+const t_builtin	*builtin_table(void);
+t_builtin_fn	get_builtin_fn(const char *name);
+
+/**
+ * @file env_store.c
+ * @brief Contains helpers to look up and set environment variables.
+ */
+// ENV STORE
+char		**find_env_entry(const char *name);
+int			set_env_value(const char *name, const char *value);
+char		***get_env(void);
+char		*env_value(const char *name);
+
+/**
+ * @file exec_break.c
+ * @brief Contains the `break` and `continue` builtins and loop state.
+ */
+// EXEC BREAK
+t_exec_ctl	*get_exec_ctl(void);
+int			exec_interrupted(void);
+int			loop_count_arg(char **args);
+int			exec_break(char **args);
+int			exec_continue(char **args);
+
+/**
+ * @file exec_cd.c
+ * @brief Contains functions for handling the `cd` built-in command.
+ */
+// EXEC CD
+int			exec_cd(char **args);
+char		*resolve_cd_path(char **args, char *oldpwd);
+int			handle_cd_arguments(char **args, char *oldpwd);
+
+/**
+ * @file exec_echo.c
+ * @brief Contains functions for handling the `echo` built-in command.
+ */
+// EXEC ECHO
+int			exec_echo(char **args);
+
+/**
+ * @file exec_env.c
+ * @brief Contains functions for handling the `env` built-in command.
+ */
+// EXEC ENV
+int			exec_env(char **args);
+
+/**
+ * @file exec_exit.c
+ * @brief Contains functions for handling the `exit` built-in command.
+ */
+// EXEC EXIT
+int			exit_shell(int status);
+int			exec_exit(char **args);
+
+/**
+ * @file exec_exec.c
+ * @brief Contains the `exec` builtin.
+ */
+// EXEC EXEC
+int			exec_exec_error(const char *name, int status);
+int			exec_exec(char **args);
+
+/**
+ * @file exec_export.c
+ * @brief Contains functions for handling the `export` built-in command.
+ */
+// EXEC EXPORT
+int			exec_export(char **args);
+int			handle_invalid_identifier(char *var_name, char *value,
+				t_export_params params);
+int			handle_export_argument(char *arg, int *i, int *ret);
+
+/**
+ * @file exec_history.c
+ * @brief Contains the `history` builtin.
+ */
+// EXEC HISTORY
+void		hist_print(t_history *h, size_t n, t_strbuf *sb);
+int			exec_history(char **args);
+
+/**
+ * @file exec_printf.c
+ * @brief Contains functions for handling the `printf` built-in command.
+ */
+// EXEC PRINTF
+int			exec_printf(char **args);
+void		pf_init(t_printf *pf, char **args);
+void		pf_run_format(t_printf *pf, const char *fmt);
+char		*pf_next_arg(t_printf *pf);
+size_t		pf_escape(t_printf *pf, t_strbuf *sb, const char *s);
+
+/**
+ * @file printf_conv.c
+ * @brief Contains the conversion handling of the `printf` builtin.
+ */
+// PRINTF CONV
+size_t		pf_parse_spec(const char *s, t_pfspec *spec);
+size_t		pf_conversion(t_printf *pf, const char *s);
+void		pf_emit_string(t_strbuf *sb, t_pfspec *spec, const char *s,
+				size_t len);
+void		pf_emit_b(t_printf *pf, t_pfspec *spec, const char *arg);
+void		pf_invalid_conv(t_printf *pf, char conv);
+
+/**
+ * @file printf_num.c
+ * @brief Contains the numeric conversions of the `printf` builtin.
+ */
+// PRINTF NUM
+unsigned long long	pf_parse_number(t_printf *pf, const char *arg,
+						int is_unsigned);
+char		pf_sign_char(t_pfspec *spec, unsigned long long *value);
+void		pf_utoa(char *buf, unsigned long long value, int base, int upper);
+void		pf_emit_digits(t_strbuf *sb, t_pfspec *spec, const char *digits,
+				char sign);
+void		pf_emit_number(t_printf *pf, t_pfspec *spec, const char *arg);
+
+/**
+ * @file exec_pwd.c
+ * @brief Contains functions for handling the `pwd` built-in command.
+ */
+// EXEC PWD
+int			exec_pwd(char **args);
+
+/**
+ * @file exec_read.c
+ * @brief Contains functions for handling the `read` built-in command.
+ */
+// EXEC READ
+int			exec_read(char **args);
+int			read_line(t_read *rd, int fd);
+int			read_parse_options(char **args, t_read *rd);
+int			read_check_names(char **names);
+
+/**
+ * @file read_input.c
+ * @brief Contains the input strategies of the `read` builtin.
+ */
+// READ INPUT
+int			read_feed(t_read *rd, char c);
+int			read_is_seekable(int fd);
+int			read_line_bytes(t_read *rd, int fd);
+int			read_line_block(t_read *rd, int fd);
+
+/**
+ * @file read_split.c
+ * @brief Contains the IFS field splitting of the `read` builtin.
+ */
+// READ SPLIT
+int			is_ifs_space(char c, const char *ifs);
+size_t		read_skip_ifs(const char *line, size_t i, const char *ifs,
+				int one_delim);
+void		read_set_field(const char *name, const char *s, size_t len);
+void		read_set_last(const char *name, const char *rest,
+				const char *ifs);
+void		read_assign_fields(const char *line, char **names);
+
+/**
+ * @file exec_return.c
+ * @brief Contains the `return` and `shift` builtins.
+ */
+// EXEC RETURN
+int			exec_return(char **args);
+int			exec_shift(char **args);
+
+/**
+ * @file exec_source.c
+ * @brief Contains the `source` and `.` builtins.
+ */
+// EXEC SOURCE
+int			source_error(const char *path, int err);
+char		*source_map_fd(int fd, size_t size, size_t *len);
+char		*source_map(const char *path, size_t *len);
+int			source_run(const char *text, char **args);
+int			exec_source(char **args);
+
+/**
+ * @file exec_test.c
+ * @brief Contains functions for handling the `test` and `[` builtins.
+ */
+// EXEC TEST
+int			exec_test(char **args);
+int			test_count_args(char **args);
+int			test_parse_int(t_test *t, const char *str, long long *out);
+int			test_int_error(t_test *t, const char *str);
+int			test_int_compare(t_test *t, const char *l, const char *op,
+				const char *r);
+
+/**
+ * @file exec_true.c
+ * @brief Contains the `true` and `false` builtins.
+ */
+// EXEC TRUE
+int			exec_true(char **args);
+int			exec_false(char **args);
+int			is_test_builtin(char **args);
+
+/**
+ * @file exec_unset.c
+ * @brief Contains functions for handling the `unset` built-in command.
+ */
+// EXEC UNSET
+int			handle_unset_error(char *arg);
+void		shift_environment(char **env_ptr);
+char		**find_and_free_env_var(const char *var_name, char **env_ptr);
+void		remove_env_var(const char *var_name);
+int			exec_unset(char **args);
+
+/**
+ * @file stat_cache.c
+ * @brief Contains the stat() cache shared by file tests.
+ */
+// STAT CACHE
+t_stat_cache	*get_stat_cache(void);
+void		invalidate_stat_cache(void);
+int			stat_entry_result(t_stat_entry *entry, struct stat *st);
+int			cached_stat(const char *path, struct stat *st);
+
+/**
+ * @file test_eval.c
+ * @brief Contains the recursive-descent evaluator for test expressions.
+ */
+// TEST EVAL
+int			test_error(t_test *t, char *message);
+int			test_or(t_test *t);
+int			test_and(t_test *t);
+int			test_not(t_test *t);
+int			test_primary(t_test *t);
+
+/**
+ * @file test_ops.c
+ * @brief Contains the unary and binary operators of test expressions.
+ */
+// TEST OPS
+int			is_test_unary_op(const char *op);
+int			is_test_binary_op(const char *op);
+int			test_unary(t_test *t);
+int			test_newer(const char *a, const char *b);
+int			test_binary(t_test *t);
+
+/**
+ * @file arith.c
+ * @brief Contains the entry points of arithmetic expansion.
+ */
+// ARITH
+void		expand_arith(const char *input, size_t *i, t_strbuf *out);
+int			arith_eval_text(const char *expr, size_t len, long long *out);
+int			arith_evaluate(const char *expr, size_t len, int depth,
+				long long *out);
+long long	arith_error(t_arith *st, char *message);
+void		arith_skip_ws(t_arith *st);
+
+/**
+ * @file arith_ops.c
+ * @brief Contains the binary operators of arithmetic expansion.
+ */
+// ARITH OPS
+int			arith_match_binop(t_arith *st, t_arith_op *op);
+long long	arith_divide(t_arith *st, char code, long long a, long long b);
+long long	arith_pow(t_arith *st, long long a, long long b);
+long long	arith_compare(char code, long long a, long long b);
+long long	arith_apply(t_arith *st, char code, long long a, long long b);
+
+/**
+ * @file arith_parse.c
+ * @brief Contains the precedence levels of arithmetic expansion.
+ */
+// ARITH PARSE
+long long	arith_comma(t_arith *st);
+long long	arith_assign(t_arith *st);
+long long	arith_ternary(t_arith *st);
+long long	arith_binary(t_arith *st, int min_prec);
+long long	arith_unary(t_arith *st);
+
+/**
+ * @file arith_unary.c
+ * @brief Contains the operands of arithmetic expansion.
+ */
+// ARITH UNARY
+long long	arith_prefix(t_arith *st, char c);
+long long	arith_number(t_arith *st);
+long long	arith_variable(t_arith *st);
+long long	arith_primary(t_arith *st);
+long long	arith_special(t_arith *st);
+
+/**
+ * @file arith_vars.c
+ * @brief Contains variable access for arithmetic expansion.
+ */
+// ARITH VARS
+void		arith_lltoa(char *buf, long long value);
+int			arith_read_name(t_arith *st, char *name);
+int			arith_match_assignop(t_arith *st, char *op);
+long long	arith_get_var(t_arith *st, const char *name);
+void		arith_set_var(const char *name, long long value);
+
+/**
+ * @file cmd_index.c
+ * @brief Contains lookups in the shared command index.
+ */
+// CMD INDEX
+t_cmd_index	*get_cmd_index(void);
+const char	*cmd_index_str(size_t i, int path);
+char		*cmd_index_find(const char *name);
+void		cmd_index_expire(void);
+
+/**
+ * @file cmd_index_build.c
+ * @brief Contains the rebuild of an on-disk command index.
+ */
+// CMD INDEX BUILD
+void		cmd_index_scan(t_idx_build *b, size_t i);
+size_t		cmd_index_pool(t_idx_build *b, t_strbuf *pool, t_idx_entry *ents);
+int			cmd_index_serialize(t_idx_build *b, t_strbuf *out);
+int			cmd_index_build(t_idx_build *b, const char *file);
+
+/**
+ * @file cmd_index_file.c
+ * @brief Contains the naming of command index files.
+ */
+// CMD INDEX FILE
+void		cmd_index_hash(const char *path, char hex[17]);
+char		*cmd_index_file(const char *path);
+void		cmd_index_mkdirs(const char *file);
+
+/**
+ * @file cmd_index_sync.c
+ * @brief Contains mapping and validation of the command index.
+ */
+// CMD INDEX SYNC
+void		cmd_index_unmap(t_cmd_index *idx);
+int			cmd_index_map(t_cmd_index *idx, const char *file);
+int			cmd_index_valid(t_cmd_index *idx, t_idx_build *b);
+int			cmd_index_dirs(t_idx_build *b);
+void		cmd_index_sync(void);
+
+/**
+ * @file cmdsub.c
+ * @brief Contains `$(...)` command substitution.
+ */
+// CMDSUB
+void		expand_cmdsub(const char *input, size_t *i, t_strbuf *out);
+void		cmdsub_capture(const char *body, t_strbuf *out);
+void		cmdsub_read_file(const char *spec, t_strbuf *out);
+int			cmdsub_is_simple(const char *s);
+int			cmdsub_fast_path(const char *body);
+
+/**
+ * @file cmdsub_exec.c
+ * @brief Contains the in-process and subshell runners of `$(...)`.
+ */
+// CMDSUB EXEC
+int			cmdsub_builtin(const char *body, t_strbuf *out);
+void		cmdsub_child(const char *body, int fds[2]);
+void		cmdsub_wait(pid_t pid);
+void		cmdsub_fork(const char *body, t_strbuf *out);
+
+/**
+ * @file complete.c
+ * @brief Contains the PATH scan behind command completion.
+ */
+// COMPLETE
+struct timespec	*complete_stamps(char **dirs, size_t n);
+void		complete_scan_dir(t_trie *trie, const char *dir);
+t_trie		*complete_build(char **dirs);
+void		complete_store(t_complete *c, const char *path,
+				struct timespec *stamps, size_t n);
+t_trie		*complete_refresh(t_complete *c);
+
+/**
+ * @file complete_files.c
+ * @brief Contains path completion over a cached directory listing.
+ */
+// COMPLETE FILES
+int			complete_fill(t_complete *c, t_dirscan *ds, const char *dir);
+t_strvec	*complete_listing(const char *dir);
+void		complete_files(const char *text, t_strvec *out);
+void		complete_paths(const char *path, t_strvec *out);
+
+/**
+ * @file complete_match.c
+ * @brief Contains the command and variable name completers.
+ */
+// COMPLETE MATCH
+t_complete	*get_complete(void);
+void		complete_free(t_complete *c);
+void		complete_commands(const char *text, t_strvec *out);
+void		complete_vars(const char *text, t_strvec *out);
+
+/**
+ * @file complete_quote.c
+ * @brief Contains the quoting of completed paths.
+ */
+// COMPLETE QUOTE
+int			complete_char_quoted(char *line, int index);
+char		*complete_unescape(const char *text);
+void		complete_escape_to(t_strbuf *sb, const char *s);
+char		*complete_escape(const char *dir, const char *name);
+
+/**
+ * @file complete_rl.c
+ * @brief Contains the completion entry point called by readline.
+ */
+// COMPLETE RL
+int			complete_command_position(const char *line, int start);
+size_t		complete_lcd(t_strvec *v);
+char		**complete_matches(t_strvec *v);
+char		**complete_attempt(const char *text, int start, int end);
+
+/**
+ * @file create_heredoc.c
+ * @brief Contains functions for handling heredoc creation.
+ */
+// CREATE HEREDOC
+pid_t		setup_pipe_and_fork(int pipefd[2]);
+void		setup_child_process(int pipefd[2], const char *delimiter);
+int			create_heredoc(const char *delimiter);
+int			heredoc_from_body(t_redir *r);
+void		heredoc_free(void *content);
+
+/**
+ * @file dirscan.c
+ * @brief Contains the getdents64 directory reader.
+ */
+// DIRSCAN
+int			dirscan_open(t_dirscan *ds, const char *dir);
+t_dirent64	*dirscan_next(t_dirscan *ds);
+void		dirscan_close(t_dirscan *ds);
+char		*dirscan_path(const char *dir, size_t dlen, const char *name);
+int			dirent_is_dir(const char *path, const t_dirent64 *ent);
+
+/**
+ * @file evloop.c
+ * @brief Contains the signalfd and epoll state of the shell.
+ */
+// EVLOOP
+t_evloop	*get_evloop(void);
+int			evloop_epfd(void);
+void		evloop_init(void);
+void		evloop_child(void);
+int			evloop_signals(void);
+
+/**
+ * @file evloop_read.c
+ * @brief Contains the prompt driven by readline's callback interface.
+ */
+// EVLOOP READ
+void		evloop_line_handler(char *line);
+void		evloop_on_sigint(void);
+void		evloop_read_step(t_evloop *ev);
+char		*evloop_readline(const char *prompt);
+
+/**
+ * @file evloop_watch.c
+ * @brief Contains the window of pidfds children are waited for through.
+ */
+// EVLOOP WATCH
+int			evloop_watch(int epfd, t_reap *r);
+int			evloop_watch_one(int epfd, pid_t pid, unsigned int tag);
+void		evloop_unwatch(int epfd, t_reap *r, int i);
+void		evloop_watch_zygote(int epfd, int pending);
+
+/**
+ * @file evloop_wait.c
+ * @brief Contains the pidfd based wait for child processes.
+ */
+// EVLOOP WAIT
+int			evloop_collect(int epfd, t_reap *r);
+void		evloop_reap(pid_t *pids, int *slots, int n);
+int			evloop_reap_init(t_reap *r, pid_t *pids, int *slots, int n);
+void		evloop_reap_rest(t_reap *r);
+int			child_status(int status, int *was_signaled);
+
+/**
+ * @file exec_tail.c
+ * @brief Contains the top-level list runner and the exec of the shell's
+ * final command without a fork.
+ */
+// EXEC TAIL
+int			stdin_at_eof(void);
+int			script_exec_top(t_node *list, int *should_exit);
+int			tail_exec_ok(t_cmd *pipeline);
+void		exec_in_place(t_cmd *cmd);
+int			script_exec_end(int *should_exit);
+
+/**
+ * @file execute_pipe.c
+ * @brief Contains functions for handling pipeline execution.
+ */
+// EXECUTE PIPE
+void		execute_child_process(int prev_pipe[2],
+				int next_pipe[2], t_cmd *current);
+int			fork_and_execute(int *pipes[2], t_cmd *current,
+				pid_t *child_pids, int *i);
+int			process_pipeline_command(t_pipeline_context *ctx, int *pipes[2]);
+int			process_all_pipeline_commands(t_pipeline_context *ctx,
+				int *pipes[2]);
+int			execute_pipeline(t_cmd *pipeline);
+
+/**
+ * @file exit_status.c
+ * @brief Contains functions for managing the shell's exit status.
+ */
+// EXIT STATUS
+void		set_exit_status(int status);
+int			get_exit_status(void);
+
+/**
+ * @file expand_error.c
+ * @brief Contains the flag used to abort a command on expansion errors.
+ */
+// EXPAND ERROR
+int			*expand_error_flag(void);
+void		raise_expand_error(void);
+int			consume_expand_error(void);
+
+/**
+ * @file expand_word.c
+ * @brief Contains expansion with backslash quoting.
+ */
+// EXPAND WORD
+int			expand_escape_at(const char *input, size_t i, int mode);
+char		*expand_escaped(const char *input, int mode);
+
+/**
+ * @file fd_hygiene.c
+ * @brief Contains the cleanup of descriptors inherited by commands.
+ */
+// FD HYGIENE
+int			procsub_next_fd(t_cmd *cmd, int from);
+void		close_stray_fds(t_cmd *cmd);
+int			fd_expected(t_cmd *cmd, int fd);
+void		fd_debug_report(t_cmd *cmd, int fd);
+void		fd_debug_check(t_cmd *cmd);
+
+/**
+ * @file fd_inherit.c
+ * @brief Contains the record of descriptors the shell was started with.
+ */
+// FD INHERIT
+void		fd_inherit_scan(void);
+int			fd_inherited_next(int from);
+int			fd_kept_next(t_cmd *cmd, int from);
+void		fd_inherit_close(void);
+
+/**
+ * @file fdplan.c
+ * @brief Contains the compiler of redirections into dup2/close plans.
+ */
+// FDPLAN
+int			redir_io_number(t_redir *r);
+int			fdplan_base(t_redir *redirections);
+int			fdplan_add(t_fdplan *plan, int src, int dst, int owned);
+int			fdplan_take(t_fdplan *plan, int fd, int dst);
+int			fdplan_build(t_fdplan *plan, t_redir *redirections);
+
+/**
+ * @file fdplan_apply.c
+ * @brief Contains the functions running and undoing redirection plans.
+ */
+// FDPLAN APPLY
+void		fdplan_close(t_fdplan *plan);
+int			fdplan_save(t_fdplan *plan, int i);
+int			fdplan_apply(t_fdplan *plan, int save);
+void		fdplan_restore(t_fdplan *plan);
+int			fdplan_virtual(t_fdplan *plan, int map[3]);
+
+/**
+ * @file fdplan_redir.c
+ * @brief Contains the compilation of single redirections.
+ */
+// FDPLAN REDIR
+int			fdplan_error(const char *name, int fd);
+int			dup_target(const char *word);
+int			fdplan_dup(t_fdplan *plan, t_redir *r);
+int			fdplan_redir(t_fdplan *plan, t_redir *r);
+void		stage_plan(t_cmd *cmd);
+
+/**
+ * @file function.c
+ * @brief Contains the function table and function calls.
+ */
+// FUNCTION
+t_func		**get_func_table(void);
+t_func		*func_lookup(const char *name);
+t_func		*func_for_cmd(t_cmd *cmd);
+int			func_define(const char *name, const char *text);
+int			func_call(t_func *f, char **args, int *should_exit);
+
+/**
+ * @file function_exec.c
+ * @brief Contains the dispatch of function calls and groups.
+ */
+// FUNCTION EXEC
+void		handle_function_in_parent(t_cmd *pipeline, t_func *f,
+				int *should_exit);
+void		run_function_stage(t_cmd *cmd);
+int			ast_exec_group(t_node *n, int *should_exit);
+void		func_table_free(void);
+
+/**
+ * @file get_cmd_path.c
+ * @brief Contains functions for resolving command paths.
+ */
+// GET CMD PATH
+char		*check_path_for_cmd(const char *dir_path, const char *cmd);
+char		**get_path_directories(void);
+char		*check_direct_path(char *cmd);
+char		*get_cmd_path(char *cmd);
+void		execute_command(t_cmd *cmd, int pipe_in, int pipe_out);
+
+/**
+ * @file glob.c
+ * @brief Contains the compiled shell pattern matcher.
+ */
+// GLOB
+void		glob_read_token(const char *pat, size_t *i, t_glob_tok *tok);
+int			glob_compile(const char *pat, t_glob *g);
+int			glob_tok_matches(const t_glob_tok *tok, unsigned char c);
+int			glob_match_at(const t_glob *g, size_t ti, const char *s,
+				size_t len);
+int			glob_match(const t_glob *g, const char *s, size_t len);
+
+/**
+ * @file glob_expand.c
+ * @brief Contains pathname expansion of words.
+ */
+// GLOB EXPAND
+int			word_has_glob(const char *raw);
+int			glob_name_matches(t_pathglob *pg, size_t i, const char *name);
+int			pathglob_expand(const char *pat, t_strvec *out);
+int			glob_push(t_strvec *v, char *word);
+char		**script_add_glob(char **words, const char *raw);
+
+/**
+ * @file glob_utils.c
+ * @brief Contains bracket expressions and helpers for patterns.
+ */
+// GLOB UTILS
+void		glob_set_range(t_glob_tok *tok, unsigned char lo,
+				unsigned char hi);
+int			glob_parse_class(const char *pat, size_t *i, t_glob_tok *tok);
+size_t		glob_longest_prefix(const t_glob *g, const char *s, size_t len);
+void		glob_free(t_glob *g);
+int			glob_literal(t_glob *g, char **text);
+
+/**
+ * @file handle_commands.c
+ * @brief Contains functions for handling command execution.
+ */
+// HANDLE COMMANDS
+void		execute_non_builtin(t_cmd *cmd, char **env);
+void		handle_child_exit(pid_t pid);
+void		setup_and_execute_child(t_cmd *cmd, int pipe_in, int pipe_out);
+void		handle_builtin_in_parent(t_cmd *pipeline);
+int			handle_command_pipeline(char *command, int *should_exit);
+
+// HANDLE HEREDOC
+void		write_line_to_pipe(int write_fd, const char *line,
+				int quoted_delimiter);
+int			is_quoted_delimiter(const char *delimiter);
+void		handle_child_process(int write_fd, const char *delimiter);
+int			handle_parent_process(pid_t pid, int read_fd, int *was_signaled);
+int			heredoc_open(int fds[2]);
+
+/**
+ * @file handle_parse_args.c
+ * @brief Contains functions for parsing command arguments.
+ */
+// HANDLE PARSE ARGS
+t_redir		*handle_redir_error(t_parse *p, t_list **args, t_redir *redirs);
+int			handle_argument_token(t_parse *p, t_list **args, t_redir *redirs);
+int			handle_redirection_token(t_parse *p, t_list **args,
+				t_redir **redir_tail, t_redir *redirs);
+t_cmd		*handle_syntax_error(t_parse *p, t_list *args, t_redir *redirs,
+				char *error_message);
+
+/**
+ * @file handle_parse.c
+ * @brief Contains functions for parsing input.
+ */
+// HANDLE PARSE
+void		handle_unmatched_quote(t_parse *p);
+void		handle_quotes(t_parse *p, char quote);
+char		*handle_quoted_segment(t_parse *p,
+				char *value, t_quote_state *quote_state);
+char		*handle_end_of_quote(t_parse *p, char *value,
+				size_t *segment_start, int *in_quote);
+char		*handle_unquoted_segment(t_parse *p, char *value,
+				size_t *segment_start);
+
+/**
+ * @file handle_pipe.c
+ * @brief Contains functions for managing pipes in command execution.
+ */
+// HANDLE PIPE
+int			wait_for_children(pid_t *child_pids, int cmd_count,
+				int *was_signaled);
+void		close_and_update_pipes(int prev_pipe[2], int next_pipe[2]);
+void		close_remaining_pipes(int prev_pipe[2]);
+int			handle_heredoc_redirections(t_redir *redirections);
+void		handle_last_command(t_cmd *pipeline, int last_status,
+				pid_t *child_pids);
+
+/**
+ * @file handle_redirect.c
+ * @brief Contains functions for managing redirections.
+ */
+// HANDLE REDIRECT
+int			open_redirection_fd(t_redir *redir);
+int			handle_redirections(t_cmd *cmd);
+int			redirect_push(t_fdplan *plan, t_redir *redirections);
+void		redirect_pop(t_fdplan *plan);
+int			stage_pipes(int pipe_in, int pipe_out);
+
+/**
+ * @file handle_special.c
+ * @brief Contains functions for handling special tokens and cases.
+ */
+// HANDLE SPECIAL
+void		assign_value(t_parse *p, enum e_token t, char *v, int n);
+void		handle_file_descriptor(t_parse *p);
+void		handle_output_redirection(t_parse *p);
+void		handle_input_redirection(t_parse *p);
+void		handle_special(t_parse *p);
+
+/**
+ * @file herestring.c
+ * @brief Contains `<<< word` here-string support.
+ */
+// HERESTRING
+char		*redir_target(t_parse *p, t_token type);
+int			herestring_write(int fd, const char *word);
+int			herestring_memfd(const char *word);
+int			herestring_open(const char *word);
+void		heredoc_take(t_parse *p, t_redir *redir);
+
+/**
+ * @file hist_file.c
+ * @brief Contains the shared history file.
+ */
+// HIST FILE
+char		*hist_file_name(void);
+int			hist_file_reopen(t_history *h);
+void		hist_file_open(t_history *h);
+void		hist_file_compact(t_history *h);
+int			hist_file_lock(t_history *h);
+
+/**
+ * @file hist_index.c
+ * @brief Contains upkeep of the history tables.
+ */
+// HIST INDEX
+void		hist_index_add(t_history *h, uint32_t seq);
+void		hist_index_prune(t_history *h);
+void		hist_clear(t_history *h);
+void		hist_compact(t_history *h);
+void		hist_free(void);
+
+/**
+ * @file hist_keys.c
+ * @brief Contains the history navigation and search keys.
+ */
+// HIST KEYS
+void		hist_nav_reset(void);
+void		hist_show(t_history *h, uint32_t seq);
+int			hist_key_prev(int count, int key);
+int			hist_key_next(int count, int key);
+int			hist_key_search(int count, int key);
+
+/**
+ * @file hist_lines.c
+ * @brief Contains history entry access and deduplication.
+ */
+// HIST LINES
+char		*hist_line(t_history *h, uint32_t seq);
+uint32_t	hist_hash(const char *s);
+uint32_t	hist_lines_find(t_history *h, const char *line);
+void		hist_lines_put(t_history *h, uint32_t seq);
+void		hist_lines_rehash(t_history *h);
+
+/**
+ * @file hist_log.c
+ * @brief Contains the records of the history file.
+ */
+// HIST LOG
+void		hist_encode(const char *line, t_strbuf *sb);
+char		*hist_decode(const char *rec, size_t len);
+size_t		hist_log_load(t_strbuf *sb);
+void		hist_log_append(t_history *h, const char *line);
+
+/**
+ * @file hist_post.c
+ * @brief Contains the gram table of the history index.
+ */
+// HIST POST
+uint32_t	hist_gram(const char *s);
+size_t		hist_gram_slot(uint32_t gram, size_t cap);
+t_hist_post	*hist_post(t_history *h, uint32_t gram, int create);
+int			hist_post_grow(t_history *h);
+int			hist_seqs_grow(t_hist_post *p);
+
+/**
+ * @file hist_search.c
+ * @brief Contains substring search over the history.
+ */
+// HIST SEARCH
+uint32_t	hist_first(t_history *h);
+t_hist_post	*hist_rarest(t_history *h, const char *query);
+uint32_t	hist_search_post(t_history *h, t_hist_post *p,
+				const char *query, uint32_t before);
+uint32_t	hist_search_scan(t_history *h, const char *query, uint32_t before);
+uint32_t	hist_search(t_history *h, const char *query, uint32_t before);
+
+/**
+ * @file history.c
+ * @brief Contains the bounded command history.
+ */
+// HISTORY
+t_history	*get_history(void);
+int			hist_init(void);
+int			hist_add(const char *line);
+void		hist_place(t_history *h, char *line);
+void		hist_drop(t_history *h, uint32_t seq);
+
+/**
+ * @file init.c
+ * @brief Contains functions for initializing shell components.
+ */
+// INIT
+void		init_parser(t_parse *p, char *input);
+void		init_word_and_quote_states(t_parse *p,
+				t_word_state *word_state, t_quote_state *quote_state);
+int			initialize_pipeline_resources(t_cmd *pipeline, int prev_pipe[2],
+				int next_pipe[2], pid_t **child_pids);
+int			initialize_pipeline(t_cmd *pipeline, t_pipeline_context *ctx);
+
+/**
+ * @file input.c
+ * @brief Contains functions for handling user input and variable expansion.
+ */
+// INPUT
+char		*expand_variable(const char *input, size_t *i);
+void		expand_and_append_variable(const char *input,
+				size_t *i, t_strbuf *out);
+char		*expand_variables(const char *input);
+void		exec_external_command(t_cmd *cmd);
+int			handle_redirection(t_redir *current, int fd);
+
+/**
+ * @file lex_group.c
+ * @brief Contains helpers to keep `$(...)` and `${...}` inside one word.
+ */
+// LEX GROUP
+void		skip_group_quote(t_parse *p);
+void		skip_expansion_group(t_parse *p);
+size_t		match_group_end(const char *s, size_t i);
+int			word_group_at(t_parse *p, t_word_state *ws);
+const char	*skip_subst_group(const char *str, int in_single);
+
+/**
+ * @file main.c
+ * @brief Contains the main entry point and core logic for the shell.
+ */
+// MAIN
+void		execute_command(t_cmd *cmd, int pipe_in, int pipe_out);
+int			handle_shell_loop(void);
+
+/**
+ * @file param_expand.c
+ * @brief Contains parsing of `${...}` parameter expansions.
+ */
+// PARAM EXPAND
+void		expand_param(const char *input, size_t *i, t_strbuf *out);
+char		*param_evaluate(const char *body);
+int			param_parse(const char *body, t_param *p);
+int			param_split_op(const char *rest, t_param *p);
+char		*param_lookup(const char *name);
+
+/**
+ * @file param_match.c
+ * @brief Contains prefix and suffix removal for `${...}`.
+ */
+// PARAM MATCH
+size_t		param_prefix_len(const t_glob *g, const char *s, int longest);
+size_t		param_suffix_start(const t_glob *g, const char *s, int longest);
+char		*param_trim(t_param *p);
+
+/**
+ * @file param_ops.c
+ * @brief Contains the default-value operators of `${...}`.
+ */
+// PARAM OPS
+char		*param_bad_subst(const char *body);
+char		*param_apply(t_param *p);
+char		*param_unset_error(t_param *p, char *word);
+char		*param_default(t_param *p);
+
+/**
+ * @file param_replace.c
+ * @brief Contains pattern substitution for `${...}`.
+ */
+// PARAM REPLACE
+int			param_replace_args(t_param *p, char **pattern, char **rep);
+char		*param_substitute(const t_glob *g, const char *s,
+				const char *rep, int global);
+char		*param_replace(t_param *p);
+
+/**
+ * @file parse_args.c
+ * @brief Contains functions for parsing command arguments.
+ */
+// PARSE ARGS
+void		process_argument(t_parse *p, t_list **args);
+t_redir		*process_redirection(t_parse *p, t_list **args, t_redir *redirs);
+t_cmd		*create_command(t_list *args, t_redir *redirs);
+int			process_tokens(t_parse *p, t_token_state *state);
+t_cmd		*parse_args(t_parse *p);
+
+/**
+ * @file parse_pipeline.c
+ * @brief Contains functions for parsing pipelines.
+ */
+// PARSE PIPELINE
+int			is_pipe_or_semicolon(t_parse *p);
+int			handle_cmd_result(t_parse *p, t_cmd **head,
+				t_cmd *cmd, t_cmd ***curr);
+int			check_pipe_error(t_parse *p, t_cmd *head);
+int			check_final_error(t_parse *p, t_cmd *head);
+t_cmd		*parse_pipeline(t_parse *p);
+
+/**
+ * @file parsers.c
+ * @brief Contains utility functions for parsing input.
+ */
+// PARSERS
+int			advance_to_closing_quote(t_parse *p, char quote);
+char		*add_segment(char *value, const char *input, size_t start,
+				size_t end);
+char		*process_quoted_segment(t_parse *p,
+				char *value, t_quote_state *quote_state);
+void		next_token(t_parse *p);
+void		handle_word(t_parse *p);
+char		*expand_arg(t_arg *a);
+char		**build_expanded_args(t_list *args);
+
+// PIPE SIGNALS
+int			create_pipe(int next_pipe[2]);
+int			pipeline_abort(t_pipeline_context *ctx, int exit_code);
+
+/**
+ * @file pathglob.c
+ * @brief Contains the directory walk of pathname patterns.
+ */
+// PATHGLOB
+int			pathglob_init(t_pathglob *pg, const char *pat, t_strvec *out);
+void		pathglob_free(t_pathglob *pg);
+int			pathglob_walk(t_pathglob *pg, const char *prefix, size_t i);
+int			pathglob_scan(t_pathglob *pg, const char *dir, size_t i);
+int			pathglob_take(t_pathglob *pg, char *path, t_dirent64 *ent,
+				size_t i);
+
+/**
+ * @file pipeline.c
+ * @brief Contains the parse and release of a single pipeline.
+ */
+// PIPELINE
+void		free_pipeline(t_cmd *pipeline);
+t_cmd		*parse_and_validate_pipeline(char *command, t_parse *parser);
+
+/**
+ * @file positional.c
+ * @brief Contains positional parameter frames and special parameters.
+ */
+// POSITIONAL
+t_frame		**get_frame(void);
+void		frame_push(t_frame *frame, char **args);
+int			is_special_param(char c);
+char		*special_param_value(char c);
+
+/**
+ * @file positional_words.c
+ * @brief Contains `$@` joining and splitting.
+ */
+// POSITIONAL WORDS
+char		*positional_join(t_frame *f);
+char		**positional_append(char **words);
+int			is_all_params(const char *raw);
+int			positional_push(t_strvec *v);
+
+/**
+ * @file procsub.c
+ * @brief Contains `<(...)` and `>(...)` process substitution.
+ */
+// PROCSUB
+void		procsub_child(const char *body, int fds[2], char dir);
+int			procsub_register(int fd, pid_t pid);
+int			procsub_start(const char *body, size_t len, char dir);
+int			procsub_expand_one(const char *word, size_t *i, t_strbuf *sb);
+char		*expand_procsub(const char *word);
+
+/**
+ * @file procsub_fds.c
+ * @brief Contains descriptor bookkeeping for process substitutions.
+ */
+// PROCSUB FDS
+t_procsub_table	*get_procsub_table(void);
+void		procsub_claim(t_cmd *from, t_cmd *to);
+void		procsub_close_others(t_cmd *keep);
+int			procsub_owned(t_cmd *owner, t_cmd *pipeline);
+void		procsub_reap(t_cmd *pipeline);
+
+/**
+ * @file rl_front.c
+ * @brief Contains the on-demand loading of readline.
+ */
+// RL FRONT
+t_rl_api	*get_rl_api(void);
+int			rl_front_load(void);
+void		rl_front_keys(t_rl_api *rl);
+
+/**
+ * @file rl_front_bind.c
+ * @brief Contains the lookup of the readline symbols.
+ */
+// RL FRONT BIND
+int			rl_front_bind(t_rl_api *rl);
+void		rl_bind_calls(t_rl_api *rl);
+void		rl_bind_vars(t_rl_api *rl);
+int			rl_bound(const t_rl_api *rl);
+
+/**
+ * @file script_case.c
+ * @brief Contains the parser for `case` commands.
+ */
+// SCRIPT CASE
+char		*script_take_patterns(t_script *sc);
+t_node		*parse_case_item(t_script *sc);
+t_node		*parse_case(t_script *sc);
+
+/**
+ * @file script_compound.c
+ * @brief Contains the parsers for `if`, `while`, `until` and `for`.
+ */
+// SCRIPT COMPOUND
+t_node		*parse_if(t_script *sc);
+void		parse_do_group(t_script *sc, t_node *n);
+t_node		*parse_loop(t_script *sc);
+t_node		*parse_for(t_script *sc);
+
+/**
+ * @file script_exec.c
+ * @brief Contains the executors for pipelines, lists and loops.
+ */
+// SCRIPT EXEC
+int			ast_exec_pipeline(t_node *n, int *should_exit);
+int			ast_exec_and_or(t_node *n, int *should_exit);
+int			ast_exec_if(t_node *n, int *should_exit);
+int			ast_loop_done(t_exec_ctl *ctl);
+int			ast_exec_loop(t_node *n, int *should_exit);
+
+/**
+ * @file script_for.c
+ * @brief Contains the executors for `for` and `case`.
+ */
+// SCRIPT FOR
+int			ast_exec_for(t_node *n, int *should_exit);
+int			ast_exec_case(t_node *n, int *should_exit);
+int			ast_case_matches(const char *patterns, const char *word);
+int			ast_pattern_matches(const char *raw, const char *word);
+
+/**
+ * @file script_func.c
+ * @brief Contains the parsing of groups and function definitions.
+ */
+// SCRIPT FUNC
+int			script_at_funcdef(t_script *sc);
+t_node		*parse_group(t_script *sc);
+t_node		*parse_funcdef(t_script *sc);
+
+/**
+ * @file script_heredoc.c
+ * @brief Contains heredoc bodies read with the script text.
+ */
+// SCRIPT HEREDOC
+char		*script_unquote(const char *s, size_t len);
+void		script_heredoc_add(t_script *sc);
+void		script_heredoc_body(t_script *sc, t_heredoc *hd);
+void		script_heredoc_read(t_script *sc);
+void		script_heredoc_end(t_script *sc);
+
+/**
+ * @file script_match.c
+ * @brief Contains lookahead helpers of the script parser.
+ */
+// SCRIPT MATCH
+int			script_at_word(t_script *sc, const char *word);
+int			script_at_op(t_script *sc, const char *op);
+int			script_at_sep(t_script *sc);
+int			script_at_end(t_script *sc);
+int			script_expect(t_script *sc, const char *word);
+
+/**
+ * @file script_node.c
+ * @brief Contains node allocation and error helpers of the script parser.
+ */
+// SCRIPT NODE
+t_node		*node_new(t_script *sc, t_node_type type);
+void		node_free(t_node *n);
+t_node		*script_error(t_script *sc);
+char		*script_take_word(t_script *sc);
+char		*script_take_words(t_script *sc);
+
+/**
+ * @file script_parse.c
+ * @brief Contains the script parser entry point and list parsers.
+ */
+// SCRIPT PARSE
+t_node		*script_parse(const char *src, int flags, int *status);
+t_node		*parse_list(t_script *sc);
+t_node		*parse_and_or(t_script *sc);
+t_node		*parse_command(t_script *sc);
+void		parse_redirs(t_script *sc, t_node *n);
+
+/**
+ * @file script_pipe.c
+ * @brief Contains pipelines whose stages are compound commands.
+ */
+// SCRIPT PIPE
+int			script_at_compound(t_script *sc);
+t_node		*parse_pipe(t_script *sc);
+t_cmd		*ast_pipe_stage(t_node *stage);
+t_cmd		*ast_pipe_build(t_node *n);
+int			ast_exec_pipe(t_node *n, int *should_exit);
+
+/**
+ * @file script_redir.c
+ * @brief Contains redirections of compound commands.
+ */
+// SCRIPT REDIR
+int			ast_exec_redirected(t_node *n, int *should_exit);
+
+/**
+ * @file script_run.c
+ * @brief Contains the script runner and node dispatch.
+ */
+// SCRIPT RUN
+int			script_run(const char *text, int *should_exit);
+char		*script_read_more(char *input);
+int			ast_exec_list(t_node *n, int *should_exit);
+int			ast_exec(t_node *n, int *should_exit);
+int			ast_exec_node(t_node *n, int *should_exit);
+
+/**
+ * @file script_scan.c
+ * @brief Contains the word scanner of the script parser.
+ */
+// SCRIPT SCAN
+size_t		script_quote_end(const char *s, size_t i);
+int			script_is_meta(const char *s, size_t i);
+size_t		script_word_end(const char *s, size_t i);
+void		script_skip_blank(t_script *sc);
+void		script_skip_space(t_script *sc);
+
+/**
+ * @file script_simple.c
+ * @brief Contains the pipeline parser of the script parser.
+ */
+// SCRIPT SIMPLE
+int			script_skip_redir_op(t_script *sc);
+int			script_simple_stop(t_script *sc);
+int			script_skip_pipe(t_script *sc);
+int			script_simple_step(t_script *sc);
+t_node		*parse_simple(t_script *sc);
+
+/**
+ * @file script_words.c
+ * @brief Contains word expansion for `for` lists.
+ */
+// SCRIPT WORDS
+char		**script_append(char **words, char *word);
+char		**script_split_fields(char **words, const char *value);
+char		**script_add_word(char **words, const char *raw);
+char		**script_expand_words(const char *text);
+
+/**
+ * @file server.c
+ * @brief Contains the `--server` main loop.
+ */
+// SERVER
+int			server_run(const char *path);
+int			server_setup(t_server *srv, const char *path);
+int			server_signals(t_server *srv);
+int			server_step(t_server *srv);
+void		server_stop(t_server *srv);
+
+/**
+ * @file server_child.c
+ * @brief Contains the process running one server request.
+ */
+// SERVER CHILD
+void		server_child(t_server *srv, int conn, t_srv_req *req);
+int			server_child_fds(t_server *srv, int conn, int fds[3]);
+void		server_overlay(char *entry, const char *end);
+int			server_error(const char *what);
+void		server_req_free(t_srv_req *req);
+
+/**
+ * @file server_job.c
+ * @brief Contains the server's request slots.
+ */
+// SERVER JOB
+void		server_accept(t_server *srv);
+void		server_spawn(t_server *srv, int conn, t_srv_req *req);
+void		server_watch(t_server *srv, int slot);
+void		server_finish(t_server *srv, int slot);
+void		server_pause(t_server *srv, uint32_t events);
+
+/**
+ * @file server_sock.c
+ * @brief Contains the server socket and the request wire format.
+ */
+// SERVER SOCK
+int			server_bind(t_server *srv);
+int			server_stale(const struct sockaddr_un *addr);
+int			server_peer_ok(int conn);
+int			server_recv(int conn, t_srv_req *req);
+int			server_take_fds(struct msghdr *msg, ssize_t n, t_srv_req *req);
+
+/**
+ * @file shell_ctx.c
+ * @brief Contains the shell context and the per-thread current context.
+ * The library entry points are declared in libminishell.h.
+ */
+// SHELL CTX
+t_shell_ctx	**shell_ctx_slot(void);
+t_shell_ctx	*get_shell_ctx(void);
+t_shell_ctx	*shell_ctx_use(t_shell_ctx *ctx);
+
+/**
+ * @file shell_input.c
+ * @brief Contains the line input shared by the prompt and heredocs.
+ */
+// SHELL INPUT
+char		*line_read(int fd, const char *prompt);
+char		*shell_readline(const char *prompt);
+void		shell_add_history(const char *line);
+void		shell_clear_history(void);
+
+/**
+ * @file signals.c
+ * @brief Contains functions for handling signals.
+ */
 // SIGNALS
-void		handle_sigint(int sig);
+void		shell_sigset(sigset_t *set);
 void		setup_parent_signals(void);
 void		setup_child_signals(void);
 void		setup_heredoc_signals(void);
 
+/**
+ * @file subshell.c
+ * @brief Contains helpers to run command text in a forked subshell.
+ */
+// SUBSHELL
+int			*in_subshell(void);
+void		run_subshell(const char *body);
+void		run_script_stage(t_node *script);
+
+/**
+ * @file trie.c
+ * @brief Contains the insertion into a compressed trie.
+ */
+// TRIE
+t_trie		*trie_node(const char *edge, size_t len);
+int			trie_split(t_trie *node, size_t k);
+int			trie_add(t_trie *parent, const char *name);
+int			trie_insert(t_trie *node, const char *name);
+void		trie_free(t_trie *node);
+
+/**
+ * @file trie_query.c
+ * @brief Contains the prefix lookups in a compressed trie.
+ */
+// TRIE QUERY
+t_trie		*trie_find(t_trie *node, const char *prefix, t_strbuf *path);
+void		trie_collect(t_trie *node, t_strbuf *path, t_strvec *out);
+
+/**
+ * @file word_expand.c
+ * @brief Contains the expansion of single words, without field splitting
+ * or pathname expansion.
+ */
+// WORD EXPAND
+char		*word_expand(const char *raw, int pattern);
+size_t		word_expand_quoted(t_strbuf *sb, const char *raw, size_t i,
+				int pattern);
+size_t		word_expand_plain(t_strbuf *sb, const char *raw, size_t i,
+				int pattern);
+size_t		word_group_skip(const char *raw, size_t i);
+void		word_append(t_strbuf *sb, const char *value, int escape);
+
+/**
+ * @file zygote.c
+ * @brief Contains the start and end of the zygote, the small process
+ * external commands are forked from.
+ */
+// ZYGOTE
+t_zygote	*get_zygote(void);
+void		zygote_start(void);
+void		zygote_stop(void);
+void		zygote_forget(void);
+void		zygote_lost(void);
+
+/**
+ * @file zygote_launch.c
+ * @brief Contains the launch of a pipeline stage through the zygote.
+ */
+// ZYGOTE LAUNCH
+pid_t		zygote_launch(int *pipes[2], t_cmd *cmd);
+int			zygote_fds(int *pipes[2], t_cmd *cmd, int fds[ZYG_NFDS]);
+int			zygote_body(t_strbuf *body, const char *path, char **args);
+int			zygote_send(int sock, t_strbuf *body, int fds[ZYG_NFDS]);
+
+/**
+ * @file zygote_main.c
+ * @brief Contains the loop of the zygote process.
+ */
+// ZYGOTE MAIN
+void		zygote_main(int fd);
+int			zygote_request(int fd, char *buf);
+void		zygote_exited(int fd, int sigfd);
+void		zygote_fork(int fd, char *buf, ssize_t n, int *fds);
+void		zygote_exec(char *buf, ssize_t n, int *fds);
+
+/**
+ * @file zygote_reap.c
+ * @brief Contains the exit statuses relayed by the zygote.
+ */
+// ZYGOTE REAP
+pid_t		zygote_recv(int flags);
+int			zygote_find(pid_t pid);
+int			zygote_claim(pid_t pid, int *status);
+int			zygote_reap(int epfd, t_reap *r);
+int			zygote_wait(pid_t pid);
+
+/**
+ * @file pipe_budget.c
+ * @brief Contains the descriptor budget of a pipeline.
+ */
+// PIPE BUDGET
+int			fd_count_open(void);
+int			pipe_fd_need(t_cmd *pipeline);
+int			pipe_fd_budget(t_cmd *pipeline);
+
+/**
+ * @file pipe_spawn.c
+ * @brief Contains the launch of pipeline stages with posix_spawn.
+ */
+// PIPE SPAWN
+int			stage_fd_map(int *pipes[2], t_cmd *cmd, int map[3]);
+pid_t		pipe_spawn(int *pipes[2], t_cmd *cmd);
+int			pipe_spawn_setup(posix_spawn_file_actions_t *actions,
+				posix_spawnattr_t *attr, int map[3]);
+int			pipe_spawn_signals(posix_spawnattr_t *attr);
+
+/**
+ * @file pipe_stats.c
+ * @brief Contains the launch time and descriptor measures of pipelines.
+ */
+// PIPE STATS
+t_pipe_stats	*get_pipe_stats(void);
+void		pipe_stats_start(int stages);
+void		pipe_stats_sample(int launched);
+void		pipe_stats_report(void);
+void		pipe_stats_ms(struct timespec *from, struct timespec *to);
+
 /**
  * @file utils.c
  * @brief Contains utility functions used throughout the shell.
@@ -575,7 +2843,7 @@ void		add_substring(char ***result, int *count, const char *start,
 				const char *end);
 void		handle_delimiter(const char **str, const char **start,
 				char ***result, int *count);
-const char	*skip_escaped(const char *str, char delim);
+const char	*skip_escaped(const char *str, char delim, int in_single);
 void		finalize_split(const char *start, const char *str,
 				char ***result, int *count);
 char		**split_with_quotes(const char *str, char delim);
@@ -583,8 +2851,64 @@ char		*process_escapes(char *str);
 int			is_redirection(t_token type);
 void		skip_whitespace(t_parse *p);
 void		handle_error(char *message);
-char		**read_and_split_input(char **env_copy, int *should_exit);
+char		*read_command_text(int *should_exit);
 int			cleanup_on_failure(pid_t **child_pids, int exit_code);
 void		free_commands(char **commands);
+int			at_fd_redirection(t_parse *p);
+
+/**
+ * @file strbuf.c
+ * @brief Contains the growable buffer used to batch output.
+ */
+// STRBUF
+void		sb_init(t_strbuf *sb);
+int			sb_reserve(t_strbuf *sb, size_t extra);
+void		sb_append(t_strbuf *sb, const char *s, size_t n);
+void		sb_putc(t_strbuf *sb, char c);
+void		sb_pad(t_strbuf *sb, char c, int n);
+int			sb_flush(t_strbuf *sb, int fd);
+void		sb_free(t_strbuf *sb);
+char		*sb_detach(t_strbuf *sb);
+int			sb_read_fd(t_strbuf *sb, int fd);
+int			sb_replace_file(t_strbuf *sb, const char *file, mode_t mode);
+
+/**
+ * @file strsort.c
+ * @brief Contains the byte-order string sort.
+ */
+// STRSORT
+void		str_merge(char **src, char **dst, const size_t b[3]);
+void		str_merge_pass(char **src, char **dst, size_t n, size_t width);
+void		str_sort(char **v, size_t n);
+
+/**
+ * @file strvec.c
+ * @brief Contains the growable string array.
+ */
+// STRVEC
+int			strvec_grow(t_strvec *v);
+int			strvec_push(t_strvec *v, char *s);
+void		strvec_free(t_strvec *v);
+char		**strvec_finish(t_strvec *v);
+char		**strvec_concat(char **words, t_strvec *v);
+
+/**
+ * @file client_io.c
+ * @brief Contains the socket side of `minishell_client`.
+ */
+// CLIENT IO
+int			client_connect(const char *path);
+int			client_send(int sock, t_strbuf *body);
+int			client_reply(t_client *cl, int sock);
+void		client_report(t_srv_reply *r);
+
+/**
+ * @file minishell_client.c
+ * @brief Contains the entry point of `minishell_client`, the client of
+ * `minishell --server`.
+ */
+// MINISHELL CLIENT
+int			client_args(t_client *cl, int argc, char **argv);
+int			client_body(t_client *cl, int argc, char **argv);
 
 #endif
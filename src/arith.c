@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:42:10 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Expands `$((expr))` and appends the result.
+ * @param input String being expanded.
+ * @param i Index of the '$'; moved past the closing "))".
+ * @param out Expansion built so far.
+ * @note On error nothing is appended and the command is dropped. Text
+ * such as `$((a); (b))` is a command substitution instead.
+ */
+void	expand_arith(const char *input, size_t *i, t_strbuf *out)
+{
+	size_t		end;
+	long long	value;
+	char		buf[PF_NUM_BUF];
+
+	end = match_group_end(input, *i + 2);
+	if (!end || input[end + 1] != ')')
+	{
+		expand_cmdsub(input, i, out);
+		return ;
+	}
+	if (arith_eval_text(input + *i + 3, end - (*i + 3), &value) == -1)
+		raise_expand_error();
+	else
+	{
+		arith_lltoa(buf, value);
+		sb_append(out, buf, ft_strlen(buf));
+	}
+	*i = end + 2;
+}
+
+/**
+ * @brief Evaluates the text of `$((...))`.
+ * @param expr Start of the expression.
+ * @param len Length of the expression.
+ * @param out Receives the value.
+ * @return 0 on success, -1 on error (already reported).
+ * @note Only text containing `$(` is copied and expanded first; anything
+ * else is evaluated in place.
+ */
+int	arith_eval_text(const char *expr, size_t len, long long *out)
+{
+	char	*raw;
+	char	*expanded;
+	int		ret;
+
+	if (!ft_strnstr(expr, "$(", len))
+		return (arith_evaluate(expr, len, 0, out));
+	raw = ft_substr(expr, 0, len);
+	expanded = NULL;
+	if (raw)
+		expanded = expand_variables(raw);
+	free(raw);
+	if (!expanded)
+		return (-1);
+	ret = arith_evaluate(expanded, ft_strlen(expanded), 0, out);
+	free(expanded);
+	return (ret);
+}
+
+/**
+ * @brief Evaluates an arithmetic expression.
+ * @param expr Start of the expression (not necessarily NUL-terminated).
+ * @param len Length of the expression.
+ * @param depth Recursion depth (variables holding expressions).
+ * @param out Receives the value.
+ * @return 0 on success, -1 on error (already reported).
+ * @note Works in place on the input: no allocation unless a variable
+ * is assigned.
+ */
+int	arith_evaluate(const char *expr, size_t len, int depth, long long *out)
+{
+	t_arith	st;
+
+	st.s = expr;
+	st.end = expr + len;
+	st.expr = expr;
+	st.noeval = 0;
+	st.error = 0;
+	st.depth = depth;
+	*out = 0;
+	arith_skip_ws(&st);
+	if (st.s == st.end)
+		return (0);
+	*out = arith_comma(&st);
+	arith_skip_ws(&st);
+	if (!st.error && st.s < st.end)
+		arith_error(&st, "syntax error in expression");
+	return (-st.error);
+}
+
+/**
+ * @brief Reports an arithmetic error once per evaluation.
+ * @param st Evaluation state.
+ * @param message Description of the error.
+ * @return Always returns 0.
+ */
+long long	arith_error(t_arith *st, char *message)
+{
+	if (!st->error)
+	{
+		ft_putstr_fd("minishell: ", STDERR_FILENO);
+		write(STDERR_FILENO, st->expr, st->end - st->expr);
+		ft_putstr_fd(": ", STDERR_FILENO);
+		ft_putstr_fd(message, STDERR_FILENO);
+		ft_putstr_fd("\n", STDERR_FILENO);
+	}
+	st->error = 1;
+	return (0);
+}
+
+/**
+ * @brief Skips whitespace inside an arithmetic expression.
+ * @param st Evaluation state.
+ */
+void	arith_skip_ws(t_arith *st)
+{
+	while (st->s < st->end && ft_isspace(*st->s))
+		st->s++;
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:52 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Matches the binary operator at the current position.
+ * @param st Evaluation state (not advanced).
+ * @param op Receives the operator description.
+ * @return 1 if a binary operator follows, 0 otherwise.
+ * @note An assignable operator directly followed by '=' is a compound
+ * assignment and is left for arith_assign.
+ */
+int	arith_match_binop(t_arith *st, t_arith_op *op)
+{
+	static const t_arith_op	ops[] = {{"**", 'P', 11}, {"<<", 'L', 8},
+	{">>", 'R', 8}, {"<=", 'l', 7}, {">=", 'g', 7}, {"==", 'E', 6},
+	{"!=", 'N', 6}, {"&&", 'A', 2}, {"||", 'O', 1}, {"*", '*', 10},
+	{"/", '/', 10}, {"%", '%', 10}, {"+", '+', 9}, {"-", '-', 9},
+	{"<", '<', 7}, {">", '>', 7}, {"&", '&', 5}, {"^", '^', 4},
+	{"|", '|', 3}, {NULL, 0, 0}};
+	size_t					len;
+	int						i;
+
+	arith_skip_ws(st);
+	i = 0;
+	while (ops[i].text)
+	{
+		len = ft_strlen(ops[i].text);
+		if (st->s + len <= st->end && !ft_strncmp(st->s, ops[i].text, len))
+		{
+			*op = ops[i];
+			return (!(ft_strchr("LR*/%+-&^|", op->code)
+					&& st->s + len < st->end && st->s[len] == '='));
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Evaluates `/` and `%`, guarding division by zero and overflow.
+ * @param st Evaluation state.
+ * @param code '/' or '%'.
+ * @param a Dividend.
+ * @param b Divisor.
+ * @return The quotient or remainder.
+ */
+long long	arith_divide(t_arith *st, char code, long long a, long long b)
+{
+	if (st->noeval)
+		return (0);
+	if (b == 0)
+		return (arith_error(st, "division by 0"));
+	if (a == LLONG_MIN && b == -1)
+	{
+		if (code == '/')
+			return (LLONG_MIN);
+		return (0);
+	}
+	if (code == '/')
+		return (a / b);
+	return (a % b);
+}
+
+/**
+ * @brief Evaluates `a ** b` by repeated squaring.
+ * @param st Evaluation state.
+ * @param a Base.
+ * @param b Exponent; must not be negative.
+ * @return The power, wrapping on overflow.
+ */
+long long	arith_pow(t_arith *st, long long a, long long b)
+{
+	unsigned long long	base;
+	unsigned long long	result;
+
+	if (b < 0)
+	{
+		if (st->noeval)
+			return (0);
+		return (arith_error(st, "exponent less than 0"));
+	}
+	base = (unsigned long long)a;
+	result = 1;
+	while (b > 0)
+	{
+		if (b & 1)
+			result *= base;
+		base *= base;
+		b >>= 1;
+	}
+	return ((long long)result);
+}
+
+/**
+ * @brief Evaluates comparison and logical operators.
+ * @param code Operator code.
+ * @param a Left operand.
+ * @param b Right operand.
+ * @return 1 or 0.
+ */
+long long	arith_compare(char code, long long a, long long b)
+{
+	if (code == '<')
+		return (a < b);
+	if (code == '>')
+		return (a > b);
+	if (code == 'l')
+		return (a <= b);
+	if (code == 'g')
+		return (a >= b);
+	if (code == 'E')
+		return (a == b);
+	if (code == 'N')
+		return (a != b);
+	if (code == 'A')
+		return (a && b);
+	return (a || b);
+}
+
+/**
+ * @brief Applies a binary operator with 64-bit wrap-around semantics.
+ * @param st Evaluation state.
+ * @param code Operator code (see arith_match_binop).
+ * @param a Left operand.
+ * @param b Right operand.
+ * @return The result.
+ */
+long long	arith_apply(t_arith *st, char code, long long a, long long b)
+{
+	unsigned long long	ua;
+
+	ua = (unsigned long long)a;
+	if (code == '+')
+		return ((long long)(ua + (unsigned long long)b));
+	if (code == '-')
+		return ((long long)(ua - (unsigned long long)b));
+	if (code == '*')
+		return ((long long)(ua * (unsigned long long)b));
+	if (code == '/' || code == '%')
+		return (arith_divide(st, code, a, b));
+	if (code == 'P')
+		return (arith_pow(st, a, b));
+	if (code == 'L')
+		return ((long long)(ua << (b & 63)));
+	if (code == 'R')
+		return (a >> (b & 63));
+	if (code == '&')
+		return (a & b);
+	if (code == '^')
+		return (a ^ b);
+	if (code == '|')
+		return (a | b);
+	return (arith_compare(code, a, b));
+}
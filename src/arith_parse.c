@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_parse.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:52 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Evaluates `expr, expr, ...` (lowest precedence).
+ * @param st Evaluation state.
+ * @return Value of the last expression.
+ */
+long long	arith_comma(t_arith *st)
+{
+	long long	value;
+
+	value = arith_assign(st);
+	arith_skip_ws(st);
+	while (!st->error && st->s < st->end && *st->s == ',')
+	{
+		st->s++;
+		value = arith_assign(st);
+		arith_skip_ws(st);
+	}
+	return (value);
+}
+
+/**
+ * @brief Evaluates `name op= expr` (right associative) or falls through
+ * to the conditional operator.
+ * @param st Evaluation state.
+ * @return Value of the expression.
+ */
+long long	arith_assign(t_arith *st)
+{
+	const char	*save;
+	char		name[ARITH_NAME_MAX];
+	char		op;
+	long long	value;
+
+	arith_skip_ws(st);
+	save = st->s;
+	if (arith_read_name(st, name) && arith_match_assignop(st, &op))
+	{
+		value = arith_assign(st);
+		if (op != '=')
+			value = arith_apply(st, op, arith_get_var(st, name), value);
+		if (!st->noeval && !st->error)
+			arith_set_var(name, value);
+		return (value);
+	}
+	st->s = save;
+	return (arith_ternary(st));
+}
+
+/**
+ * @brief Evaluates `cond ? a : b`; only the chosen branch has effects.
+ * @param st Evaluation state.
+ * @return Value of the selected branch.
+ */
+long long	arith_ternary(t_arith *st)
+{
+	long long	cond;
+	long long	a;
+	long long	b;
+
+	cond = arith_binary(st, 1);
+	arith_skip_ws(st);
+	if (st->error || st->s >= st->end || *st->s != '?')
+		return (cond);
+	st->s++;
+	st->noeval += (cond == 0);
+	a = arith_comma(st);
+	st->noeval -= (cond == 0);
+	arith_skip_ws(st);
+	if (st->s >= st->end || *st->s != ':')
+		return (arith_error(st, "`:' expected for conditional expression"));
+	st->s++;
+	st->noeval += (cond != 0);
+	b = arith_assign(st);
+	st->noeval -= (cond != 0);
+	if (cond)
+		return (a);
+	return (b);
+}
+
+/**
+ * @brief Evaluates binary operators by precedence climbing.
+ * @param st Evaluation state.
+ * @param min_prec Lowest precedence this call may consume.
+ * @return Value of the expression.
+ * @note `&&` and `||` suppress side effects of their right operand when
+ * the result is already known.
+ */
+long long	arith_binary(t_arith *st, int min_prec)
+{
+	long long	lhs;
+	long long	rhs;
+	t_arith_op	op;
+	int			skip;
+
+	lhs = arith_unary(st);
+	while (!st->error && arith_match_binop(st, &op) && op.prec >= min_prec)
+	{
+		st->s += ft_strlen(op.text);
+		skip = ((op.code == 'A' && !lhs) || (op.code == 'O' && lhs));
+		st->noeval += skip;
+		rhs = arith_binary(st, op.prec + (op.code != 'P'));
+		st->noeval -= skip;
+		lhs = arith_apply(st, op.code, lhs, rhs);
+	}
+	return (lhs);
+}
+
+/**
+ * @brief Evaluates unary operators and prefix increments.
+ * @param st Evaluation state.
+ * @return Value of the operand.
+ */
+long long	arith_unary(t_arith *st)
+{
+	char		c;
+	long long	value;
+
+	arith_skip_ws(st);
+	if (st->s >= st->end)
+		return (arith_error(st, "operand expected"));
+	c = *st->s;
+	if ((c == '+' || c == '-') && st->s + 1 < st->end && st->s[1] == c)
+		return (arith_prefix(st, c));
+	if (c != '!' && c != '~' && c != '-' && c != '+')
+		return (arith_primary(st));
+	st->s++;
+	value = arith_unary(st);
+	if (c == '!')
+		return (value == 0);
+	if (c == '~')
+		return (~value);
+	if (c == '-')
+		return ((long long)(0ULL - (unsigned long long)value));
+	return (value);
+}
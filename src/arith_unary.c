@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_unary.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 20:37:51 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Evaluates `++name` / `--name`.
+ * @param st Evaluation state, positioned on the operator.
+ * @param c '+' or '-'.
+ * @return The updated value.
+ * @note Without a variable after it, `--5` is read as `-(-5)`.
+ */
+long long	arith_prefix(t_arith *st, char c)
+{
+	const char	*save;
+	char		name[ARITH_NAME_MAX];
+	long long	value;
+
+	save = st->s;
+	st->s += 2;
+	arith_skip_ws(st);
+	if (!arith_read_name(st, name))
+	{
+		st->s = save + 1;
+		value = arith_unary(st);
+		if (c == '-')
+			return ((long long)(0ULL - (unsigned long long)value));
+		return (value);
+	}
+	value = arith_get_var(st, name);
+	if (c == '+')
+		value = arith_apply(st, '+', value, 1);
+	else
+		value = arith_apply(st, '-', value, 1);
+	if (!st->noeval && !st->error)
+		arith_set_var(name, value);
+	return (value);
+}
+
+/**
+ * @brief Parses an integer constant (decimal, 0x hex or 0 octal).
+ * @param st Evaluation state, positioned on the first digit.
+ * @return The constant.
+ */
+long long	arith_number(t_arith *st)
+{
+	char				*endp;
+	unsigned long long	value;
+
+	value = strtoull(st->s, &endp, 0);
+	st->s = endp;
+	if (st->s < st->end && (ft_isalnum(*st->s) || *st->s == '_'))
+		return (arith_error(st, "value too great for base"));
+	return ((long long)value);
+}
+
+/**
+ * @brief Evaluates a variable reference with an optional postfix
+ * `++`/`--`.
+ * @param st Evaluation state.
+ * @return Value of the variable (before any postfix update).
+ * @note Accepts `name`, `$name`, `${name}` and special parameters.
+ */
+long long	arith_variable(t_arith *st)
+{
+	char		name[ARITH_NAME_MAX];
+	int			braced;
+	long long	value;
+
+	braced = 0;
+	if (*st->s == '$' && ++st->s < st->end && is_special_param(*st->s))
+		return (arith_special(st));
+	if (st->s < st->end && st->s[-1] == '$' && *st->s == '{' && ++st->s)
+		braced = 1;
+	if (!arith_read_name(st, name))
+		return (arith_error(st, "syntax error: operand expected"));
+	if (braced && (st->s >= st->end || *st->s++ != '}'))
+		return (arith_error(st, "bad substitution"));
+	value = arith_get_var(st, name);
+	if (!braced && st->s + 1 < st->end
+		&& (*st->s == '+' || *st->s == '-') && st->s[1] == *st->s)
+	{
+		if (!st->noeval && !st->error)
+			arith_set_var(name, arith_apply(st, *st->s, value, 1));
+		st->s += 2;
+	}
+	return (value);
+}
+
+/**
+ * @brief Evaluates a parenthesised expression, constant or variable.
+ * @param st Evaluation state.
+ * @return Value of the operand.
+ */
+long long	arith_primary(t_arith *st)
+{
+	long long	value;
+
+	arith_skip_ws(st);
+	if (st->s >= st->end)
+		return (arith_error(st, "syntax error: operand expected"));
+	if (*st->s == '(')
+	{
+		st->s++;
+		value = arith_comma(st);
+		arith_skip_ws(st);
+		if (st->s >= st->end || *st->s != ')')
+			return (arith_error(st, "missing `)'"));
+		st->s++;
+		return (value);
+	}
+	if (ft_isdigit(*st->s))
+		return (arith_number(st));
+	return (arith_variable(st));
+}
+
+/**
+ * @brief Evaluates a special parameter such as `$?`, `$#` or `$1`.
+ * @param st Evaluation state, on the parameter name.
+ * @return Numeric value of the parameter (0 if unset or not a number).
+ */
+long long	arith_special(t_arith *st)
+{
+	char		*value;
+	long long	n;
+
+	value = special_param_value(*st->s++);
+	n = 0;
+	if (value)
+		n = strtoll(value, NULL, 10);
+	free(value);
+	return (n);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_vars.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reads a variable name into a stack buffer.
+ * @param st Evaluation state.
+ * @param name Destination of ARITH_NAME_MAX bytes.
+ * @return 1 if a name was read, 0 if none starts here.
+ */
+int	arith_read_name(t_arith *st, char *name)
+{
+	size_t	i;
+
+	if (st->s >= st->end || !(ft_isalpha(*st->s) || *st->s == '_'))
+		return (0);
+	i = 0;
+	while (st->s < st->end && (ft_isalnum(*st->s) || *st->s == '_'))
+	{
+		if (i + 1 < ARITH_NAME_MAX)
+			name[i++] = *st->s;
+		st->s++;
+	}
+	name[i] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Matches an assignment operator (`=`, `+=`, `<<=`, ...).
+ * @param st Evaluation state; advanced past the operator on success.
+ * @param op Receives the binary operator code, or '=' for plain
+ * assignment.
+ * @return 1 if an assignment operator was matched.
+ */
+int	arith_match_assignop(t_arith *st, char *op)
+{
+	static const char	*ops[] = {"<<=", ">>=", "+=", "-=", "*=", "/=",
+		"%=", "&=", "^=", "|=", "=", NULL};
+	static const char	codes[] = "LR+-*/%&^|=";
+	size_t				len;
+	int					i;
+
+	arith_skip_ws(st);
+	i = 0;
+	while (ops[i])
+	{
+		len = ft_strlen(ops[i]);
+		if (st->s + len <= st->end && !ft_strncmp(st->s, ops[i], len)
+			&& !(codes[i] == '=' && st->s + 1 < st->end && st->s[1] == '='))
+		{
+			st->s += len;
+			*op = codes[i];
+			return (1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Returns the numeric value of a shell variable.
+ * @param st Evaluation state.
+ * @param name Variable name.
+ * @return Value; unset or empty variables are 0.
+ * @note The value is itself evaluated as an expression, so `a=b+1`
+ * works, bounded by ARITH_MAX_DEPTH.
+ */
+long long	arith_get_var(t_arith *st, const char *name)
+{
+	char		*value;
+	long long	result;
+
+	value = env_value(name);
+	if (!value || !*value || st->noeval || st->error)
+		return (0);
+	if (st->depth >= ARITH_MAX_DEPTH)
+		return (arith_error(st, "expression recursion level exceeded"));
+	if (arith_evaluate(value, ft_strlen(value), st->depth + 1, &result) == -1)
+		st->error = 1;
+	return (result);
+}
+
+/**
+ * @brief Formats a signed 64-bit value in decimal.
+ * @param buf Destination (at least PF_NUM_BUF bytes).
+ * @param value Value to format.
+ */
+void	arith_lltoa(char *buf, long long value)
+{
+	if (value < 0)
+	{
+		buf[0] = '-';
+		pf_utoa(buf + 1, 0ULL - (unsigned long long)value, 10, 0);
+	}
+	else
+		pf_utoa(buf, value, 10, 0);
+}
+
+/**
+ * @brief Stores a value in a shell variable.
+ * @param name Variable name.
+ * @param value Value to store in decimal.
+ */
+void	arith_set_var(const char *name, long long value)
+{
+	char	buf[PF_NUM_BUF];
+
+	arith_lltoa(buf, value);
+	if (set_env_value(name, buf) == -1)
+		ft_putstr_fd("minishell: arithmetic: allocation failed\n", 2);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_index.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 08:36:14 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the command index of the shell.
+ * @return Index state of the current shell context.
+ */
+t_cmd_index	*get_cmd_index(void)
+{
+	return (&get_shell_ctx()->cmd_index);
+}
+
+/**
+ * @brief Returns a string of a mapped index entry.
+ * @param i Entry number.
+ * @param path 1 for the full path, 0 for the command name.
+ * @return The string, or the empty string closing the pool if the offset
+ * lies outside it.
+ */
+const char	*cmd_index_str(size_t i, int path)
+{
+	t_cmd_index	*idx;
+	uint32_t	off;
+
+	idx = get_cmd_index();
+	off = idx->entries[i].name;
+	if (path)
+		off = idx->entries[i].path;
+	if (off >= idx->pool_len)
+		off = idx->pool_len - 1;
+	return (idx->pool + off);
+}
+
+/**
+ * @brief Looks a command name up in the command index.
+ * @param name Command name, without '/'.
+ * @return Allocated full path of the first match along PATH, or NULL when
+ * there is no index or no usable entry (the caller then probes PATH).
+ * @note A binary search over the mapped entries; the one access() call
+ * catches an executable removed since the index was validated.
+ */
+char	*cmd_index_find(const char *name)
+{
+	size_t	lo;
+	size_t	hi;
+	size_t	mid;
+	int		cmp;
+
+	cmd_index_sync();
+	lo = 0;
+	hi = get_cmd_index()->count;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		cmp = ft_strcmp(cmd_index_str(mid, 0), name);
+		if (cmp < 0)
+			lo = mid + 1;
+		else if (cmp > 0)
+			hi = mid;
+		else if (access(cmd_index_str(mid, 1), X_OK) == 0)
+			return (ft_strdup(cmd_index_str(mid, 1)));
+		else
+			return (NULL);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Asks for the index to be validated again.
+ * @note Called for each input line, so a directory changed between two
+ * lines is noticed. A PATH that could not be indexed is not retried until
+ * PATH changes, sparing every line a full scan.
+ */
+void	cmd_index_expire(void)
+{
+	t_cmd_index	*idx;
+
+	idx = get_cmd_index();
+	if (idx->map)
+		idx->checked = 0;
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_index_build.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 08:36:14 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Adds the executables of one PATH directory to a rebuild.
+ * @param b Rebuild state.
+ * @param i Position of the directory in PATH.
+ * @note Each name is tagged with `i` in fixed-width digits, so after
+ * sorting the copies of a name sit together, earliest directory first.
+ */
+void	cmd_index_scan(t_idx_build *b, size_t i)
+{
+	t_dirscan	ds;
+	t_dirent64	*ent;
+	char		tag[6];
+
+	tag[0] = CMD_INDEX_SEP;
+	tag[1] = '0' + i / 1000;
+	tag[2] = '0' + i / 100 % 10;
+	tag[3] = '0' + i / 10 % 10;
+	tag[4] = '0' + i % 10;
+	tag[5] = '\0';
+	if (dirscan_open(&ds, b->dirs[i]) == -1)
+		return ;
+	ent = dirscan_next(&ds);
+	while (ent && !b->names.failed)
+	{
+		if (ent->type != DT_DIR && !ft_strchr(ent->name, CMD_INDEX_SEP)
+			&& faccessat(ds.fd, ent->name, X_OK, 0) == 0)
+			strvec_push(&b->names, ft_strjoin(ent->name, tag));
+		ent = dirscan_next(&ds);
+	}
+	dirscan_close(&ds);
+}
+
+/**
+ * @brief Fills the string pool and entries from the sorted names.
+ * @param b Rebuild state, `names` sorted.
+ * @param pool String pool, already holding the PATH value.
+ * @param ents Receives one entry per distinct name.
+ * @return Number of entries written.
+ * @note Only the first copy of a name is kept, as PATH lookup would. The
+ * name is stored once, as the tail of its full path.
+ */
+size_t	cmd_index_pool(t_idx_build *b, t_strbuf *pool, t_idx_entry *ents)
+{
+	char	*item;
+	char	*dir;
+	size_t	len;
+	size_t	i;
+	size_t	m;
+
+	m = 0;
+	i = 0;
+	while (i < b->names.len)
+	{
+		item = b->names.items[i];
+		len = ft_strchr(item, CMD_INDEX_SEP) - item;
+		if (!i || ft_strncmp(b->names.items[i - 1], item, len + 1))
+		{
+			ents[m].path = pool->len;
+			dir = b->dirs[ft_atoi(item + len + 1)];
+			sb_append(pool, dir, ft_strlen(dir));
+			sb_putc(pool, '/');
+			ents[m++].name = pool->len;
+			sb_append(pool, item, len);
+			sb_putc(pool, '\0');
+		}
+		i++;
+	}
+	return (m);
+}
+
+/**
+ * @brief Lays a rebuild out in the on-disk index format.
+ * @param b Rebuild state, `names` sorted.
+ * @param out Receives the file contents.
+ * @return 0 on success, -1 on allocation failure.
+ * @note The header, the directory times, the entries, then the string
+ * pool; offsets are 32-bit, so a pool past 4 GiB is refused.
+ */
+int	cmd_index_serialize(t_idx_build *b, t_strbuf *out)
+{
+	t_idx_head	head;
+	t_idx_entry	*ents;
+	t_strbuf	pool;
+
+	ents = malloc(sizeof(t_idx_entry) * (b->names.len + 1));
+	if (!ents)
+		return (-1);
+	sb_init(&pool);
+	sb_append(&pool, b->path, ft_strlen(b->path) + 1);
+	ft_bzero(&head, sizeof(head));
+	ft_memcpy(head.magic, CMD_INDEX_MAGIC, sizeof(head.magic));
+	head.ndirs = b->ndirs;
+	head.count = cmd_index_pool(b, &pool, ents);
+	head.pool_len = pool.len;
+	head.size = sizeof(head) + b->ndirs * sizeof(struct timespec)
+		+ head.count * sizeof(t_idx_entry) + pool.len;
+	sb_append(out, (char *)&head, sizeof(head));
+	sb_append(out, (char *)b->stamps, b->ndirs * sizeof(struct timespec));
+	sb_append(out, (char *)ents, head.count * sizeof(t_idx_entry));
+	sb_append(out, pool.data, pool.len);
+	free(ents);
+	if (pool.failed || pool.len > UINT32_MAX)
+		out->failed = 1;
+	sb_free(&pool);
+	return (-out->failed);
+}
+
+/**
+ * @brief Scans PATH and writes a fresh index file.
+ * @param b Rebuild state with `path`, `dirs`, `ndirs` and `stamps` set.
+ * @param file Index file name.
+ * @return 0 on success, -1 on failure.
+ */
+int	cmd_index_build(t_idx_build *b, const char *file)
+{
+	t_strbuf	data;
+	size_t		i;
+	int			ret;
+
+	i = 0;
+	while (i < b->ndirs)
+		cmd_index_scan(b, i++);
+	str_sort(b->names.items, b->names.len);
+	sb_init(&data);
+	ret = -1;
+	if (!b->names.failed)
+		ret = cmd_index_serialize(b, &data);
+	if (ret == 0)
+	{
+		cmd_index_mkdirs(file);
+		ret = sb_replace_file(&data, file, 0644);
+	}
+	sb_free(&data);
+	strvec_free(&b->names);
+	return (ret);
+}
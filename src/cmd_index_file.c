@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_index_file.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 08:36:14 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Hashes a PATH value into the name of its index file.
+ * @param path PATH value.
+ * @param hex Receives 16 hex digits and a NUL.
+ * @note 64-bit FNV-1a, so each distinct PATH gets its own file.
+ */
+void	cmd_index_hash(const char *path, char hex[17])
+{
+	uint64_t	h;
+	int			i;
+
+	h = 14695981039346656037ULL;
+	while (*path)
+		h = (h ^ (unsigned char)*path++) * 1099511628211ULL;
+	i = 16;
+	hex[i] = '\0';
+	while (i--)
+	{
+		hex[i] = "0123456789abcdef"[h & 15];
+		h >>= 4;
+	}
+}
+
+/**
+ * @brief Builds the index file name for a PATH value.
+ * @param path PATH value.
+ * @return Allocated "$XDG_CACHE_HOME/minishell/cmdindex-<hash>" (with
+ * "$HOME/.cache" when XDG_CACHE_HOME is unset or relative), or NULL.
+ */
+char	*cmd_index_file(const char *path)
+{
+	const char	*base;
+	char		*dir;
+	char		*file;
+	char		hex[17];
+
+	base = env_value("XDG_CACHE_HOME");
+	dir = NULL;
+	if (base && *base == '/')
+		dir = ft_strjoin(base, "/minishell");
+	else if (env_value("HOME") && *env_value("HOME") == '/')
+		dir = ft_strjoin(env_value("HOME"), "/.cache/minishell");
+	if (!dir)
+		return (NULL);
+	cmd_index_hash(path, hex);
+	file = ft_strjoin3(dir, "/cmdindex-", hex);
+	free(dir);
+	return (file);
+}
+
+/**
+ * @brief Creates the directory of an index file and its parent.
+ * @param file Index file name.
+ * @note Errors are left for the write to report; only the cache
+ * directory itself may be missing one level up.
+ */
+void	cmd_index_mkdirs(const char *file)
+{
+	char	*dir;
+	char	*slash;
+
+	dir = ft_strdup(file);
+	if (!dir)
+		return ;
+	slash = ft_strrchr(dir, '/');
+	if (slash && slash != dir)
+	{
+		*slash = '\0';
+		if (mkdir(dir, 0700) == -1 && errno == ENOENT)
+		{
+			slash = ft_strrchr(dir, '/');
+			*slash = '\0';
+			mkdir(dir, 0700);
+			*slash = '/';
+			mkdir(dir, 0700);
+		}
+	}
+	free(dir);
+}
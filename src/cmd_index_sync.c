@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_index_sync.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 08:36:14 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Drops the mapping of the command index.
+ * @param idx Command index.
+ */
+void	cmd_index_unmap(t_cmd_index *idx)
+{
+	if (idx->map)
+		munmap(idx->map, idx->size);
+	free(idx->path);
+	idx->path = NULL;
+	idx->map = NULL;
+	idx->size = 0;
+	idx->count = 0;
+}
+
+/**
+ * @brief Maps an index file read-only.
+ * @param idx Command index, unmapped.
+ * @param file Index file name.
+ * @return 0 on success, -1 if the file is missing or too short.
+ * @note The pages are shared with every shell mapping the same file. The
+ * views are only trusted once cmd_index_valid has checked the layout.
+ */
+int	cmd_index_map(t_cmd_index *idx, const char *file)
+{
+	struct stat	st;
+	t_idx_head	*head;
+	size_t		off;
+	int			fd;
+
+	fd = open(file, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (-1);
+	head = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && (size_t)st.st_size > sizeof(t_idx_head))
+		head = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (head == MAP_FAILED)
+		return (-1);
+	idx->map = (unsigned char *)head;
+	idx->size = st.st_size;
+	off = sizeof(t_idx_head) + head->ndirs * sizeof(struct timespec);
+	idx->entries = (const t_idx_entry *)(idx->map + off);
+	off += head->count * sizeof(t_idx_entry);
+	idx->count = head->count;
+	idx->pool = (const char *)idx->map + off;
+	idx->pool_len = idx->size - off;
+	return (0);
+}
+
+/**
+ * @brief Tells whether a mapped index is well formed and describes PATH.
+ * @param idx Mapped command index.
+ * @param b PATH value, directories and their current times.
+ * @return 1 if the layout holds and the PATH value and every directory
+ * time match.
+ * @note The pool must end with a NUL so no string runs past the file.
+ */
+int	cmd_index_valid(t_cmd_index *idx, t_idx_build *b)
+{
+	t_idx_head	*head;
+
+	head = (t_idx_head *)idx->map;
+	if (ft_memcmp(head->magic, CMD_INDEX_MAGIC, sizeof(head->magic))
+		|| head->size != idx->size || idx->pool_len >= idx->size
+		|| head->pool_len != idx->pool_len || !idx->pool_len
+		|| idx->map[idx->size - 1])
+		return (0);
+	if (head->ndirs != b->ndirs || ft_strcmp(idx->pool, b->path))
+		return (0);
+	return (!ft_memcmp(idx->map + sizeof(t_idx_head), b->stamps,
+			b->ndirs * sizeof(struct timespec)));
+}
+
+/**
+ * @brief Splits PATH and reads its directory times for the index.
+ * @param b Rebuild state with `path` set; the rest is initialised.
+ * @return 0 on success, -1 if PATH cannot be indexed.
+ * @note A relative directory depends on the working directory, so a
+ * PATH holding one is left to the plain search.
+ */
+int	cmd_index_dirs(t_idx_build *b)
+{
+	b->dirs = ft_split(b->path, ':');
+	b->ndirs = 0;
+	b->stamps = NULL;
+	ft_bzero(&b->names, sizeof(t_strvec));
+	while (b->dirs && b->dirs[b->ndirs] && b->dirs[b->ndirs][0] == '/')
+		b->ndirs++;
+	if (b->dirs && !b->dirs[b->ndirs] && b->ndirs
+		&& b->ndirs <= CMD_INDEX_MAX_DIRS)
+		b->stamps = complete_stamps(b->dirs, b->ndirs);
+	if (b->stamps)
+		return (0);
+	ft_free_array(b->dirs);
+	return (-1);
+}
+
+/**
+ * @brief Makes the mapped index match the current PATH.
+ * @note Runs once per input line, or again when PATH changes. A missing,
+ * malformed or stale file (a PATH directory changed since it was written)
+ * is rebuilt. Nothing is mapped unless CMD_INDEX_ENV is set.
+ */
+void	cmd_index_sync(void)
+{
+	t_cmd_index	*idx;
+	t_idx_build	b;
+	char		*file;
+
+	idx = get_cmd_index();
+	b.path = env_value("PATH");
+	if (idx->checked && idx->path && b.path && !ft_strcmp(idx->path, b.path))
+		return ;
+	cmd_index_unmap(idx);
+	idx->checked = 1;
+	if (!b.path || !env_value(CMD_INDEX_ENV) || !*env_value(CMD_INDEX_ENV)
+		|| cmd_index_dirs(&b) == -1)
+		return ;
+	file = cmd_index_file(b.path);
+	if (file && (cmd_index_map(idx, file) || !cmd_index_valid(idx, &b)))
+	{
+		cmd_index_unmap(idx);
+		if (cmd_index_build(&b, file) == 0 && cmd_index_map(idx, file) == 0
+			&& !cmd_index_valid(idx, &b))
+			cmd_index_unmap(idx);
+	}
+	idx->path = ft_strdup(b.path);
+	free(file);
+	ft_free_array(b.dirs);
+	free(b.stamps);
+}
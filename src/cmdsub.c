@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmdsub.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:21:44 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:42:10 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Expands `$(...)` and appends the captured output.
+ * @param input String being expanded.
+ * @param i Index of the '$'; moved past the closing ')'.
+ * @param out Expansion built so far; the output is captured straight
+ * into it.
+ * @note Trailing newlines of the output are removed. Nothing runs once
+ * an earlier expansion of the same command has failed.
+ */
+void	expand_cmdsub(const char *input, size_t *i, t_strbuf *out)
+{
+	size_t	end;
+	size_t	start;
+	char	*body;
+
+	end = match_group_end(input, *i + 1);
+	if (!end)
+	{
+		sb_putc(out, input[(*i)++]);
+		return ;
+	}
+	body = ft_calloc(end - *i - 1, 1);
+	if (body)
+		ft_memcpy(body, input + *i + 2, end - *i - 2);
+	*i = end + 1;
+	start = out->len;
+	if (body && !*expand_error_flag())
+		cmdsub_capture(body, out);
+	free(body);
+	while (out->len > start && out->data[out->len - 1] == '\n')
+		out->data[--out->len] = '\0';
+}
+
+/**
+ * @brief Runs a substituted command and collects its standard output.
+ * @param body Command text between the parentheses.
+ * @param out Receives the output.
+ * @note `$(< file)` reads the file directly and a lone echo, pwd or
+ * printf runs in the shell itself; anything else runs in a subshell.
+ */
+void	cmdsub_capture(const char *body, t_strbuf *out)
+{
+	while (ft_isspace(*body))
+		body++;
+	if (body[0] == '<' && body[1] != '<')
+		cmdsub_read_file(body + 1, out);
+	else if (!cmdsub_fast_path(body) || cmdsub_builtin(body, out) == -1)
+		cmdsub_fork(body, out);
+}
+
+/**
+ * @brief Implements `$(< file)` without starting a process.
+ * @param spec Text after the '<' (the file name, possibly with spaces
+ * and variables).
+ * @param out Receives the file contents.
+ */
+void	cmdsub_read_file(const char *spec, t_strbuf *out)
+{
+	char	*trimmed;
+	char	*path;
+	int		fd;
+
+	trimmed = ft_strtrim(spec, " \t\n");
+	path = NULL;
+	if (trimmed)
+		path = expand_variables(trimmed);
+	free(trimmed);
+	if (!path)
+		return ;
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1 || sb_read_fd(out, fd) == -1)
+	{
+		ft_putstr_fd("minishell: ", STDERR_FILENO);
+		perror(path);
+		set_exit_status(1);
+	}
+	else
+		set_exit_status(0);
+	if (fd != -1)
+		close(fd);
+	free(path);
+}
+
+/**
+ * @brief Tells whether a command line is free of pipes, lists and
+ * redirections.
+ * @param s Command text.
+ * @return 1 if the text is a single simple command.
+ */
+int	cmdsub_is_simple(const char *s)
+{
+	size_t	i;
+	char	quote;
+
+	i = 0;
+	quote = 0;
+	while (s[i])
+	{
+		if (s[i] == '\\' && s[i + 1] && quote != '\'')
+			i++;
+		else if (quote && s[i] == quote)
+			quote = 0;
+		else if (!quote && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (quote != '\'' && s[i] == '$'
+			&& (s[i + 1] == '(' || s[i + 1] == '{'))
+		{
+			i = match_group_end(s, i + 1);
+			if (!i)
+				return (0);
+		}
+		else if (!quote && ft_strchr("|;<>&()`", s[i]))
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Tells whether a substitution can run in-process.
+ * @param body Command text (leading blanks skipped).
+ * @return 1 for a simple echo, pwd or printf command.
+ */
+int	cmdsub_fast_path(const char *body)
+{
+	size_t	len;
+
+	len = 0;
+	while (body[len] && !ft_isspace(body[len]))
+		len++;
+	if (!((len == 4 && !ft_strncmp(body, "echo", 4))
+			|| (len == 3 && !ft_strncmp(body, "pwd", 3))
+			|| (len == 6 && !ft_strncmp(body, "printf", 6))))
+		return (0);
+	return (cmdsub_is_simple(body + len));
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmdsub_exec.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:21:44 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 05:07:33 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Runs a simple echo, pwd or printf with stdout on a memfd.
+ * @param body Command text.
+ * @param out Receives the output.
+ * @return 0 if the command was handled, -1 if it must run in a subshell
+ * (no memfd available; nothing has been evaluated yet).
+ * @note Unlike a subshell, side effects of its expansions (such as
+ * `${x:=v}`) are kept. The builtin writes through its descriptor map,
+ * so the shell's stdout is never touched.
+ */
+int	cmdsub_builtin(const char *body, t_strbuf *out)
+{
+	t_parse	parser;
+	t_cmd	*cmd;
+	int		fd;
+
+	fd = memfd_create("minishell_cmdsub", MFD_CLOEXEC);
+	if (fd == -1)
+		return (-1);
+	cmd = parse_and_validate_pipeline((char *)body, &parser);
+	if (cmd && cmd->args && cmd->args[0])
+	{
+		builtin_fds()[STDOUT_FILENO] = fd;
+		set_exit_status(exec_builtin(cmd->args));
+		builtin_fds()[STDOUT_FILENO] = STDOUT_FILENO;
+		lseek(fd, 0, SEEK_SET);
+		sb_read_fd(out, fd);
+	}
+	procsub_claim(cmd, NULL);
+	free_pipeline(cmd);
+	close(fd);
+	return (0);
+}
+
+/**
+ * @brief Child side of a command substitution: runs the text as a
+ * command list with stdout on the capture fd.
+ * @param body Command text.
+ * @param fds Capture descriptors from heredoc_open.
+ */
+void	cmdsub_child(const char *body, int fds[2])
+{
+	close(fds[0]);
+	if (dup2(fds[1], STDOUT_FILENO) == -1)
+		exit(EXIT_FAILURE);
+	close(fds[1]);
+	run_subshell(body);
+}
+
+/**
+ * @brief Waits for the substitution child and records its status.
+ * @param pid Child process.
+ */
+void	cmdsub_wait(pid_t pid)
+{
+	int	status;
+
+	status = -1;
+	evloop_reap(&pid, &status, 1);
+	if (status == -1)
+		set_exit_status(1);
+	else
+		set_exit_status(child_status(status, NULL));
+}
+
+/**
+ * @brief Runs a command substitution in a subshell.
+ * @param body Command text.
+ * @param out Receives the output.
+ * @note Output goes to a memfd that is read once the child is done;
+ * without memfd it goes to a pipe drained while the child runs.
+ */
+void	cmdsub_fork(const char *body, t_strbuf *out)
+{
+	int		fds[2];
+	pid_t	pid;
+
+	if (heredoc_open(fds) == -1)
+		return ;
+	pid = fork();
+	if (pid == 0)
+		cmdsub_child(body, fds);
+	close(fds[1]);
+	if (pid != -1)
+	{
+		if (lseek(fds[0], 0, SEEK_CUR) == -1)
+			sb_read_fd(out, fds[0]);
+		cmdsub_wait(pid);
+		if (lseek(fds[0], 0, SEEK_SET) == 0)
+			sb_read_fd(out, fds[0]);
+	}
+	else
+		perror("minishell: fork");
+	close(fds[0]);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   complete.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 07:22:06 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reads the modification time of each PATH directory.
+ * @param dirs PATH directories.
+ * @param n Number of directories.
+ * @return Array of `n` times (zero for a missing directory), or NULL on
+ * allocation failure.
+ */
+struct timespec	*complete_stamps(char **dirs, size_t n)
+{
+	struct timespec	*stamps;
+	struct stat		st;
+	size_t			i;
+
+	stamps = ft_calloc(n + 1, sizeof(struct timespec));
+	if (!stamps)
+		return (NULL);
+	i = 0;
+	while (i < n)
+	{
+		if (stat(dirs[i], &st) == 0)
+			stamps[i] = st.st_mtim;
+		i++;
+	}
+	return (stamps);
+}
+
+/**
+ * @brief Adds the executables of one directory to the command trie.
+ * @param trie Command trie.
+ * @param dir Directory to scan.
+ * @note Entries come from getdents64; directories are skipped by their
+ * type and execute permission is checked relative to the open directory.
+ */
+void	complete_scan_dir(t_trie *trie, const char *dir)
+{
+	t_dirscan	ds;
+	t_dirent64	*ent;
+
+	if (dirscan_open(&ds, dir) == -1)
+		return ;
+	ent = dirscan_next(&ds);
+	while (ent)
+	{
+		if (ent->type != DT_DIR
+			&& faccessat(ds.fd, ent->name, X_OK, 0) == 0)
+			trie_insert(trie, ent->name);
+		ent = dirscan_next(&ds);
+	}
+	dirscan_close(&ds);
+}
+
+/**
+ * @brief Builds the trie of builtins and PATH executables.
+ * @param dirs PATH directories.
+ * @return The trie, or NULL on allocation failure.
+ */
+t_trie	*complete_build(char **dirs)
+{
+	const t_builtin	*builtins;
+	t_trie			*trie;
+
+	trie = trie_node("", 0);
+	if (!trie)
+		return (NULL);
+	builtins = builtin_table();
+	while (builtins->name)
+		trie_insert(trie, (builtins++)->name);
+	while (*dirs)
+		complete_scan_dir(trie, *dirs++);
+	return (trie);
+}
+
+/**
+ * @brief Records what a new command trie was built from.
+ * @param c Completion caches.
+ * @param path PATH value.
+ * @param stamps Directory times (ownership is taken).
+ * @param n Number of directories.
+ */
+void	complete_store(t_complete *c, const char *path,
+	struct timespec *stamps, size_t n)
+{
+	free(c->path);
+	free(c->stamps);
+	c->path = ft_strdup(path);
+	c->stamps = stamps;
+	c->ndirs = n;
+}
+
+/**
+ * @brief Returns the command trie, rebuilding it if PATH changed.
+ * @param c Completion caches.
+ * @return The trie, or NULL if it could not be built.
+ * @note Each call costs one stat per PATH directory; the directories are
+ * only read again when PATH or one of their modification times changed.
+ */
+t_trie	*complete_refresh(t_complete *c)
+{
+	const char		*path;
+	char			**dirs;
+	struct timespec	*stamps;
+	size_t			n;
+
+	path = env_value("PATH");
+	if (!path)
+		path = "";
+	dirs = ft_split(path, ':');
+	n = 0;
+	while (dirs && dirs[n])
+		n++;
+	stamps = complete_stamps(dirs, n);
+	if (dirs && stamps && (!c->commands || !c->path || n != c->ndirs
+			|| ft_strcmp(path, c->path)
+			|| ft_memcmp(stamps, c->stamps, n * sizeof(*stamps))))
+	{
+		trie_free(c->commands);
+		c->commands = complete_build(dirs);
+		complete_store(c, path, stamps, n);
+		stamps = NULL;
+	}
+	free(stamps);
+	ft_free_array(dirs);
+	return (c->commands);
+}
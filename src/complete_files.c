@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   complete_files.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 07:22:06 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 18:01:30 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reads the entries of a directory into the listing cache.
+ * @param c Completion caches.
+ * @param ds Open scanner on the directory (closed here).
+ * @param dir Directory ("" or ending with '/').
+ * @return 0 on success, -1 on allocation failure.
+ * @note Only symlinks and entries of unknown type cost a stat to find
+ * out whether they are directories.
+ */
+int	complete_fill(t_complete *c, t_dirscan *ds, const char *dir)
+{
+	t_dirent64	*ent;
+	char		*path;
+	int			is_dir;
+
+	ent = dirscan_next(ds);
+	while (ent && !c->files.failed)
+	{
+		is_dir = (ent->type == DT_DIR);
+		if (ent->type == DT_LNK || ent->type == DT_UNKNOWN)
+		{
+			path = dirscan_path(dir, ft_strlen(dir), ent->name);
+			is_dir = (path && dirent_is_dir(path, ent));
+			free(path);
+		}
+		if (ft_strcmp(ent->name, ".") && ft_strcmp(ent->name, "..")
+			&& is_dir)
+			strvec_push(&c->files, ft_strjoin(ent->name, "/"));
+		else if (ft_strcmp(ent->name, ".") && ft_strcmp(ent->name, ".."))
+			strvec_push(&c->files, ft_strdup(ent->name));
+		ent = dirscan_next(ds);
+	}
+	dirscan_close(ds);
+	return (-c->files.failed);
+}
+
+/**
+ * @brief Returns the entries of a directory, from the cache if unchanged.
+ * @param dir Directory ("" or ending with '/').
+ * @return The cached listing, or NULL if the directory cannot be read.
+ * @note Pressing Tab again in the same directory costs an open and an
+ * fstat: the directory is only read again once its time changes.
+ */
+t_strvec	*complete_listing(const char *dir)
+{
+	t_complete	*c;
+	t_dirscan	ds;
+	struct stat	st;
+
+	c = get_complete();
+	if (dirscan_open(&ds, dir) == -1)
+		return (NULL);
+	if (fstat(ds.fd, &st) == 0 && c->dir && !ft_strcmp(c->dir, dir)
+		&& !ft_memcmp(&st.st_mtim, &c->dir_stamp, sizeof(st.st_mtim)))
+	{
+		dirscan_close(&ds);
+		return (&c->files);
+	}
+	strvec_free(&c->files);
+	c->files.failed = 0;
+	free(c->dir);
+	c->dir = ft_strdup(dir);
+	c->dir_stamp = st.st_mtim;
+	if (!c->dir || complete_fill(c, &ds, dir) == -1)
+	{
+		free(c->dir);
+		c->dir = NULL;
+		return (NULL);
+	}
+	return (&c->files);
+}
+
+/**
+ * @brief Completes a path.
+ * @param text Word being completed, backslashes included.
+ * @param out Receives the matching paths, quoted (see complete_escape).
+ */
+void	complete_files(const char *text, t_strvec *out)
+{
+	char	*path;
+
+	path = complete_unescape(text);
+	if (path)
+		complete_paths(path, out);
+	free(path);
+}
+
+/**
+ * @brief Lists the paths starting with a prefix.
+ * @param path Prefix, without quoting.
+ * @param out Receives the matching paths, quoted.
+ * @note Hidden entries are only offered once the name starts with '.'.
+ */
+void	complete_paths(const char *path, t_strvec *out)
+{
+	const char	*base;
+	char		*dir;
+	t_strvec	*names;
+	size_t		i;
+
+	base = ft_strrchr(path, '/');
+	if (base)
+		base++;
+	else
+		base = path;
+	dir = ft_substr(path, 0, base - path);
+	names = NULL;
+	if (dir)
+		names = complete_listing(dir);
+	i = 0;
+	while (names && i < names->len)
+	{
+		if (!ft_strncmp(names->items[i], base, ft_strlen(base))
+			&& (names->items[i][0] != '.' || base[0] == '.'))
+			strvec_push(out, complete_escape(dir, names->items[i]));
+		i++;
+	}
+	free(dir);
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   complete_match.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 07:22:06 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the completion caches.
+ * @return Completion caches of the current shell context.
+ */
+t_complete	*get_complete(void)
+{
+	return (&get_shell_ctx()->complete);
+}
+
+/**
+ * @brief Frees the completion caches.
+ * @param c Completion caches, left empty.
+ */
+void	complete_free(t_complete *c)
+{
+	trie_free(c->commands);
+	strvec_free(&c->files);
+	free(c->path);
+	free(c->stamps);
+	free(c->dir);
+	ft_bzero(c, sizeof(t_complete));
+}
+
+/**
+ * @brief Completes a command name.
+ * @param text Word being completed.
+ * @param out Receives the builtins and PATH executables it starts.
+ * @note A lookup walks the trie down to the prefix, then lists only the
+ * names below it, however many executables PATH holds.
+ */
+void	complete_commands(const char *text, t_strvec *out)
+{
+	t_trie		*trie;
+	t_strbuf	path;
+
+	trie = complete_refresh(get_complete());
+	if (!trie)
+		return ;
+	sb_init(&path);
+	trie = trie_find(trie, text, &path);
+	if (trie)
+		trie_collect(trie, &path, out);
+	sb_free(&path);
+}
+
+/**
+ * @brief Completes the name of an exported variable after '$'.
+ * @param text Word being completed, without the '$'.
+ * @param out Receives the matching names.
+ */
+void	complete_vars(const char *text, t_strvec *out)
+{
+	char	**env;
+	size_t	tlen;
+	char	*eq;
+	int		i;
+
+	env = *get_env();
+	tlen = ft_strlen(text);
+	i = 0;
+	while (env && env[i])
+	{
+		eq = ft_strchr(env[i], '=');
+		if (eq && (size_t)(eq - env[i]) >= tlen
+			&& !ft_strncmp(env[i], text, tlen))
+			strvec_push(out, ft_substr(env[i], 0, eq - env[i]));
+		i++;
+	}
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   complete_quote.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:58:12 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:58:12 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells readline whether a character of the line is quoted.
+ * @param line Line being edited.
+ * @param index Offset of the character.
+ * @return 1 if an odd number of backslashes precedes it.
+ * @note Installed as rl_char_is_quoted_p, so `my\ fi` is one word to
+ * complete instead of ending at the space.
+ */
+int	complete_char_quoted(char *line, int index)
+{
+	int	n;
+
+	n = 0;
+	while (index - n > 0 && line[index - n - 1] == '\\')
+		n++;
+	return (n % 2);
+}
+
+/**
+ * @brief Removes the backslashes of a word being completed.
+ * @param text Word as typed.
+ * @return The word as a path, NULL on allocation failure.
+ */
+char	*complete_unescape(const char *text)
+{
+	t_strbuf	sb;
+	size_t		i;
+
+	sb_init(&sb);
+	i = 0;
+	while (text[i])
+	{
+		if (text[i] == '\\')
+			i++;
+		if (text[i])
+			sb_putc(&sb, text[i++]);
+	}
+	return (sb_detach(&sb));
+}
+
+/**
+ * @brief Appends a path with its special characters backslashed.
+ * @param sb Destination buffer.
+ * @param s Path.
+ */
+void	complete_escape_to(t_strbuf *sb, const char *s)
+{
+	while (*s)
+	{
+		if (ft_strchr(COMPLETE_QUOTE_CHARS, *s))
+			sb_putc(sb, '\\');
+		sb_putc(sb, *s++);
+	}
+}
+
+/**
+ * @brief Builds a completed path as it goes into the command line.
+ * @param dir Directory part ("" or ending with '/').
+ * @param name Entry in that directory.
+ * @return `dir` and `name` with blanks and shell metacharacters quoted
+ * by backslashes, as readline's rl_filename_quoting_function would;
+ * NULL on allocation failure.
+ */
+char	*complete_escape(const char *dir, const char *name)
+{
+	t_strbuf	sb;
+
+	sb_init(&sb);
+	complete_escape_to(&sb, dir);
+	complete_escape_to(&sb, name);
+	return (sb_detach(&sb));
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   complete_rl.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 07:22:06 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 07:22:06 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a word is in command position.
+ * @param line Line being edited.
+ * @param start Offset of the word in the line.
+ * @return 1 at the start of the line or after '|', ';', '&' or '('.
+ */
+int	complete_command_position(const char *line, int start)
+{
+	while (start > 0 && (line[start - 1] == ' ' || line[start - 1] == '\t'))
+		start--;
+	return (start == 0 || ft_strchr("|;&(", line[start - 1]) != NULL);
+}
+
+/**
+ * @brief Computes the longest common prefix of the matches.
+ * @param v Matches (at least one).
+ * @return Length of the prefix shared by every match.
+ */
+size_t	complete_lcd(t_strvec *v)
+{
+	size_t	lcd;
+	size_t	i;
+	size_t	k;
+
+	lcd = ft_strlen(v->items[0]);
+	i = 1;
+	while (i < v->len)
+	{
+		k = 0;
+		while (k < lcd && v->items[i][k] == v->items[0][k])
+			k++;
+		lcd = k;
+		i++;
+	}
+	return (lcd);
+}
+
+/**
+ * @brief Turns the matches into the array readline expects.
+ * @param v Matches (emptied).
+ * @return NULL without matches, otherwise the longest common prefix
+ * followed by the matches (just the match when there is only one).
+ */
+char	**complete_matches(t_strvec *v)
+{
+	char	**m;
+
+	if (v->len == 1 && !v->failed)
+		return (strvec_finish(v));
+	m = NULL;
+	if (v->len > 1 && !v->failed)
+		m = malloc(sizeof(char *) * (v->len + 2));
+	if (m)
+		m[0] = ft_substr(v->items[0], 0, complete_lcd(v));
+	if (!m || !m[0])
+	{
+		free(m);
+		strvec_free(v);
+		return (NULL);
+	}
+	ft_memcpy(m + 1, v->items, sizeof(char *) * (v->len + 1));
+	free(v->items);
+	return (m);
+}
+
+/**
+ * @brief Completion entry point installed as readline's
+ * rl_attempted_completion_function.
+ * @param text Word being completed.
+ * @param start Offset of the word in the line.
+ * @param end Offset of the cursor (unused).
+ * @return The matches, or NULL.
+ * @note Words after '$' or '${' complete variable names, words in command
+ * position complete commands, anything else (or a word with a '/')
+ * completes paths. Readline's own filename completion is never used.
+ */
+char	**complete_attempt(const char *text, int start, int end)
+{
+	t_rl_api	*rl;
+	t_strvec	out;
+	const char	*line;
+
+	(void)end;
+	rl = get_rl_api();
+	*rl->completion_over = 1;
+	ft_bzero(&out, sizeof(out));
+	line = *rl->line_buffer;
+	if ((start > 0 && line[start - 1] == '$')
+		|| (start > 1 && line[start - 1] == '{' && line[start - 2] == '$'))
+		complete_vars(text, &out);
+	else if (complete_command_position(line, start) && !ft_strchr(text, '/'))
+		complete_commands(text, &out);
+	else
+		complete_files(text, &out);
+	if (out.len == 1 && out.items[0][0]
+		&& out.items[0][ft_strlen(out.items[0]) - 1] == '/')
+		*rl->suppress_append = 1;
+	return (complete_matches(&out));
+}
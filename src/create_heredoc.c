@@ -6,61 +6,43 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 09:59:44 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/08 16:44:09 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include <minishell.h>
 
 /**
- * @brief Sets up and restores signal handling for heredoc creation.
- * @param sa Pointer to the new sigaction structure.
- * @param old_sa Pointer to the old sigaction structure to restore later.
- * @return 0 on success, -1 on failure.
- */
-int	setup_and_restore_signals(struct sigaction *sa, struct sigaction *old_sa)
-{
-	sa->sa_handler = SIG_IGN;
-	sa->sa_flags = SA_RESTART;
-	sigemptyset(&sa->sa_mask);
-	if (sigaction(SIGINT, sa, old_sa) == -1)
-		return (-1);
-	return (0);
-}
-
-/**
- * @brief Sets up a pipe and forks a child process.
- * @param pipefd Array to store the pipe file descriptors.
- * @param old_sa Pointer to the old sigaction structure to restore later.
+ * @brief Sets up the heredoc buffer and forks a child process.
+ * @param pipefd Array to store the read and write descriptors.
  * @return The PID of the child process on success, -1 on failure.
  */
-pid_t	setup_pipe_and_fork(int pipefd[2], struct sigaction *old_sa)
+pid_t	setup_pipe_and_fork(int pipefd[2])
 {
 	pid_t	pid;
 
-	if (pipe(pipefd) < 0)
+	if (heredoc_open(pipefd) < 0)
 		return (-1);
 	pid = fork();
 	if (pid == -1)
 	{
 		close(pipefd[0]);
 		close(pipefd[1]);
-		sigaction(SIGINT, old_sa, NULL);
 	}
 	return (pid);
 }
 
 /**
  * @brief Handles the child process setup for heredoc creation.
- * @param write_fd File descriptor for the write end of the pipe.
+ * @param pipefd Read and write descriptors of the heredoc buffer.
  * @param delimiter The delimiter string to terminate the heredoc.
  * @note Sets up signals and invokes the child process logic.
  */
-void	setup_child_process(int write_fd, const char *delimiter)
+void	setup_child_process(int pipefd[2], const char *delimiter)
 {
-	close(write_fd - 1);
+	close(pipefd[0]);
 	setup_heredoc_signals();
-	handle_child_process(write_fd, delimiter);
+	handle_child_process(pipefd[1], delimiter);
 }
 
 /**
@@ -77,14 +59,12 @@ int	create_heredoc(const char *delimiter)
 	pid_t				pid;
 	int					result;
 
-	if (setup_and_restore_signals(&ctx.sa, &ctx.old_sa) == -1)
-		return (-1);
-	pid = setup_pipe_and_fork(ctx.pipefd, &ctx.old_sa);
+	pid = setup_pipe_and_fork(ctx.pipefd);
 	if (pid == -1)
 		return (-1);
 	if (pid == 0)
 	{
-		setup_child_process(ctx.pipefd[1], delimiter);
+		setup_child_process(ctx.pipefd, delimiter);
 	}
 	else
 	{
@@ -92,8 +72,59 @@ int	create_heredoc(const char *delimiter)
 		result = handle_parent_process(pid, ctx.pipefd[0], &ctx.was_signaled);
 		if (ctx.was_signaled)
 			write(STDOUT_FILENO, "\n", 1);
-		sigaction(SIGINT, &ctx.old_sa, NULL);
 		return (result);
 	}
 	return (0);
 }
+
+/**
+ * @brief Opens a heredoc whose body came with the script text.
+ * @param r Heredoc redirection with a non-NULL `body`.
+ * @return Readable descriptor positioned at the start, -1 on error.
+ * @note Lines are written as handle_child_process writes those read
+ * from the input, expanded unless the delimiter was quoted. The lines
+ * are cut in place in a single copy of the body.
+ */
+int	heredoc_from_body(t_redir *r)
+{
+	int		fds[2];
+	char	*body;
+	char	*line;
+	char	*next;
+	size_t	len;
+
+	if (heredoc_open(fds) < 0)
+		return (-1);
+	body = ft_strdup(r->body);
+	line = body;
+	while (line && *line)
+	{
+		len = 0;
+		while (line[len] && line[len] != '\n')
+			len++;
+		next = line + len + (line[len] == '\n');
+		line[len] = '\0';
+		write_line_to_pipe(fds[1], line, r->heredoc_quoted);
+		line = next;
+	}
+	free(body);
+	close(fds[1]);
+	lseek(fds[0], 0, SEEK_SET);
+	return (fds[0]);
+}
+
+/**
+ * @brief Frees a t_heredoc (list content).
+ * @param content The heredoc, or NULL.
+ */
+void	heredoc_free(void *content)
+{
+	t_heredoc	*hd;
+
+	hd = content;
+	if (!hd)
+		return ;
+	free(hd->delim);
+	free(hd->body);
+	free(hd);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   evloop.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 05:07:33 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 16:11:45 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the shell's event loop state.
+ * @return Event loop of the current shell context.
+ * @note Each context waits for its own children in its own epoll
+ * instance; only the front-end's also reads signals (see evloop_init).
+ */
+t_evloop	*get_evloop(void)
+{
+	return (&get_shell_ctx()->ev);
+}
+
+/**
+ * @brief Returns the epoll instance, creating it on first use.
+ * @return The epoll descriptor, or -1 on failure.
+ * @note Forked children drop the shell's instance (see evloop_child) and
+ * get their own here, without a signalfd, the first time they wait. The
+ * descriptor is moved to FDPLAN_MIN_FD or above, out of reach of
+ * `exec 3>file` and `>&4`.
+ */
+int	evloop_epfd(void)
+{
+	t_evloop	*ev;
+	int			fd;
+
+	ev = get_evloop();
+	if (ev->epfd != -1)
+		return (ev->epfd);
+	fd = epoll_create1(EPOLL_CLOEXEC);
+	if (fd == -1)
+		return (-1);
+	ev->epfd = fcntl(fd, F_DUPFD_CLOEXEC, FDPLAN_MIN_FD);
+	close(fd);
+	return (ev->epfd);
+}
+
+/**
+ * @brief Blocks SIGINT, SIGQUIT and SIGCHLD and opens the event loop.
+ * @note Called once at startup: the signals are read from a signalfd
+ * instead of running a handler, so nothing has to switch dispositions
+ * around each command. Without signalfd, SIGINT is simply ignored. Like
+ * the epoll instance, the signalfd lives at FDPLAN_MIN_FD or above.
+ */
+void	evloop_init(void)
+{
+	t_evloop			*ev;
+	struct epoll_event	event;
+	sigset_t			set;
+	int					fd;
+
+	ev = get_evloop();
+	ev->interactive = rl_front_load();
+	setup_parent_signals();
+	shell_sigset(&set);
+	fd = signalfd(-1, &set, SFD_NONBLOCK | SFD_CLOEXEC);
+	ev->sigfd = fd;
+	if (fd != -1)
+	{
+		ev->sigfd = fcntl(fd, F_DUPFD_CLOEXEC, FDPLAN_MIN_FD);
+		close(fd);
+	}
+	event.events = EPOLLIN;
+	event.data.u32 = EV_TAG_SIGNAL;
+	if (ev->sigfd != -1 && evloop_epfd() != -1
+		&& epoll_ctl(ev->epfd, EPOLL_CTL_ADD, ev->sigfd, &event) == 0)
+		return ;
+	evloop_child();
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+}
+
+/**
+ * @brief Drops the shell's event loop in a forked child.
+ * @note The epoll instance would otherwise be shared with the shell. The
+ * child gets default, unblocked signals (see setup_child_signals).
+ */
+void	evloop_child(void)
+{
+	t_evloop	*ev;
+
+	ev = get_evloop();
+	if (ev->sigfd != -1)
+		close(ev->sigfd);
+	if (ev->epfd != -1)
+		close(ev->epfd);
+	ev->sigfd = -1;
+	ev->epfd = -1;
+	ev->interactive = 0;
+	zygote_forget();
+	setup_child_signals();
+}
+
+/**
+ * @brief Reads every signal pending on the signalfd.
+ * @return 1 if one of them was SIGINT, 0 otherwise.
+ * @note SIGQUIT and SIGCHLD are only drained: children are reaped through
+ * their pidfds.
+ */
+int	evloop_signals(void)
+{
+	struct signalfd_siginfo	info;
+	t_evloop				*ev;
+	int						interrupted;
+
+	ev = get_evloop();
+	interrupted = 0;
+	while (ev->sigfd != -1
+		&& read(ev->sigfd, &info, sizeof(info)) == sizeof(info))
+	{
+		if (info.ssi_signo == SIGINT)
+			interrupted = 1;
+	}
+	return (interrupted);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   evloop_read.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 05:07:33 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 06:14:52 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Receives a finished line from readline's callback interface.
+ * @param line Line read, or NULL on end of input.
+ * @note The handler is removed at once so the command runs with the
+ * terminal out of readline's mode.
+ */
+void	evloop_line_handler(char *line)
+{
+	t_evloop	*ev;
+
+	ev = get_evloop();
+	get_rl_api()->handler_remove();
+	ev->line = line;
+	ev->line_done = 1;
+}
+
+/**
+ * @brief Handles Ctrl+C at the prompt.
+ * @note Runs from the event loop rather than a signal handler, so the
+ * readline calls are safe. The partial line is dropped and $? becomes 130.
+ */
+void	evloop_on_sigint(void)
+{
+	t_rl_api	*rl;
+
+	rl = get_rl_api();
+	set_exit_status(130);
+	rl->echo_signal_char(SIGINT);
+	rl->crlf();
+	rl->sigcleanup();
+	rl->replace_line("", 0);
+	rl->on_new_line();
+	rl->redisplay();
+}
+
+/**
+ * @brief Waits for one round of events while a line is being typed.
+ * @param ev Event loop state.
+ * @note If epoll itself fails, readline just reads the next character.
+ */
+void	evloop_read_step(t_evloop *ev)
+{
+	struct epoll_event	events[EVLOOP_MAX_EVENTS];
+	int					n;
+
+	n = epoll_wait(ev->epfd, events, EVLOOP_MAX_EVENTS, -1);
+	if (n == -1 && errno != EINTR)
+		get_rl_api()->read_char();
+	while (n-- > 0 && !ev->line_done)
+	{
+		if (events[n].data.u32 == EV_TAG_SIGNAL && evloop_signals())
+			evloop_on_sigint();
+		else if (events[n].data.u32 == EV_TAG_STDIN)
+			get_rl_api()->read_char();
+	}
+}
+
+/**
+ * @brief Reads a line, like readline, from inside the event loop.
+ * @param prompt Prompt to display.
+ * @return The line (to be freed), or NULL on end of input.
+ * @note Standard input is only watched while the prompt is up, so typing
+ * ahead during a command never wakes the wait for its children. Input
+ * that is no longer a terminal, or cannot be polled, goes through plain
+ * readline. Only called once readline is loaded (see shell_readline).
+ */
+char	*evloop_readline(const char *prompt)
+{
+	t_evloop			*ev;
+	struct epoll_event	event;
+
+	ev = get_evloop();
+	event.events = EPOLLIN;
+	event.data.u32 = EV_TAG_STDIN;
+	if (ev->sigfd == -1 || !ev->interactive
+		|| epoll_ctl(ev->epfd, EPOLL_CTL_ADD, STDIN_FILENO, &event) == -1)
+		return (get_rl_api()->readline(prompt));
+	ev->line = NULL;
+	ev->line_done = 0;
+	get_rl_api()->handler_install(prompt, evloop_line_handler);
+	while (!ev->line_done)
+		evloop_read_step(ev);
+	epoll_ctl(ev->epfd, EPOLL_CTL_DEL, STDIN_FILENO, NULL);
+	return (ev->line);
+}
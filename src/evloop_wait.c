@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   evloop_wait.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 05:07:33 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:02:33 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Handles one round of events while children run.
+ * @param epfd epoll instance.
+ * @param r Children being waited for.
+ * @return Number of children reaped, or -1 if epoll failed.
+ * @note A readable pidfd means the child has exited, so waitpid returns
+ * at once; unwatching it frees a place in the window of evloop_watch.
+ * Events for a child reaped already are ignored. Signals read here
+ * (Ctrl+C reaches the children too) are consumed, a SIGINT being noted
+ * so that the rest of the input is dropped.
+ */
+int	evloop_collect(int epfd, t_reap *r)
+{
+	struct epoll_event	events[EVLOOP_MAX_EVENTS];
+	int					n;
+	int					reaped;
+	unsigned int		i;
+
+	n = epoll_wait(epfd, events, EVLOOP_MAX_EVENTS, -1);
+	if (n == -1 && errno != EINTR)
+		return (-1);
+	reaped = 0;
+	while (n-- > 0)
+	{
+		if (events[n].data.u32 == EV_TAG_SIGNAL)
+			get_exec_ctl()->sigint |= evloop_signals();
+		if (events[n].data.u32 == EV_TAG_ZYGOTE)
+			reaped += zygote_reap(epfd, r);
+		i = events[n].data.u32 - EV_TAG_CHILD;
+		if (events[n].data.u32 < EV_TAG_CHILD || i >= (unsigned int)r->n
+			|| r->fds[i] < 0)
+			continue ;
+		evloop_unwatch(epfd, r, i);
+		waitpid(r->pids[i], &r->status[i], 0);
+		reaped++;
+	}
+	return (reaped);
+}
+
+/**
+ * @brief Waits for a set of children.
+ * @param pids Children to wait for.
+ * @param slots Receives the wait status of each child.
+ * @param n Number of children.
+ * @note Children are reaped in the order they exit, with SIGINT consumed
+ * from the same loop, and more are watched as pidfds free up. If some
+ * child could not be watched (no pidfd support) or epoll fails, the rest
+ * are waited for directly.
+ */
+void	evloop_reap(pid_t *pids, int *slots, int n)
+{
+	t_reap	r;
+	int		epfd;
+	int		watched;
+	int		reaped;
+	int		i;
+
+	if (evloop_reap_init(&r, pids, slots, n) == -1)
+		return ;
+	epfd = evloop_epfd();
+	watched = evloop_watch(epfd, &r);
+	pipe_stats_sample(0);
+	reaped = zygote_reap(epfd, &r);
+	while (watched > reaped)
+	{
+		i = evloop_collect(epfd, &r);
+		if (i == -1)
+			break ;
+		reaped += i;
+		watched += evloop_watch(epfd, &r);
+	}
+	zygote_reap(epfd, NULL);
+	if (reaped != n)
+		evloop_reap_rest(&r);
+	free(r.fds);
+}
+
+/**
+ * @brief Prepares a set of children for evloop_reap.
+ * @param r Set to fill in.
+ * @param pids Children.
+ * @param slots Their wait statuses, set to 0 until reaped.
+ * @param n Number of children.
+ * @return 0 on success, -1 without memory for the pidfds, in which case
+ * every child has been waited for directly already.
+ */
+int	evloop_reap_init(t_reap *r, pid_t *pids, int *slots, int n)
+{
+	int	i;
+
+	r->pids = pids;
+	r->status = slots;
+	r->n = n;
+	r->fds = malloc(sizeof(int) * (n + 1));
+	i = 0;
+	while (i < n)
+	{
+		slots[i] = 0;
+		if (r->fds)
+			r->fds[i] = EV_UNWATCHED;
+		i++;
+	}
+	if (r->fds)
+		return (0);
+	evloop_reap_rest(r);
+	return (-1);
+}
+
+/**
+ * @brief Waits directly for the children evloop_reap could not watch.
+ * @param r Children; those marked EV_REAPED are skipped.
+ */
+void	evloop_reap_rest(t_reap *r)
+{
+	int	status;
+	int	i;
+
+	i = -1;
+	while (++i < r->n)
+	{
+		if (r->fds && r->fds[i] == EV_REAPED)
+			continue ;
+		if (r->fds)
+			evloop_unwatch(evloop_epfd(), r, i);
+		if (zygote_find(r->pids[i]) != -1)
+			r->status[i] = zygote_wait(r->pids[i]);
+		else if (waitpid(r->pids[i], &status, 0) > 0)
+			r->status[i] = status;
+	}
+}
+
+/**
+ * @brief Turns a wait status into an exit status.
+ * @param status Status filled in by waitpid.
+ * @param was_signaled Set to 1 if the child was killed by SIGINT.
+ * @return The exit code, or 128 plus the signal number.
+ * @note A child killed by SIGINT counts as Ctrl+C only if the shell got
+ * the signal as well (or cannot tell, without a signalfd): a command
+ * that interrupts itself, as `sh -c 'kill -INT $$'`, does not stop the
+ * script.
+ */
+int	child_status(int status, int *was_signaled)
+{
+	if (WIFEXITED(status))
+		return (WEXITSTATUS(status));
+	if (!WIFSIGNALED(status))
+		return (0);
+	if (WTERMSIG(status) == SIGINT && was_signaled)
+		*was_signaled = 1;
+	if (WTERMSIG(status) == SIGINT
+		&& (evloop_signals() || get_evloop()->sigfd == -1))
+		get_exec_ctl()->sigint = 1;
+	return (128 + WTERMSIG(status));
+}
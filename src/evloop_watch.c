@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   evloop_watch.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 14:08:37 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 15:02:18 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Registers a pidfd with the epoll instance for more children.
+ * @param epfd epoll instance (-1 to watch none).
+ * @param r Children; each one still EV_UNWATCHED gets its pidfd, -1 when
+ * it cannot be watched, or ZYG_PENDING for a command the zygote started
+ * (see zygote_reap).
+ * @return Number of children newly watched.
+ * @note At most EVLOOP_MAX_WATCH pidfds are open at once, and fewer if
+ * descriptors run out: the rest stay EV_UNWATCHED until some of those
+ * are reaped, so a wide pipeline costs the shell a bounded number of
+ * descriptors.
+ */
+int	evloop_watch(int epfd, t_reap *r)
+{
+	t_evloop	*ev;
+	int			watched;
+	int			i;
+
+	ev = get_evloop();
+	watched = 0;
+	i = -1;
+	while (++i < r->n && epfd != -1 && ev->watching < EVLOOP_MAX_WATCH)
+	{
+		if (r->fds[i] != EV_UNWATCHED)
+			continue ;
+		r->fds[i] = evloop_watch_one(epfd, r->pids[i], EV_TAG_CHILD + i);
+		if (r->fds[i] == EV_UNWATCHED)
+			break ;
+		ev->watching += (r->fds[i] >= 0);
+		watched += (r->fds[i] != -1);
+	}
+	return (watched);
+}
+
+/**
+ * @brief Starts watching one child.
+ * @param epfd epoll instance.
+ * @param pid Child.
+ * @param tag Tag of its events.
+ * @return Its pidfd, ZYG_PENDING for a command the zygote started, -1 if
+ * it cannot be watched, or EV_UNWATCHED to try again once other pidfds
+ * are closed.
+ */
+int	evloop_watch_one(int epfd, pid_t pid, unsigned int tag)
+{
+	struct epoll_event	event;
+	int					pidfd;
+
+	if (zygote_find(pid) != -1)
+		return (ZYG_PENDING);
+	pidfd = syscall(SYS_pidfd_open, pid, 0);
+	if (pidfd == -1 && errno == EMFILE && get_evloop()->watching > 0)
+		return (EV_UNWATCHED);
+	event.events = EPOLLIN;
+	event.data.u32 = tag;
+	if (pidfd != -1 && epoll_ctl(epfd, EPOLL_CTL_ADD, pidfd, &event) == -1)
+	{
+		close(pidfd);
+		pidfd = -1;
+	}
+	return (pidfd);
+}
+
+/**
+ * @brief Stops watching a child and marks it reaped.
+ * @param epfd epoll instance.
+ * @param r Children.
+ * @param i Index of the child.
+ * @note The pidfd leaves the epoll set before it is closed: a child
+ * forked meanwhile on another thread may still hold a copy, which would
+ * keep the registration alive and report the exit a second time.
+ */
+void	evloop_unwatch(int epfd, t_reap *r, int i)
+{
+	if (r->fds[i] >= 0)
+	{
+		epoll_ctl(epfd, EPOLL_CTL_DEL, r->fds[i], NULL);
+		close(r->fds[i]);
+		get_evloop()->watching--;
+	}
+	r->fds[i] = EV_REAPED;
+}
+
+/**
+ * @brief Keeps the zygote socket in the epoll set while needed.
+ * @param epfd epoll instance of the wait (-1 if none).
+ * @param pending Whether a command started by the zygote is still
+ * being waited for.
+ */
+void	evloop_watch_zygote(int epfd, int pending)
+{
+	t_zygote			*z;
+	struct epoll_event	event;
+
+	z = get_zygote();
+	event.events = EPOLLIN;
+	event.data.u32 = EV_TAG_ZYGOTE;
+	if (pending && !z->watched && epfd != -1 && z->fd != -1)
+		z->watched = (epoll_ctl(epfd, EPOLL_CTL_ADD, z->fd, &event) == 0);
+	else if (!pending && z->watched)
+		epoll_ctl(epfd, EPOLL_CTL_DEL, z->fd, NULL);
+	if (!pending)
+		z->watched = 0;
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_tail.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:51:09 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 13:24:51 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether nothing is left to read on a non-terminal stdin.
+ * @return 1 if the line just read is the last one, 0 otherwise.
+ * @note Nothing is consumed: a regular file compares its offset to its
+ * size, and a pipe must report a hang-up with no data pending. A pipe
+ * whose writer is still open never counts as finished.
+ */
+int	stdin_at_eof(void)
+{
+	struct stat		st;
+	struct pollfd	pfd;
+
+	if (isatty(STDIN_FILENO) || fstat(STDIN_FILENO, &st) == -1)
+		return (0);
+	if (S_ISREG(st.st_mode))
+		return (lseek(STDIN_FILENO, 0, SEEK_CUR) >= st.st_size);
+	if (!S_ISFIFO(st.st_mode) && !S_ISSOCK(st.st_mode))
+		return (0);
+	pfd.fd = STDIN_FILENO;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	return (poll(&pfd, 1, 0) == 1 && (pfd.revents & POLLHUP)
+		&& !(pfd.revents & POLLIN));
+}
+
+/**
+ * @brief Runs the top-level list of a script.
+ * @param list First node of the list.
+ * @param should_exit Pointer to the exit flag.
+ * @return Status of the last command run.
+ * @note When the shell will exit right after this list (`last_line`),
+ * the final simple pipeline is marked as a tail call.
+ */
+int	script_exec_top(t_node *list, int *should_exit)
+{
+	t_exec_ctl	*ctl;
+	int			status;
+
+	ctl = get_exec_ctl();
+	status = 0;
+	while (list && !*should_exit && !exec_interrupted())
+	{
+		ctl->tail = (ctl->last_line && !list->next
+				&& list->type == N_PIPELINE);
+		status = ast_exec(list, should_exit);
+		list = list->next;
+	}
+	ctl->tail = 0;
+	return (status);
+}
+
+/**
+ * @brief Tells whether a parsed pipeline can replace the shell.
+ * @param pipeline Pipeline about to run.
+ * @return 1 for a single external command in tail position.
+ * @note The tail mark is consumed here, so commands run by a builtin
+ * such as `source` never inherit it.
+ */
+int	tail_exec_ok(t_cmd *pipeline)
+{
+	t_exec_ctl	*ctl;
+	int			tail;
+
+	ctl = get_exec_ctl();
+	tail = ctl->tail;
+	ctl->tail = 0;
+	return (tail && !pipeline->next && !pipeline->script
+		&& pipeline->args && pipeline->args[0]
+		&& !is_builtin(pipeline->args) && !func_for_cmd(pipeline));
+}
+
+/**
+ * @brief Execs the final command of the shell without forking.
+ * @param cmd Single external command (see tail_exec_ok).
+ * @note Never returns: the shell would exit right after waiting for the
+ * command anyway, so its status becomes the shell's.
+ */
+void	exec_in_place(t_cmd *cmd)
+{
+	if (handle_heredoc_redirections(cmd->redirections) == 130)
+		exit(130);
+	procsub_close_others(cmd);
+	if (handle_redirections(cmd) == -1)
+		exit(EXIT_FAILURE);
+	setup_child_signals();
+	shell_clear_history();
+	zygote_stop();
+	exec_external_command(cmd);
+}
+
+/**
+ * @brief Clears the loop and abort state once a top-level list is done.
+ * @param should_exit Set to 1 if `exit` ran in the list.
+ * @return 1 if the list was cut short by a syntax error, 0 otherwise.
+ * @note A stray `break` or an interrupted loop never leaks into the next
+ * input line. A pending `exit` is kept, so nothing runs afterwards.
+ */
+int	script_exec_end(int *should_exit)
+{
+	t_exec_ctl	*ctl;
+	int			syntax;
+
+	ctl = get_exec_ctl();
+	syntax = (ctl->abort == SYNTAX_ERROR);
+	if (ctl->exited)
+		*should_exit = 1;
+	ctl->abort = 0;
+	ctl->brk = 0;
+	ctl->cont = 0;
+	ctl->ret = 0;
+	return (syntax);
+}
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/06 16:56:22 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/13 15:27:08 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/19 14:00:00 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,17 +17,20 @@
  * @param prev_pipe Array representing the previous pipe.
  * @param next_pipe Array representing the next pipe.
  * @param current Current command in the pipeline.
+ * @note The redirection plan runs once every pipe end is closed.
  */
 void	execute_child_process(int prev_pipe[2],
 	int next_pipe[2], t_cmd *current)
 {
 	int	pipe_out;
 
-	setup_child_signals();
+	evloop_child();
+	procsub_close_others(current);
 	pipe_out = -1;
 	if (current->next)
 		pipe_out = next_pipe[1];
-	handle_redirections(prev_pipe[0], pipe_out, current->redirections);
+	if (stage_pipes(prev_pipe[0], pipe_out) == -1)
+		exit(EXIT_FAILURE);
 	if (prev_pipe[0] != -1)
 		close(prev_pipe[0]);
 	if (prev_pipe[1] != -1)
@@ -36,10 +39,14 @@ void	execute_child_process(int prev_pipe[2],
 		close(next_pipe[0]);
 	if (next_pipe[1] != -1)
 		close(next_pipe[1]);
+	if (handle_redirections(current) == -1)
+		exit(EXIT_FAILURE);
+	if (current->script)
+		run_script_stage(current->script);
+	run_function_stage(current);
 	if (is_builtin(current->args))
 		exit(exec_builtin(current->args));
-	else
-		exec_external_command(current);
+	exec_external_command(current);
 }
 
 /**
@@ -50,14 +57,22 @@ void	execute_child_process(int prev_pipe[2],
  * @param child_pids Array of child process IDs.
  * @param i Index for storing the child PID.
  * @return 0 on success, 1 on failure.
+ * @note The stage is a subshell: `exit` in it ends only the stage.
+ * Plain external commands are started by the zygote or posix_spawn
+ * instead when they can (see stage_fd_map).
  */
 int	fork_and_execute(int *pipes[2], t_cmd *current, pid_t *child_pids, int *i)
 {
 	pid_t	pid;
 
-	pid = fork();
+	pid = zygote_launch(pipes, current);
+	if (pid <= 0)
+		pid = pipe_spawn(pipes, current);
+	if (pid <= 0)
+		pid = fork();
 	if (pid == 0)
 	{
+		*in_subshell() = 1;
 		execute_child_process(pipes[0], pipes[1], current);
 	}
 	else if (pid > 0)
@@ -68,7 +83,6 @@ int	fork_and_execute(int *pipes[2], t_cmd *current, pid_t *child_pids, int *i)
 	else
 	{
 		perror("minishell: fork");
-		free(child_pids);
 		return (1);
 	}
 	return (0);
@@ -79,15 +93,25 @@ int	fork_and_execute(int *pipes[2], t_cmd *current, pid_t *child_pids, int *i)
  * @param ctx Pipeline context containing state and resources.
  * @param pipes Array of previous and next pipes.
  * @return 0 on success, non-zero exit code on failure.
+ * @note Redirections are compiled here, before the fork, and the files
+ * they opened are closed in the shell once the stage has its copies.
  */
 int	process_pipeline_command(t_pipeline_context *ctx, int *pipes[2])
 {
+	int	failed;
+
 	if (handle_heredoc_redirections(ctx->current->redirections) == 130)
-		return (cleanup_on_failure(&ctx->child_pids, 130));
-	if (ctx->current->next && create_pipe(ctx->next_pipe, ctx->child_pids))
-		return (cleanup_on_failure(&ctx->child_pids, 1));
-	if (fork_and_execute(pipes, ctx->current, ctx->child_pids, &ctx->index))
-		return (cleanup_on_failure(&ctx->child_pids, 1));
+		return (pipeline_abort(ctx, 130));
+	stage_plan(ctx->current);
+	failed = (ctx->current->next && create_pipe(ctx->next_pipe));
+	pipe_stats_sample(0);
+	if (!failed)
+		failed = fork_and_execute(pipes, ctx->current, ctx->child_pids,
+				&ctx->index);
+	if (ctx->current->plan)
+		fdplan_close(ctx->current->plan);
+	if (failed)
+		return (pipeline_abort(ctx, 1));
 	return (0);
 }
 
@@ -95,21 +119,25 @@ int	process_pipeline_command(t_pipeline_context *ctx, int *pipes[2])
  * @brief Processes all commands in the pipeline.
  * @param ctx Pipeline context containing state and resources.
  * @param pipes Array of previous and next pipes.
- * @param old_sa Pointer to the old sigaction structure to restore later.
  * @return 0 on success, 1 on failure.
+ * @note The command index is synced here so every stage inherits the
+ * validated mapping instead of checking it again. The descriptor budget
+ * is checked before any stage starts (see pipe_fd_budget).
  */
-int	process_all_pipeline_commands(t_pipeline_context *ctx,
-	int *pipes[2], struct sigaction *old_sa)
+int	process_all_pipeline_commands(t_pipeline_context *ctx, int *pipes[2])
 {
+	invalidate_stat_cache();
+	cmd_index_sync();
+	pipe_stats_start(ft_cmd_size(ctx->current));
+	if (pipe_fd_budget(ctx->current))
+		return (pipeline_abort(ctx, EXIT_FAILURE));
 	while (ctx->current)
 	{
 		if (process_pipeline_command(ctx, pipes))
-		{
-			sigaction(SIGINT, old_sa, NULL);
 			return (1);
-		}
 		ctx->current = ctx->current->next;
 	}
+	pipe_stats_sample(1);
 	return (0);
 }
 
@@ -117,31 +145,30 @@ int	process_all_pipeline_commands(t_pipeline_context *ctx,
  * @brief Manages pipeline execution with process forking.
  * @param pipeline Linked list of commands to execute.
  * @return Exit status of last command in pipeline.
- * @note Handles input/output redirection between commands.
+ * @note Handles input/output redirection between commands. SIGINT stays
+ * blocked in the shell throughout (see evloop_init), so nothing has to be
+ * switched around the fork or the wait.
  */
 int	execute_pipeline(t_cmd *pipeline)
 {
 	t_pipeline_context	ctx;
 	int					*pipes[2];
-	struct sigaction	sa;
-	struct sigaction	old_sa;
 	int					was_signaled;
 
-	if (setup_signal_handling(&sa, &old_sa))
-		return (cleanup_on_failure(NULL, 1));
 	pipes[0] = ctx.prev_pipe;
 	pipes[1] = ctx.next_pipe;
-	if (initialize_pipeline(pipeline, &ctx, &old_sa))
+	if (initialize_pipeline(pipeline, &ctx))
 		return (cleanup_on_failure(&ctx.child_pids, 1));
-	if (process_all_pipeline_commands(&ctx, pipes, &old_sa))
+	if (process_all_pipeline_commands(&ctx, pipes))
 		return (cleanup_on_failure(&ctx.child_pids, 1));
 	close_remaining_pipes(ctx.prev_pipe);
 	ctx.last_status = wait_for_children(ctx.child_pids,
 			ft_cmd_size(pipeline), &was_signaled);
+	pipe_stats_report();
 	handle_last_command(pipeline, ctx.last_status, ctx.child_pids);
 	free(ctx.child_pids);
-	if (manage_signal_handling(&old_sa, was_signaled))
-		return (1);
+	if (was_signaled)
+		write(STDOUT_FILENO, "\n", 1);
 	set_exit_status(ctx.last_status);
 	return (ctx.last_status);
 }
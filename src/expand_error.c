@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_error.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the flag raised when an expansion fails.
+ * @return Pointer to the flag of the current shell context.
+ * @note Expansions run inside the lexer and cannot return errors through
+ * it, so they raise this flag and the command is dropped after parsing.
+ */
+int	*expand_error_flag(void)
+{
+	return (&get_shell_ctx()->expand_error);
+}
+
+/**
+ * @brief Reports an expansion failure.
+ * @note The command line being parsed will not be executed and `$?`
+ * becomes 1.
+ */
+void	raise_expand_error(void)
+{
+	*expand_error_flag() = 1;
+	set_exit_status(1);
+}
+
+/**
+ * @brief Reads and clears the expansion failure flag.
+ * @return 1 if an expansion failed since the last call, 0 otherwise.
+ */
+int	consume_expand_error(void)
+{
+	int	failed;
+
+	failed = *expand_error_flag();
+	*expand_error_flag() = 0;
+	return (failed);
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_word.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:30:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:46:30 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a backslash quotes the character after it.
+ * @param input String being expanded.
+ * @param i Index to look at.
+ * @param mode EXPAND_PLAIN, EXPAND_WORD for an unquoted word or
+ * EXPAND_DQUOTE for the contents of double quotes.
+ * @return 1 if `input[i]` is a backslash that quotes `input[i + 1]`.
+ * @note In a word every character can be quoted; inside double quotes
+ * only `$`, `"`, `\` and `` ` `` can, so `"a\n"` keeps its backslash.
+ */
+int	expand_escape_at(const char *input, size_t i, int mode)
+{
+	if (mode == EXPAND_PLAIN || input[i] != '\\')
+		return (0);
+	if (mode == EXPAND_DQUOTE)
+		return (input[i + 1] && ft_strchr("$\"\\`", input[i + 1]));
+	return (mode == EXPAND_WORD);
+}
+
+/**
+ * @brief Expands parameters and substitutions, removing the backslashes
+ * that quote a character in the same pass.
+ * @param input The input string to process.
+ * @param mode EXPAND_PLAIN to leave backslashes alone, EXPAND_WORD for an
+ * unquoted word, EXPAND_DQUOTE for the contents of double quotes.
+ * @return New string with everything expanded. Must be freed by the
+ * caller.
+ * @note A quoted `\$` stays a literal dollar, and `$(...)`, `${...}` and
+ * `$((...))` groups reach their expansion with their text untouched, so
+ * `$(printf "a\nb")` runs printf with its backslash. A trailing
+ * backslash of a word is dropped.
+ */
+char	*expand_escaped(const char *input, int mode)
+{
+	t_strbuf	sb;
+	size_t		i;
+
+	i = 0;
+	sb_init(&sb);
+	while (!sb.failed && input[i])
+	{
+		if (expand_escape_at(input, i, mode))
+		{
+			sb_append(&sb, input + i + 1, input[i + 1] != '\0');
+			i += 1 + (input[i + 1] != '\0');
+		}
+		else if (input[i] == '$' && input[i + 1] == '(' && input[i + 2] == '(')
+			expand_arith(input, &i, &sb);
+		else if (input[i] == '$' && input[i + 1] == '{')
+			expand_param(input, &i, &sb);
+		else if (input[i] == '$' && input[i + 1] == '(')
+			expand_cmdsub(input, &i, &sb);
+		else if (input[i] == '$' && (is_special_param(input[i + 1])
+				|| ft_isalpha(input[i + 1]) || input[i + 1] == '_'))
+			expand_and_append_variable(input, &i, &sb);
+		else
+			sb_putc(&sb, input[i++]);
+	}
+	return (sb_detach(&sb));
+}
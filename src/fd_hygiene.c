@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_hygiene.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 02:41:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:53:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Finds the lowest process substitution descriptor of a command.
+ * @param cmd Command owning the substitutions.
+ * @param from Lowest descriptor considered.
+ * @return The descriptor, -1 if there is none from `from` up.
+ */
+int	procsub_next_fd(t_cmd *cmd, int from)
+{
+	t_procsub_table	*t;
+	int				best;
+	int				i;
+
+	t = get_procsub_table();
+	best = -1;
+	i = 0;
+	while (i < t->count)
+	{
+		if (t->entries[i].owner == cmd && t->entries[i].fd >= from
+			&& (best == -1 || t->entries[i].fd < best))
+			best = t->entries[i].fd;
+		i++;
+	}
+	return (best);
+}
+
+/**
+ * @brief Closes the descriptors a command must not inherit.
+ * @param cmd Command about to be exec'd.
+ * @note Everything from FDPLAN_MIN_FD up is the shell's own, as in other
+ * shells, and goes in a few close_range calls. The command's /dev/fd
+ * process substitutions are kept, and so are the descriptors the shell
+ * itself inherited (see fd_inherit_scan).
+ */
+void	close_stray_fds(t_cmd *cmd)
+{
+	int	lo;
+	int	keep;
+
+	lo = FDPLAN_MIN_FD;
+	keep = fd_kept_next(cmd, lo);
+	while (keep != -1)
+	{
+		if (keep > lo)
+			close_range(lo, keep - 1, 0);
+		lo = keep + 1;
+		keep = fd_kept_next(cmd, lo);
+	}
+	close_range(lo, ~0U, 0);
+}
+
+/**
+ * @brief Tells whether a command is meant to inherit a descriptor.
+ * @param cmd Command about to be exec'd.
+ * @param fd Descriptor open at exec time.
+ * @return 1 for a redirection target or process substitution of `cmd`,
+ * or a descriptor the shell inherited.
+ */
+int	fd_expected(t_cmd *cmd, int fd)
+{
+	t_redir	*r;
+
+	r = cmd->redirections;
+	while (r)
+	{
+		if (redir_io_number(r) == fd)
+			return (1);
+		r = r->next;
+	}
+	return (fd_kept_next(cmd, fd) == fd);
+}
+
+/**
+ * @brief Reports a descriptor a command inherits unexpectedly.
+ * @param cmd Command about to be exec'd.
+ * @param fd Descriptor left open.
+ */
+void	fd_debug_report(t_cmd *cmd, int fd)
+{
+	char	*num;
+	char	*link;
+	char	target[PATH_MAX];
+	ssize_t	len;
+
+	num = ft_itoa(fd);
+	link = ft_strjoin("/proc/self/fd/", num);
+	len = -1;
+	if (link)
+		len = readlink(link, target, sizeof(target) - 1);
+	if (len < 0)
+		len = 0;
+	target[len] = '\0';
+	ft_putstr_fd("minishell: fd debug: ", STDERR_FILENO);
+	ft_putstr_fd(cmd->args[0], STDERR_FILENO);
+	ft_putstr_fd(": fd ", STDERR_FILENO);
+	ft_putstr_fd(num, STDERR_FILENO);
+	ft_putstr_fd(" -> ", STDERR_FILENO);
+	ft_putstr_fd(target, STDERR_FILENO);
+	ft_putstr_fd(" open at exec\n", STDERR_FILENO);
+	free(num);
+	free(link);
+}
+
+/**
+ * @brief Lists the descriptors a command would inherit unexpectedly.
+ * @param cmd Command about to be exec'd.
+ * @note Only when MINISHELL_FD_DEBUG is set. Close-on-exec descriptors
+ * are skipped; those kept by `exec 3>file` are reported as well.
+ */
+void	fd_debug_check(t_cmd *cmd)
+{
+	t_dirscan	ds;
+	t_dirent64	*ent;
+	int			fd;
+
+	if (!env_value("MINISHELL_FD_DEBUG")
+		|| dirscan_open(&ds, "/proc/self/fd") == -1)
+		return ;
+	ent = dirscan_next(&ds);
+	while (ent)
+	{
+		fd = ft_atoi(ent->name);
+		if (ft_isdigit(ent->name[0]) && fd > STDERR_FILENO
+			&& !fd_expected(cmd, fd) && fcntl(fd, F_GETFD) == 0)
+			fd_debug_report(cmd, fd);
+		ent = dirscan_next(&ds);
+	}
+	dirscan_close(&ds);
+}
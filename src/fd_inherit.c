@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_inherit.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:51:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:51:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Records the descriptors from FDPLAN_MIN_FD up that the shell
+ * was started with.
+ * @note Called once by the front-end at startup. These belong to whoever
+ * started the shell (`exec 12<file` in a parent script), so commands
+ * inherit them like stdin; only the shell's own descriptors are closed.
+ */
+void	fd_inherit_scan(void)
+{
+	t_fd_inherit	*inh;
+	t_dirscan		ds;
+	t_dirent64		*ent;
+	int				fd;
+
+	inh = &get_shell_ctx()->inherited;
+	inh->count = 0;
+	if (dirscan_open(&ds, "/proc/self/fd") == -1)
+		return ;
+	ent = dirscan_next(&ds);
+	while (ent && inh->count < FD_INHERIT_MAX)
+	{
+		fd = ft_atoi(ent->name);
+		if (ft_isdigit(ent->name[0]) && fd >= FDPLAN_MIN_FD
+			&& fd != ds.fd && fcntl(fd, F_GETFD) == 0)
+			inh->fds[inh->count++] = fd;
+		ent = dirscan_next(&ds);
+	}
+	dirscan_close(&ds);
+}
+
+/**
+ * @brief Finds the lowest inherited descriptor.
+ * @param from Lowest descriptor considered.
+ * @return The descriptor, -1 if there is none from `from` up.
+ */
+int	fd_inherited_next(int from)
+{
+	t_fd_inherit	*inh;
+	int				best;
+	int				i;
+
+	inh = &get_shell_ctx()->inherited;
+	best = -1;
+	i = 0;
+	while (i < inh->count)
+	{
+		if (inh->fds[i] >= from && (best == -1 || inh->fds[i] < best))
+			best = inh->fds[i];
+		i++;
+	}
+	return (best);
+}
+
+/**
+ * @brief Finds the lowest descriptor a command keeps across exec.
+ * @param cmd Command about to be exec'd.
+ * @param from Lowest descriptor considered.
+ * @return An inherited descriptor or a process substitution of `cmd`,
+ * -1 if there is none from `from` up.
+ */
+int	fd_kept_next(t_cmd *cmd, int from)
+{
+	int	procsub;
+	int	inherited;
+
+	procsub = procsub_next_fd(cmd, from);
+	inherited = fd_inherited_next(from);
+	if (procsub == -1 || (inherited != -1 && inherited < procsub))
+		return (inherited);
+	return (procsub);
+}
+
+/**
+ * @brief Closes the inherited descriptors.
+ * @note Used by the zygote, whose commands never get them (see
+ * stage_fd_map), so that it does not hold a pipe open for the shell's
+ * whole lifetime.
+ */
+void	fd_inherit_close(void)
+{
+	t_fd_inherit	*inh;
+	int				i;
+
+	inh = &get_shell_ctx()->inherited;
+	i = 0;
+	while (i < inh->count)
+		close(inh->fds[i++]);
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fdplan.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 01:26:47 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Gives the descriptor a redirection changes.
+ * @param r Redirection.
+ * @return Its io number, or 0 for input and 1 for output operators.
+ */
+int	redir_io_number(t_redir *r)
+{
+	if (r->io_number >= 0)
+		return (r->io_number);
+	if (r->type == T_REDIR_OUT || r->type == T_APPEND || r->type == T_DUP_OUT)
+		return (STDOUT_FILENO);
+	return (STDIN_FILENO);
+}
+
+/**
+ * @brief Finds the lowest descriptor a plan may use for its own copies.
+ * @param redirections Redirections of the command.
+ * @return A descriptor above every one the redirections name.
+ * @note `>&7` names 7 too, so an opened file is never parked where the
+ * command expects one of its own descriptors.
+ */
+int	fdplan_base(t_redir *redirections)
+{
+	int	base;
+	int	fd;
+
+	base = FDPLAN_MIN_FD;
+	while (redirections)
+	{
+		fd = redir_io_number(redirections);
+		if (fd >= base)
+			base = fd + 1;
+		if (redirections->type == T_DUP_OUT || redirections->type == T_DUP_IN)
+		{
+			fd = dup_target(redirections->filename);
+			if (fd >= base)
+				base = fd + 1;
+		}
+		redirections = redirections->next;
+	}
+	return (base);
+}
+
+/**
+ * @brief Appends a step to a plan.
+ * @param plan Plan being built.
+ * @param src Descriptor to copy, -1 to close `dst`.
+ * @param dst Descriptor changed by the step.
+ * @param owned Whether the plan opened `src` and must close it.
+ * @return 0 on success, -1 if the plan is full.
+ * @note A step on a file opened by the plan, or a close, is dropped when
+ * this step overwrites its `dst` before anything reads it: `>a >b`
+ * still creates both files but only dup2s the last one.
+ */
+int	fdplan_add(t_fdplan *plan, int src, int dst, int owned)
+{
+	int	i;
+
+	i = plan->n;
+	while (--i >= 0 && plan->ops[i].src != dst)
+	{
+		if (plan->ops[i].dst != dst)
+			continue ;
+		if (plan->ops[i].owned || plan->ops[i].src < 0)
+			plan->ops[i].dst = -1;
+		break ;
+	}
+	if (plan->n == FDPLAN_MAX)
+	{
+		if (owned)
+			close(src);
+		errno = EMFILE;
+		return (fdplan_error("redirection", -1));
+	}
+	plan->ops[plan->n].src = src;
+	plan->ops[plan->n].dst = dst;
+	plan->ops[plan->n].owned = owned;
+	plan->ops[plan->n].saved = -2;
+	plan->n++;
+	return (0);
+}
+
+/**
+ * @brief Moves a descriptor opened for a plan above the plan's base and
+ * adds the step copying it onto `dst`.
+ * @param plan Plan being built.
+ * @param fd Descriptor to move (closed here).
+ * @param dst Descriptor it replaces when the plan runs.
+ * @return 0 on success, -1 on error.
+ */
+int	fdplan_take(t_fdplan *plan, int fd, int dst)
+{
+	int	moved;
+
+	moved = fcntl(fd, F_DUPFD_CLOEXEC, plan->base);
+	if (moved == -1)
+	{
+		fdplan_error(NULL, dst);
+		close(fd);
+		return (-1);
+	}
+	close(fd);
+	return (fdplan_add(plan, moved, dst, 1));
+}
+
+/**
+ * @brief Compiles the redirections of a command into a plan.
+ * @param plan Plan to fill.
+ * @param redirections Redirections, in command-line order.
+ * @return 0 on success, -1 after reporting an error.
+ * @note Files are opened here, so a forked stage only has the dup2 and
+ * close steps left to run. Heredoc descriptors move into the plan; on
+ * error every descriptor opened so far is closed.
+ */
+int	fdplan_build(t_fdplan *plan, t_redir *redirections)
+{
+	t_redir	*r;
+
+	plan->n = 0;
+	plan->done = 0;
+	plan->failed = 0;
+	plan->mapped = 0;
+	plan->base = fdplan_base(redirections);
+	r = redirections;
+	while (r && fdplan_redir(plan, r) == 0)
+		r = r->next;
+	if (!r)
+		return (0);
+	fdplan_close(plan);
+	while (r)
+	{
+		if (r->fd >= 0)
+			close(r->fd);
+		r->fd = -1;
+		r = r->next;
+	}
+	plan->failed = 1;
+	return (-1);
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fdplan_apply.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 01:26:47 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 03:52:19 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Closes the descriptors a plan opened.
+ * @param plan Plan, applied or not.
+ * @note Run by the shell once a stage is forked, and by whoever applied
+ * the plan once its steps ran.
+ */
+void	fdplan_close(t_fdplan *plan)
+{
+	int	i;
+
+	i = 0;
+	while (i < plan->n)
+	{
+		if (plan->ops[i].owned)
+			close(plan->ops[i].src);
+		plan->ops[i].owned = 0;
+		i++;
+	}
+}
+
+/**
+ * @brief Saves the descriptor a step is about to change.
+ * @param plan Plan applied by the shell itself.
+ * @param i Step index.
+ * @return 0 on success, -1 on error.
+ * @note Only the first step on a descriptor saves it; a closed
+ * descriptor is recorded as -1 and closed again on restore.
+ */
+int	fdplan_save(t_fdplan *plan, int i)
+{
+	int	j;
+	int	dst;
+
+	dst = plan->ops[i].dst;
+	j = 0;
+	while (j < i && plan->ops[j].dst != dst)
+		j++;
+	if (j < i)
+		return (0);
+	plan->ops[i].saved = fcntl(dst, F_DUPFD_CLOEXEC, plan->base);
+	if (plan->ops[i].saved == -1 && errno != EBADF)
+	{
+		plan->ops[i].saved = -2;
+		return (fdplan_error(NULL, dst));
+	}
+	return (0);
+}
+
+/**
+ * @brief Runs the dup2 and close steps of a plan in order.
+ * @param plan Built plan.
+ * @param save Whether to keep copies for fdplan_restore, for commands
+ * run by the shell itself.
+ * @return 0 on success, -1 after reporting an error.
+ * @note The descriptors opened by the plan are closed afterwards.
+ */
+int	fdplan_apply(t_fdplan *plan, int save)
+{
+	t_fdop	*op;
+	int		status;
+
+	if (plan->failed)
+		return (-1);
+	status = 0;
+	while (status == 0 && plan->done < plan->n)
+	{
+		op = &plan->ops[plan->done];
+		if (op->dst >= 0 && save)
+			status = fdplan_save(plan, plan->done);
+		if (status == 0 && op->dst >= 0 && op->src < 0)
+			close(op->dst);
+		else if (status == 0 && op->dst >= 0 && op->src != op->dst
+			&& dup2(op->src, op->dst) == -1)
+			status = fdplan_error(NULL, op->src);
+		plan->done++;
+	}
+	fdplan_close(plan);
+	return (status);
+}
+
+/**
+ * @brief Undoes the steps run by fdplan_apply with `save` set.
+ * @param plan Applied plan.
+ * @note After `exec 3>file` the steps stay and the copies are only
+ * closed.
+ */
+void	fdplan_restore(t_fdplan *plan)
+{
+	t_fdop	*op;
+	int		keep;
+
+	keep = get_exec_ctl()->keep_fds;
+	while (plan->done > 0)
+	{
+		op = &plan->ops[--plan->done];
+		if (op->saved >= 0 && !keep)
+			dup2(op->saved, op->dst);
+		else if (op->saved == -1 && !keep)
+			close(op->dst);
+		if (op->saved >= 0)
+			close(op->saved);
+	}
+}
+
+/**
+ * @brief Resolves a plan into a descriptor map instead of running it.
+ * @param plan Built plan.
+ * @param map Map of stdin, stdout and stderr, updated on success.
+ * @return 0 on success, -1 if the plan needs the real descriptors.
+ * @note Only steps between the standard streams and files the plan
+ * opened can be mapped; the files stay open until fdplan_close.
+ */
+int	fdplan_virtual(t_fdplan *plan, int map[3])
+{
+	int		next[3];
+	t_fdop	*op;
+	int		i;
+
+	ft_memcpy(next, map, sizeof(next));
+	i = -1;
+	while (++i < plan->n)
+	{
+		op = &plan->ops[i];
+		if (op->dst < 0)
+			continue ;
+		if (op->dst > STDERR_FILENO
+			|| (op->src > STDERR_FILENO && !op->owned))
+			return (-1);
+		if (op->src < 0)
+			next[op->dst] = -1;
+		else if (op->src <= STDERR_FILENO)
+			next[op->dst] = next[op->src];
+		else
+			next[op->dst] = op->src;
+	}
+	ft_memcpy(map, next, sizeof(next));
+	plan->mapped = 1;
+	return (0);
+}
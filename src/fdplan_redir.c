@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fdplan_redir.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 01:26:47 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 01:26:47 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reports a redirection error.
+ * @param name Name to report, NULL to report `fd` instead.
+ * @param fd Descriptor number reported when `name` is NULL.
+ * @return Always -1.
+ * @note Prints `minishell: name: reason` from errno and sets the exit
+ * status to 1.
+ */
+int	fdplan_error(const char *name, int fd)
+{
+	char	*reason;
+
+	reason = strerror(errno);
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	if (name)
+		ft_putstr_fd((char *)name, STDERR_FILENO);
+	else
+		ft_putnbr_fd(fd, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putstr_fd(reason, STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+	set_exit_status(1);
+	return (-1);
+}
+
+/**
+ * @brief Reads the target of `>&` or `<&`.
+ * @param word Target word.
+ * @return The descriptor number, -2 for `-`, -1 if not a number.
+ */
+int	dup_target(const char *word)
+{
+	int	i;
+
+	if (!word)
+		return (-1);
+	if (word[0] == '-' && !word[1])
+		return (-2);
+	i = 0;
+	while (ft_isdigit(word[i]))
+		i++;
+	if (i == 0 || i > 9 || word[i])
+		return (-1);
+	return (ft_atoi(word));
+}
+
+/**
+ * @brief Compiles a `>&` or `<&` redirection.
+ * @param plan Plan being built.
+ * @param r Redirection.
+ * @return 0 on success, -1 on error.
+ * @note `>&file` without a descriptor number sends both stdout and
+ * stderr to `file`, as `>file 2>&1` does.
+ */
+int	fdplan_dup(t_fdplan *plan, t_redir *r)
+{
+	int	src;
+	int	fd;
+
+	src = dup_target(r->filename);
+	if (src == -2)
+		return (fdplan_add(plan, -1, redir_io_number(r), 0));
+	if (src >= 0)
+		return (fdplan_add(plan, src, redir_io_number(r), 0));
+	if (r->type != T_DUP_OUT || r->io_number >= 0)
+	{
+		ft_putstr_fd("minishell: ", STDERR_FILENO);
+		ft_putstr_fd(r->filename, STDERR_FILENO);
+		ft_putstr_fd(": ambiguous redirect\n", STDERR_FILENO);
+		set_exit_status(1);
+		return (-1);
+	}
+	fd = open(r->filename, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd == -1)
+		return (fdplan_error(r->filename, -1));
+	if (fdplan_take(plan, fd, STDOUT_FILENO) == -1)
+		return (-1);
+	return (fdplan_add(plan, STDOUT_FILENO, STDERR_FILENO, 0));
+}
+
+/**
+ * @brief Compiles one redirection into plan steps.
+ * @param plan Plan being built.
+ * @param r Redirection (heredocs already collected).
+ * @return 0 on success, -1 on error.
+ */
+int	fdplan_redir(t_fdplan *plan, t_redir *r)
+{
+	int	fd;
+
+	if (r->type == T_DUP_OUT || r->type == T_DUP_IN)
+		return (fdplan_dup(plan, r));
+	fd = open_redirection_fd(r);
+	if (r->type == T_HEREDOC || r->type == T_HERESTRING)
+		r->fd = -1;
+	if (fd == -1)
+		return (fdplan_error(r->filename, -1));
+	return (fdplan_take(plan, fd, redir_io_number(r)));
+}
+
+/**
+ * @brief Compiles the redirections of a pipeline stage before its fork.
+ * @param cmd Pipeline stage.
+ * @note A stage whose plan fails still forks and exits 1, so the rest
+ * of the pipeline runs as in other shells. Without memory for the plan
+ * the stage compiles its redirections itself.
+ */
+void	stage_plan(t_cmd *cmd)
+{
+	if (!cmd->redirections)
+		return ;
+	cmd->plan = malloc(sizeof(t_fdplan));
+	if (cmd->plan)
+		fdplan_build(cmd->plan, cmd->redirections);
+}
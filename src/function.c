@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   function.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:37:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the table of defined functions.
+ * @return Pointer to the list head of the current shell context.
+ */
+t_func	**get_func_table(void)
+{
+	return (&get_shell_ctx()->funcs);
+}
+
+/**
+ * @brief Looks up a function by name.
+ * @param name Command name (may be NULL).
+ * @return The function, or NULL if none is defined with that name.
+ */
+t_func	*func_lookup(const char *name)
+{
+	t_func	*f;
+
+	if (!name)
+		return (NULL);
+	f = *get_func_table();
+	while (f && ft_strcmp(f->name, name) != 0)
+		f = f->next;
+	return (f);
+}
+
+/**
+ * @brief Returns the function a command would call.
+ * @param cmd Parsed command.
+ * @return The function, or NULL for builtins and external commands.
+ * @note Checked before builtins and before the PATH lookup.
+ */
+t_func	*func_for_cmd(t_cmd *cmd)
+{
+	if (!cmd->args)
+		return (NULL);
+	return (func_lookup(cmd->args[0]));
+}
+
+/**
+ * @brief Defines or replaces a function.
+ * @param name Function name.
+ * @param text Source of the body (a compound command).
+ * @return 0 on success, 1 on failure.
+ * @note The body is parsed once here; calls only run the stored tree.
+ * A body still running (the function redefines itself) is not freed.
+ */
+int	func_define(const char *name, const char *text)
+{
+	t_func	*f;
+	t_node	*body;
+	int		status;
+
+	body = script_parse(text, 0, &status);
+	if (!body)
+		return (1);
+	f = func_lookup(name);
+	if (!f)
+	{
+		f = ft_calloc(1, sizeof(t_func));
+		if (f)
+			f->name = ft_strdup(name);
+		if (!f || !f->name)
+			return (free(f), node_free(body), 1);
+		f->next = *get_func_table();
+		*get_func_table() = f;
+	}
+	else if (!f->busy)
+		node_free(f->body);
+	f->body = body;
+	return (0);
+}
+
+/**
+ * @brief Calls a function in the current shell.
+ * @param f Function to call.
+ * @param args Command arguments (`args[0]` is the function name).
+ * @param should_exit Pointer to the exit flag.
+ * @return Exit status of the body, or of `return n`.
+ * @note Each call pushes a fresh `$1..$9`/`$@`/`$#` frame; loops of the
+ * caller are not visible to `break` inside the body.
+ */
+int	func_call(t_func *f, char **args, int *should_exit)
+{
+	t_frame		frame;
+	t_exec_ctl	*ctl;
+	int			loop_depth;
+	int			status;
+
+	ctl = get_exec_ctl();
+	if (ctl->func_depth >= FUNC_MAX_DEPTH)
+	{
+		ft_putstr_fd("minishell: maximum function nesting level exceeded\n",
+			STDERR_FILENO);
+		return (1);
+	}
+	frame_push(&frame, args + 1);
+	loop_depth = ctl->loop_depth;
+	ctl->loop_depth = 0;
+	ctl->func_depth++;
+	f->busy++;
+	status = ast_exec_list(f->body, should_exit);
+	f->busy--;
+	ctl->func_depth--;
+	ctl->loop_depth = loop_depth;
+	ctl->ret = 0;
+	*get_frame() = frame.prev;
+	return (status);
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   function_exec.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:37:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Calls a function as a single command in the shell process.
+ * @param pipeline Single-command pipeline naming the function.
+ * @param f Function to call.
+ * @param should_exit Pointer to the exit flag.
+ * @note Redirections apply to the whole call and are undone afterwards,
+ * like those of builtins run in the parent.
+ */
+void	handle_function_in_parent(t_cmd *pipeline, t_func *f,
+	int *should_exit)
+{
+	t_fdplan	plan;
+
+	if (handle_heredoc_redirections(pipeline->redirections) == 130)
+	{
+		set_exit_status(130);
+		return ;
+	}
+	if (redirect_push(&plan, pipeline->redirections) == 0)
+		set_exit_status(func_call(f, pipeline->args, should_exit));
+	redirect_pop(&plan);
+}
+
+/**
+ * @brief Calls a function as a pipeline stage and exits.
+ * @param cmd Pipeline stage.
+ * @note Called in the forked stage once its pipes are in place; returns
+ * without doing anything if the stage does not name a function.
+ */
+void	run_function_stage(t_cmd *cmd)
+{
+	t_func	*f;
+	int		should_exit;
+
+	f = func_for_cmd(cmd);
+	if (!f)
+		return ;
+	*in_subshell() = 1;
+	should_exit = 0;
+	exit(func_call(f, cmd->args, &should_exit));
+}
+
+/**
+ * @brief Runs a `{ list; }` group or a function definition.
+ * @param n N_GROUP or N_FUNCDEF node.
+ * @param should_exit Pointer to the exit flag.
+ * @return Status of the group, or 0 once the function is defined.
+ */
+int	ast_exec_group(t_node *n, int *should_exit)
+{
+	if (n->type == N_FUNCDEF)
+		return (func_define(n->text, n->words));
+	return (ast_exec_list(n->body, should_exit));
+}
+
+/**
+ * @brief Frees every defined function.
+ * @note Only called once the shell has stopped, when no body is running.
+ */
+void	func_table_free(void)
+{
+	t_func	*f;
+
+	while (*get_func_table())
+	{
+		f = *get_func_table();
+		*get_func_table() = f->next;
+		node_free(f->body);
+		free(f->name);
+		free(f);
+	}
+}
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 14:53:18 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/08 16:47:50 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -47,7 +47,7 @@ char	**get_path_directories(void)
 	char	*path_env;
 	char	**paths;
 
-	path_env = getenv("PATH");
+	path_env = env_value("PATH");
 	if (!path_env)
 		return (NULL);
 	paths = ft_split(path_env, ':');
@@ -72,12 +72,12 @@ char	*check_direct_path(char *cmd)
 			return (NULL);
 		if (stat(cmd, &path_stat) == -1 || !S_ISREG(path_stat.st_mode))
 		{
-			g_exit_status = PERM_DENIED;
+			set_exit_status(PERM_DENIED);
 			return (NULL);
 		}
 		if (access(cmd, X_OK) == -1)
 		{
-			g_exit_status = PERM_DENIED;
+			set_exit_status(PERM_DENIED);
 			return (NULL);
 		}
 		return (ft_strdup(cmd));
@@ -90,6 +90,8 @@ char	*check_direct_path(char *cmd)
  * @param cmd Command name (e.g., "ls").
  * @return Allocated full path (e.g., "/bin/ls") or NULL if not found.
  * Caller must free the returned string.
+ * @note The command index (see cmd_index_find) answers first when it is
+ * enabled; PATH is probed for anything it does not hold.
  */
 char	*get_cmd_path(char *cmd)
 {
@@ -98,6 +100,8 @@ char	*get_cmd_path(char *cmd)
 	int		i;
 
 	full_path = check_direct_path(cmd);
+	if (!full_path && !ft_strchr(cmd, '/'))
+		full_path = cmd_index_find(cmd);
 	if (full_path)
 		return (full_path);
 	paths = get_path_directories();
@@ -126,18 +130,8 @@ char	*get_cmd_path(char *cmd)
  */
 void	execute_command(t_cmd *cmd, int pipe_in, int pipe_out)
 {
-	pid_t				pid;
-	struct sigaction	sa;
-	struct sigaction	old_sa;
+	pid_t	pid;
 
-	sa.sa_handler = SIG_IGN;
-	sa.sa_flags = SA_RESTART;
-	sigemptyset(&sa.sa_mask);
-	if (sigaction(SIGINT, &sa, &old_sa) == -1)
-	{
-		perror("minishell: sigaction");
-		return ;
-	}
 	pid = fork();
 	if (pid == 0)
 	{
@@ -146,5 +140,5 @@ void	execute_command(t_cmd *cmd, int pipe_in, int pipe_out)
 	else if (pid < 0)
 		perror("fork");
 	else
-		handle_child_exit(pid, &old_sa);
+		handle_child_exit(pid);
 }
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 15:02:18 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reads one pattern token.
+ * @param pat Pattern.
+ * @param i Current index; moved past the token.
+ * @param tok Receives the token.
+ */
+void	glob_read_token(const char *pat, size_t *i, t_glob_tok *tok)
+{
+	tok->type = GLOB_LIT;
+	if (pat[*i] == '*')
+		tok->type = GLOB_STAR;
+	else if (pat[*i] == '?')
+		tok->type = GLOB_ANY;
+	else if (pat[*i] == '[')
+		glob_parse_class(pat, i, tok);
+	else if (pat[*i] == '\\' && pat[*i + 1])
+		(*i)++;
+	tok->c = (unsigned char)pat[(*i)++];
+}
+
+/**
+ * @brief Compiles a shell pattern into a token array.
+ * @param pat Pattern (`*`, `?`, `[...]`, `\c`).
+ * @param g Receives the compiled pattern.
+ * @return 0 on success, -1 on allocation failure.
+ * @note Runs of `*` collapse into one token; an unterminated `[` is
+ * literal.
+ */
+int	glob_compile(const char *pat, t_glob *g)
+{
+	size_t		i;
+	t_glob_tok	*tok;
+
+	g->n = 0;
+	g->toks = malloc(sizeof(t_glob_tok) * (ft_strlen(pat) + 1));
+	if (!g->toks)
+		return (-1);
+	i = 0;
+	while (pat[i])
+	{
+		tok = &g->toks[g->n];
+		glob_read_token(pat, &i, tok);
+		if (tok->type != GLOB_STAR || !g->n
+			|| g->toks[g->n - 1].type != GLOB_STAR)
+			g->n++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Tests one non-star token against a character.
+ * @param tok Token.
+ * @param c Character.
+ * @return 1 if the character matches.
+ */
+int	glob_tok_matches(const t_glob_tok *tok, unsigned char c)
+{
+	int	in_set;
+
+	if (tok->type == GLOB_ANY)
+		return (1);
+	if (tok->type == GLOB_LIT)
+		return (tok->c == c);
+	in_set = (tok->set[c / 8] >> (c % 8)) & 1;
+	return (in_set != tok->negate);
+}
+
+/**
+ * @brief Matches tokens from `ti` on against a whole string.
+ * @param g Compiled pattern.
+ * @param ti First token to match.
+ * @param s String.
+ * @param len Length of the string.
+ * @return 1 on a match, 0 on a mismatch, -1 when no later split of an
+ * earlier `*` can match either.
+ * @note The -1 result stops outer stars from retrying, which keeps
+ * patterns like `*a*a*a*b` polynomial.
+ */
+int	glob_match_at(const t_glob *g, size_t ti, const char *s, size_t len)
+{
+	size_t	si;
+	int		r;
+
+	si = 0;
+	while (ti < g->n && g->toks[ti].type != GLOB_STAR)
+	{
+		if (si >= len)
+			return (-1);
+		if (!glob_tok_matches(&g->toks[ti++], s[si++]))
+			return (0);
+	}
+	if (ti == g->n)
+		return (si == len);
+	while (si <= len)
+	{
+		r = glob_match_at(g, ti + 1, s + si, len - si);
+		if (r != 0)
+			return (r);
+		si++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Matches the first `len` bytes of a string against a pattern.
+ * @param g Compiled pattern.
+ * @param s String.
+ * @param len Number of bytes to match.
+ * @return 1 if the pattern matches the whole range.
+ */
+int	glob_match(const t_glob *g, const char *s, size_t len)
+{
+	return (glob_match_at(g, 0, s, len) == 1);
+}
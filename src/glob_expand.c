@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_expand.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 00:14:33 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 15:57:03 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a word contains a pathname pattern.
+ * @param raw Word before expansion, quotes included.
+ * @return 1 if it has an unquoted `*`, `?` or `[...]` outside `$`
+ * expansions.
+ * @note Quoted and backslashed characters do not count, so
+ * `src/"a*".c` and `\*` stay literal; neither do `$?`, `${x%*}` and
+ * `$(...)`.
+ */
+int	word_has_glob(const char *raw)
+{
+	size_t	i;
+	size_t	end;
+
+	i = 0;
+	while (raw[i])
+	{
+		if (raw[i] == '*' || raw[i] == '?'
+			|| (raw[i] == '[' && ft_strchr(raw + i + 1, ']')))
+			return (1);
+		end = word_group_skip(raw, i);
+		if (raw[i] == '\\' || (raw[i] == '$' && end == i))
+			end = i + (raw[i + 1] != '\0');
+		else if (raw[i] == '\'' || raw[i] == '"')
+			end = script_quote_end(raw, i);
+		i = end + (raw[end] != '\0');
+	}
+	return (0);
+}
+
+/**
+ * @brief Tells whether a directory entry matches a pattern component.
+ * @param pg Compiled pattern.
+ * @param i Index of the component.
+ * @param name Entry name.
+ * @return 1 on a match, 0 otherwise.
+ * @note `.` and `..` never match, and other dot files only match a
+ * component that starts with a dot.
+ */
+int	glob_name_matches(t_pathglob *pg, size_t i, const char *name)
+{
+	if (name[0] == '.' && (!name[1] || (name[1] == '.' && !name[2])))
+		return (0);
+	if (name[0] == '.' && pg->comps[i][0] != '.')
+		return (0);
+	return (glob_match(&pg->globs[i], name, ft_strlen(name)));
+}
+
+/**
+ * @brief Expands a pattern into the matching paths.
+ * @param pat Pattern (already expanded, quotes removed).
+ * @param out Vector receiving the matches in byte order.
+ * @return 0 on success, -1 on allocation failure.
+ */
+int	pathglob_expand(const char *pat, t_strvec *out)
+{
+	t_pathglob	pg;
+	size_t		start;
+	int			ret;
+
+	start = out->len;
+	ret = pathglob_init(&pg, pat, out);
+	if (ret == 0 && pat[0] == '/')
+		ret = pathglob_walk(&pg, "/", 0);
+	else if (ret == 0)
+		ret = pathglob_walk(&pg, "", 0);
+	pathglob_free(&pg);
+	if (ret == 0)
+		str_sort(out->items + start, out->len - start);
+	return (ret);
+}
+
+/**
+ * @brief Appends the pathname expansion of a word.
+ * @param v Vector receiving the words.
+ * @param word Pattern built by word_expand (ownership is taken; may be
+ * NULL).
+ * @return 0 on success, -1 on allocation failure.
+ * @note A pattern that matches nothing is kept as it is, without the
+ * backslashes that made some of its characters literal.
+ */
+int	glob_push(t_strvec *v, char *word)
+{
+	size_t	start;
+
+	if (!word)
+		return (0);
+	start = v->len;
+	if (pathglob_expand(word, v) == -1)
+		v->failed = 1;
+	if (v->len == start && !v->failed)
+		strvec_push(v, process_escapes(word));
+	free(word);
+	return (-v->failed);
+}
+
+/**
+ * @brief Expands a pattern word of a for list.
+ * @param words Array receiving the matches.
+ * @param raw Unexpanded word.
+ * @return The grown array, NULL on allocation failure.
+ */
+char	**script_add_glob(char **words, const char *raw)
+{
+	t_strvec	v;
+
+	ft_bzero(&v, sizeof(v));
+	glob_push(&v, word_expand(raw, 1));
+	return (strvec_concat(words, &v));
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 15:57:03 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Adds a character range to a bracket expression.
+ * @param tok Class token.
+ * @param lo First character.
+ * @param hi Last character (inclusive).
+ */
+void	glob_set_range(t_glob_tok *tok, unsigned char lo, unsigned char hi)
+{
+	int	c;
+
+	c = lo;
+	while (c <= hi)
+	{
+		tok->set[c / 8] |= (unsigned char)(1 << (c % 8));
+		c++;
+	}
+}
+
+/**
+ * @brief Parses a bracket expression (`[abc]`, `[a-z]`, `[!x]`).
+ * @param pat Pattern.
+ * @param i Index of the '['; moved onto the closing ']' on success.
+ * @param tok Receives the class.
+ * @return 1 if a class was parsed, 0 if the '[' is literal.
+ * @note A ']' right after the opening bracket is part of the set.
+ */
+int	glob_parse_class(const char *pat, size_t *i, t_glob_tok *tok)
+{
+	size_t			j;
+	size_t			start;
+	unsigned char	lo;
+	unsigned char	hi;
+
+	j = *i + 1;
+	ft_bzero(tok->set, sizeof(tok->set));
+	tok->negate = (pat[j] == '!' || pat[j] == '^');
+	j += tok->negate;
+	start = j;
+	while (pat[j] && (pat[j] != ']' || j == start))
+	{
+		lo = (unsigned char)pat[j++];
+		if (lo == '\\' && pat[j])
+			lo = (unsigned char)pat[j++];
+		hi = lo;
+		if (pat[j] == '-' && pat[j + 1] && pat[j + 1] != ']' && ++j)
+			hi = (unsigned char)pat[j++];
+		glob_set_range(tok, lo, hi);
+	}
+	if (!pat[j])
+		return (0);
+	tok->type = GLOB_CLASS;
+	*i = j;
+	return (1);
+}
+
+/**
+ * @brief Returns the length of the longest prefix matching a pattern.
+ * @param g Compiled pattern.
+ * @param s String.
+ * @param len Length of the string.
+ * @return Length of the longest non-empty matching prefix, 0 if none.
+ */
+size_t	glob_longest_prefix(const t_glob *g, const char *s, size_t len)
+{
+	while (len > 0)
+	{
+		if (glob_match(g, s, len))
+			return (len);
+		len--;
+	}
+	return (0);
+}
+
+/**
+ * @brief Releases a compiled pattern.
+ * @param g Compiled pattern.
+ */
+void	glob_free(t_glob *g)
+{
+	free(g->toks);
+	g->toks = NULL;
+	g->n = 0;
+}
+
+/**
+ * @brief Turns a compiled pattern without wildcards back into text.
+ * @param g Compiled pattern, released if it only has literal characters.
+ * @param text Its source, replaced then by the text it matches.
+ * @return 0 on success, -1 on allocation failure.
+ * @note Lets a component such as `\*x` be looked up directly.
+ */
+int	glob_literal(t_glob *g, char **text)
+{
+	char	*literal;
+	size_t	i;
+
+	i = 0;
+	while (i < g->n && g->toks[i].type == GLOB_LIT)
+		i++;
+	if (i < g->n)
+		return (0);
+	glob_free(g);
+	literal = process_escapes(*text);
+	if (!literal)
+		return (-1);
+	free(*text);
+	*text = literal;
+	return (0);
+}
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/07 17:41:53 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/08 16:48:11 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,9 +15,9 @@
 /**
  * @brief Executes a non-builtin command.
  * @param cmd Command structure to execute.
- * @param environ Environment variables.
+ * @param env Environment variables.
  */
-void	execute_non_builtin(t_cmd *cmd, char **environ)
+void	execute_non_builtin(t_cmd *cmd, char **env)
 {
 	char	*cmd_path;
 
@@ -29,37 +29,27 @@ void	execute_non_builtin(t_cmd *cmd, char **environ)
 		ft_putstr_fd("\n", STDERR_FILENO);
 		exit(CMD_NOT_FOUND);
 	}
-	execve(cmd_path, cmd->args, environ);
+	execve(cmd_path, cmd->args, env);
 	perror("minishell");
 	free(cmd_path);
 	exit(EXIT_FAILURE);
 }
 
 /**
- * @brief Restores the SIGINT handler and handles the child process's
- * exit status.
+ * @brief Waits for a child process and records its exit status.
  * @param pid Process ID of the child.
- * @param old_sa Previous SIGINT signal action to restore.
  */
-void	handle_child_exit(pid_t pid, struct sigaction *old_sa)
+void	handle_child_exit(pid_t pid)
 {
 	int	status;
 	int	was_signaled;
 
 	was_signaled = 0;
-	waitpid(pid, &status, 0);
-	if (WIFEXITED(status))
-		set_exit_status(WEXITSTATUS(status));
-	else if (WIFSIGNALED(status))
-	{
-		set_exit_status(128 + WTERMSIG(status));
-		if (WTERMSIG(status) == SIGINT)
-			was_signaled = 1;
-	}
+	status = 0;
+	evloop_reap(&pid, &status, 1);
+	set_exit_status(child_status(status, &was_signaled));
 	if (was_signaled)
 		write(STDOUT_FILENO, "\n", 1);
-	if (sigaction(SIGINT, old_sa, NULL) == -1)
-		perror("minishell: sigaction");
 }
 
 /**
@@ -70,47 +60,45 @@ void	handle_child_exit(pid_t pid, struct sigaction *old_sa)
  */
 void	setup_and_execute_child(t_cmd *cmd, int pipe_in, int pipe_out)
 {
-	extern char	**environ;
-
 	setup_child_signals();
-	handle_redirections(pipe_in, pipe_out, cmd->redirections);
+	if (stage_pipes(pipe_in, pipe_out) == -1
+		|| handle_redirections(cmd) == -1)
+		exit(EXIT_FAILURE);
 	if (is_builtin(cmd->args))
 	{
 		exec_builtin(cmd->args);
-		exit(g_exit_status);
+		exit(get_exit_status());
 	}
 	else
 	{
-		execute_non_builtin(cmd, environ);
+		execute_non_builtin(cmd, *get_env());
 	}
 }
 
 /**
  * @brief Handles built-in commands in the parent process.
  * @param pipeline The command pipeline structure.
+ * @note Heredocs are collected first so `read var << EOF` sees its body.
+ * Redirections of the standard streams only change the descriptor map
+ * the builtin writes through (see builtin_redirect_push).
  */
 void	handle_builtin_in_parent(t_cmd *pipeline)
 {
-	int	saved_stdin;
-	int	saved_stdout;
-	int	saved_stderr;
-	int	exit_code;
+	t_fdplan	plan;
+	int			exit_code;
 
-	saved_stdin = dup(STDIN_FILENO);
-	saved_stdout = dup(STDOUT_FILENO);
-	saved_stderr = dup(STDERR_FILENO);
-	if (handle_redirections(-1, -1, pipeline->redirections) == 0)
+	if (handle_heredoc_redirections(pipeline->redirections) == 130)
+	{
+		set_exit_status(130);
+		return ;
+	}
+	if (builtin_redirect_push(&plan, pipeline) == 0)
 	{
 		exit_code = exec_builtin(pipeline->args);
 		if (exit_code != 4242)
-			g_exit_status = exit_code;
+			set_exit_status(exit_code);
 	}
-	dup2(saved_stdin, STDIN_FILENO);
-	dup2(saved_stdout, STDOUT_FILENO);
-	dup2(saved_stderr, STDERR_FILENO);
-	close(saved_stdin);
-	close(saved_stdout);
-	close(saved_stderr);
+	builtin_redirect_pop(&plan);
 }
 
 /**
@@ -124,27 +112,23 @@ int	handle_command_pipeline(char *command, int *should_exit)
 {
 	t_cmd	*pipeline;
 	t_parse	parser;
-	int		pipeline_status;
 
 	pipeline = parse_and_validate_pipeline(command, &parser);
 	if (!pipeline)
 	{
-		if (parser.syntax_error)
-			return (1);
-		else
-			return (0);
+		procsub_reap(NULL);
+		return (parser.syntax_error != 0);
 	}
-	if (!pipeline->next && is_builtin(pipeline->args))
+	if (tail_exec_ok(pipeline))
+		exec_in_place(pipeline);
+	if (!pipeline->next && func_for_cmd(pipeline))
+		handle_function_in_parent(pipeline, func_for_cmd(pipeline),
+			should_exit);
+	else if (!pipeline->next && is_builtin(pipeline->args))
 		handle_builtin_in_parent(pipeline);
-	else
-	{
-		pipeline_status = execute_pipeline(pipeline);
-		if (pipeline_status == EXIT_CODE_EXIT)
-		{
-			*should_exit = 1;
-			set_exit_status(get_exit_status());
-		}
-	}
+	else if (execute_pipeline(pipeline) == EXIT_CODE_EXIT)
+		*should_exit = 1;
+	procsub_reap(pipeline);
 	free_pipeline(pipeline);
 	return (0);
 }
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/08 16:32:07 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/08 16:40:06 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 06:14:52 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -63,7 +63,7 @@ void	handle_child_process(int write_fd, const char *delimiter)
 	signal(SIGQUIT, SIG_IGN);
 	while (1)
 	{
-		line = readline("> ");
+		line = shell_readline("> ");
 		if (!line)
 		{
 			write(STDOUT_FILENO, "\n", 1);
@@ -84,18 +84,42 @@ void	handle_child_process(int write_fd, const char *delimiter)
  * @param read_fd File descriptor for the read end of the pipe.
  * @return The read file descriptor on success, -1 if interrupted by SIGINT.
  * @note Waits for the child process to finish and checks for signals.
+ * A memfd shares its offset with the child, so it is rewound to the start.
  */
 int	handle_parent_process(pid_t pid, int read_fd, int *was_signaled)
 {
 	int	status;
 
 	*was_signaled = 0;
-	waitpid(pid, &status, 0);
+	evloop_reap(&pid, &status, 1);
 	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGINT)
 	{
 		*was_signaled = 1;
 		close(read_fd);
 		return (-1);
 	}
+	lseek(read_fd, 0, SEEK_SET);
 	return (read_fd);
 }
+
+/**
+ * @brief Opens the buffer that holds a heredoc body.
+ * @param fds Receives the read and write descriptors.
+ * @return 0 on success, -1 on failure.
+ * @note A memfd never blocks the writer however long the body is, and it
+ * is seekable, so `read` can consume it in blocks. Falls back to a pipe.
+ * Both ends are close-on-exec.
+ */
+int	heredoc_open(int fds[2])
+{
+	fds[0] = memfd_create("minishell_heredoc", MFD_CLOEXEC);
+	if (fds[0] == -1)
+		return (pipe2(fds, O_CLOEXEC));
+	fds[1] = fcntl(fds[0], F_DUPFD_CLOEXEC, 0);
+	if (fds[1] == -1)
+	{
+		close(fds[0]);
+		return (-1);
+	}
+	return (0);
+}
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/07 15:59:37 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/07 16:26:03 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 17:46:30 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,13 +27,14 @@ void	handle_unmatched_quote(t_parse *p)
  * @brief Processes quoted string tokens.
  * @param p Parser state.
  * @param quote Quote character (' or ").
- * @note Handles escape characters and nested quotes.
+ * @note Handles escape characters and nested quotes. The contents of
+ * double quotes are expanded later, by expand_arg; `"$@"` becomes a word
+ * so that build_expanded_args can split it into arguments.
  */
 void	handle_quotes(t_parse *p, char quote)
 {
 	size_t	start;
 	char	*content;
-	char	*expanded;
 
 	start = p->pos + 1;
 	next_char(p);
@@ -43,15 +44,11 @@ void	handle_quotes(t_parse *p, char quote)
 		return ;
 	}
 	content = ft_substr(p->input, start, p->pos - start);
-	if (quote == '"')
-	{
-		expanded = expand_variables(content);
-		free(content);
-		content = expanded;
+	p->token_type = T_SINGLE_QUOTED;
+	if (quote == '"' && content && ft_strcmp(content, "$@") == 0)
+		p->token_type = T_WORD;
+	else if (quote == '"')
 		p->token_type = T_DOUBLE_QUOTED;
-	}
-	else
-		p->token_type = T_SINGLE_QUOTED;
 	free(p->token_value);
 	p->token_value = content;
 	next_char(p);
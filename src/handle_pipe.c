@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/21 16:14:25 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/13 15:25:56 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,31 +17,34 @@
  * @param child_pids Array of child process IDs.
  * @param cmd_count Number of commands (child processes).
  * @return Exit status of the last command.
+ * @note Children are reaped as they exit (see evloop_reap); without memory
+ * for their statuses they are waited for one by one instead.
  */
 int	wait_for_children(pid_t *child_pids, int cmd_count, int *was_signaled)
 {
+	int	*statuses;
 	int	last_status;
-	int	child_count;
 	int	status;
+	int	i;
 
+	*was_signaled = 0;
 	if (!child_pids)
 		return (0);
-	child_count = 0;
+	statuses = malloc(sizeof(int) * cmd_count);
+	if (statuses)
+		evloop_reap(child_pids, statuses, cmd_count);
 	last_status = 0;
-	*was_signaled = 0;
-	while (child_count < cmd_count)
+	i = 0;
+	while (i < cmd_count)
 	{
-		waitpid(child_pids[child_count], &status, 0);
-		if (WIFEXITED(status))
-			last_status = WEXITSTATUS(status);
-		else if (WIFSIGNALED(status))
-		{
-			last_status = 128 + WTERMSIG(status);
-			if (WTERMSIG(status) == SIGINT)
-				*was_signaled = 1;
-		}
-		child_count++;
+		if (statuses)
+			status = statuses[i];
+		else
+			evloop_reap(&child_pids[i], &status, 1);
+		last_status = child_status(status, was_signaled);
+		i++;
 	}
+	free(statuses);
 	return (last_status);
 }
 
@@ -49,8 +52,9 @@ int	wait_for_children(pid_t *child_pids, int cmd_count, int *was_signaled)
  * @brief Closes the previous pipe and updates the pipe arrays.
  * @param prev_pipe Array representing the previous pipe.
  * @param next_pipe Array representing the next pipe.
- * @note Ensures proper cleanup and preparation for the next command
- * in the pipeline.
+ * @note The write end of the next pipe belongs to the stage just started
+ * and is closed too, so the shell holds one pipe and a read end between
+ * stages, however long the pipeline.
  */
 void	close_and_update_pipes(int prev_pipe[2], int next_pipe[2])
 {
@@ -58,8 +62,10 @@ void	close_and_update_pipes(int prev_pipe[2], int next_pipe[2])
 		close(prev_pipe[0]);
 	if (prev_pipe[1] != -1)
 		close(prev_pipe[1]);
+	if (next_pipe[1] != -1)
+		close(next_pipe[1]);
 	prev_pipe[0] = next_pipe[0];
-	prev_pipe[1] = next_pipe[1];
+	prev_pipe[1] = -1;
 	next_pipe[0] = -1;
 	next_pipe[1] = -1;
 }
@@ -78,9 +84,11 @@ void	close_remaining_pipes(int prev_pipe[2])
 }
 
 /**
- * @brief Handles heredoc redirections for a command.
+ * @brief Handles heredoc and here-string redirections for a command.
  * @param redirections Linked list of redirections for the command.
  * @return 0 on success, 130 if heredoc was interrupted.
+ * @note A heredoc whose body came with the script text does not read the
+ * input.
  */
 int	handle_heredoc_redirections(t_redir *redirections)
 {
@@ -92,13 +100,18 @@ int	handle_heredoc_redirections(t_redir *redirections)
 	{
 		if (r->type == T_HEREDOC)
 		{
-			hd_fd = create_heredoc(r->filename);
+			if (r->body)
+				hd_fd = heredoc_from_body(r);
+			else
+				hd_fd = create_heredoc(r->filename);
 			if (hd_fd < 0)
 			{
 				return (130);
 			}
 			r->fd = hd_fd;
 		}
+		else if (r->type == T_HERESTRING)
+			r->fd = herestring_open(r->filename);
 		r = r->next;
 	}
 	return (0);
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/07 17:12:52 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/07 17:22:09 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 01:26:47 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,108 +16,83 @@
  * @brief Opens a file descriptor based on the redirection type.
  * @param redir Redirection structure containing type and filename.
  * @return File descriptor on success, -1 on error.
+ * @note Files are opened close-on-exec: only the copies a redirection
+ * plan puts in place reach the command.
  */
 int	open_redirection_fd(t_redir *redir)
 {
-	if (redir->type == T_HEREDOC)
+	if (redir->type == T_HEREDOC || redir->type == T_HERESTRING)
 		return (redir->fd);
 	else if (redir->type == T_REDIR_IN)
-		return (open(redir->filename, O_RDONLY));
+		return (open(redir->filename, O_RDONLY | O_CLOEXEC));
 	else if (redir->type == T_REDIR_OUT)
-		return (open(redir->filename, O_WRONLY | O_CREAT | O_TRUNC, 0644));
+		return (open(redir->filename,
+				O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644));
 	else if (redir->type == T_APPEND)
-		return (open(redir->filename, O_WRONLY | O_CREAT | O_APPEND, 0644));
+		return (open(redir->filename,
+				O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644));
 	return (-1);
 }
 
 /**
- * @brief Duplicates a file descriptor to a target and handles errors.
- * @param fd File descriptor to duplicate.
- * @param target Target file descriptor.
+ * @brief Puts the pipes of a forked pipeline stage on stdin and stdout.
+ * @param pipe_in Read end of the previous pipe, or -1.
+ * @param pipe_out Write end of the next pipe, or -1.
  * @return 0 on success, -1 on error.
+ * @note The caller closes the pipe ends before the redirections run, so
+ * `3>file` is never undone by closing a pipe end that happened to be 3.
  */
-int	duplicate_fd(int fd, int target)
+int	stage_pipes(int pipe_in, int pipe_out)
 {
-	if (dup2(fd, target) == -1)
-	{
-		close(fd);
-		perror("minishell");
-		return (-1);
-	}
-	close(fd);
+	if (pipe_in != -1 && dup2(pipe_in, STDIN_FILENO) == -1)
+		return (perror("minishell"), -1);
+	if (pipe_out != -1 && dup2(pipe_out, STDOUT_FILENO) == -1)
+		return (perror("minishell"), -1);
 	return (0);
 }
 
 /**
- * @brief Processes a single redirection by opening and duplicating the
- * file descriptor.
- * @param redir Redirection structure containing type and filename.
+ * @brief Applies the redirections of a command about to exec or exit.
+ * @param cmd Command; its `plan` is used when the shell compiled one
+ * before forking.
  * @return 0 on success, -1 on error.
+ * @note Runs after stage_pipes, so `cmd 2>&1 | less` sends stderr down
+ * the pipe.
  */
-int	handle_single_redirection(t_redir *redir)
+int	handle_redirections(t_cmd *cmd)
 {
-	int	fd;
+	t_fdplan	plan;
 
-	fd = open_redirection_fd(redir);
-	if (fd == -1)
-	{
-		perror("minishell");
-		set_exit_status(1);
-		exit(EXIT_FAILURE);
-	}
-	if (redir->type == T_REDIR_IN || redir->type == T_HEREDOC)
-	{
-		if (duplicate_fd(fd, STDIN_FILENO) == -1)
-			return (-1);
-	}
-	else
-	{
-		if (duplicate_fd(fd, STDOUT_FILENO) == -1)
-			return (-1);
-	}
-	return (0);
+	if (cmd->plan)
+		return (fdplan_apply(cmd->plan, 0));
+	if (fdplan_build(&plan, cmd->redirections) == -1)
+		return (-1);
+	return (fdplan_apply(&plan, 0));
 }
 
 /**
- * @brief Handles file redirections for a command.
- * @param redirections Redirection specification list.
- * @return 0 on success, -1 on error.
+ * @brief Applies the redirections of a command run by the shell itself.
+ * @param plan Receives the plan, undone by redirect_pop.
+ * @param redirections Redirections (heredocs already collected).
+ * @return 0 on success, -1 on error (the descriptors are restored).
  */
-int	handle_file_redirections(t_redir *redirections)
+int	redirect_push(t_fdplan *plan, t_redir *redirections)
 {
-	t_redir	*current;
-
-	current = redirections;
-	while (current)
-	{
-		if (handle_single_redirection(current) == -1)
-			return (-1);
-		current = current->next;
-	}
-	return (0);
+	if (fdplan_build(plan, redirections) == -1)
+		return (-1);
+	if (fdplan_apply(plan, 1) == 0)
+		return (0);
+	fdplan_restore(plan);
+	return (-1);
 }
 
 /**
- * @brief Applies redirection operations for command.
- * @param pipe_in Input file descriptor.
- * @param pipe_out Output file descriptor.
- * @param redirections Redirection specification list.
- * @return 0 on success, -1 on error.
- * @note Handles heredoc, truncate, and append modes.
+ * @brief Ends the redirections of a command run by the shell itself.
+ * @param plan Plan applied by redirect_push.
+ * @note After `exec >file` the redirections stay in place.
  */
-int	handle_redirections(int pipe_in, int pipe_out, t_redir *redirections)
+void	redirect_pop(t_fdplan *plan)
 {
-	if (pipe_in != -1)
-	{
-		if (dup2(pipe_in, STDIN_FILENO) == -1)
-			return (perror("minishell"), -1);
-		close(pipe_in);
-	}
-	if (pipe_out != -1)
-	{
-		if (dup2(pipe_out, STDOUT_FILENO) == -1)
-			return (perror("minishell"), -1);
-		close(pipe_out);
-	}
-	return (handle_file_redirections(redirections));
+	fdplan_restore(plan);
+	get_exec_ctl()->keep_fds = 0;
 }
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/23 14:06:27 by jcologne          #+#    #+#             */
-/*   Updated: 2025/04/29 18:35:14 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 01:26:47 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -49,29 +49,41 @@ void	handle_file_descriptor(t_parse *p)
 }
 
 /**
- * @brief Handles output redirection tokens (> and >>).
+ * @brief Handles output redirection tokens (>, >> and >&).
  * @param p Parser state.
- * @note Determines between truncate (>) and append (>>) modes.
+ * @note Determines between truncate (>), append (>>) and descriptor
+ * duplication (>&).
  */
 void	handle_output_redirection(t_parse *p)
 {
 	next_char(p);
 	if (p->curr_char == '>')
 		assign_value(p, T_APPEND, ">>", 1);
+	else if (p->curr_char == '&')
+		assign_value(p, T_DUP_OUT, ">&", 1);
 	else
 		assign_value(p, T_REDIR_OUT, ">", 0);
 }
 
 /**
- * @brief Handles input redirection tokens (< and <<).
+ * @brief Handles input redirection tokens (<, <<, <<< and <&).
  * @param p Parser state.
- * @note Distinguishes between regular input and heredoc redirection.
+ * @note Distinguishes between regular input, heredoc, here-string and
+ * descriptor duplication.
  */
 void	handle_input_redirection(t_parse *p)
 {
 	next_char(p);
 	if (p->curr_char == '<')
-		assign_value(p, T_HEREDOC, "<<", 1);
+	{
+		next_char(p);
+		if (p->curr_char == '<')
+			assign_value(p, T_HERESTRING, "<<<", 1);
+		else
+			assign_value(p, T_HEREDOC, "<<", 0);
+	}
+	else if (p->curr_char == '&')
+		assign_value(p, T_DUP_IN, "<&", 1);
 	else
 		assign_value(p, T_REDIR_IN, "<", 0);
 }
@@ -79,7 +91,8 @@ void	handle_input_redirection(t_parse *p)
 /**
  * @brief Processes redirection tokens during parsing.
  * @param p Parser state structure.
- * @note Handles >, >>, <, << operators and file descriptors.
+ * @note Handles >, >>, >&, <, <<, <<<, <& operators and file
+ * descriptors.
  */
 void	handle_special(t_parse *p)
 {
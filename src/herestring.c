@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   herestring.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:05:09 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the target word of a redirection.
+ * @param p Parser state positioned on the word.
+ * @param type Redirection type.
+ * @return Newly allocated word, expanded like an argument except for
+ * heredoc delimiters.
+ */
+char	*redir_target(t_parse *p, t_token type)
+{
+	t_arg	arg;
+
+	if (type == T_HEREDOC)
+		return (ft_strdup(p->token_value));
+	arg.value = p->token_value;
+	arg.type = p->token_type;
+	arg.raw = NULL;
+	return (expand_arg(&arg));
+}
+
+/**
+ * @brief Writes a here-string body followed by a newline.
+ * @param fd Destination.
+ * @param word Here-string word.
+ * @return 0 on success, -1 on error.
+ */
+int	herestring_write(int fd, const char *word)
+{
+	size_t	len;
+	ssize_t	ret;
+
+	len = ft_strlen(word);
+	while (len > 0)
+	{
+		ret = write(fd, word, len);
+		if (ret == -1 && errno == EINTR)
+			continue ;
+		if (ret <= 0)
+			return (-1);
+		word += ret;
+		len -= ret;
+	}
+	if (write(fd, "\n", 1) != 1)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Stores a large here-string in a memfd.
+ * @param word Here-string word.
+ * @return Readable descriptor positioned at the start, -1 on error.
+ */
+int	herestring_memfd(const char *word)
+{
+	int	fd;
+
+	fd = memfd_create("minishell_herestring", MFD_CLOEXEC);
+	if (fd == -1)
+	{
+		perror("minishell: here-string");
+		return (-1);
+	}
+	if (herestring_write(fd, word) == -1 || lseek(fd, 0, SEEK_SET) == -1)
+	{
+		perror("minishell: here-string");
+		close(fd);
+		return (-1);
+	}
+	return (fd);
+}
+
+/**
+ * @brief Creates the stdin descriptor of a `<<< word` redirection.
+ * @param word Expanded here-string word.
+ * @return Readable descriptor, -1 on error.
+ * @note A body that fits in the pipe buffer is written into a pipe
+ * whose write end is closed at once, so no process has to feed it;
+ * larger bodies go to a memfd.
+ */
+int	herestring_open(const char *word)
+{
+	int	fds[2];
+	int	capacity;
+
+	if (pipe2(fds, O_CLOEXEC) == -1)
+		return (herestring_memfd(word));
+	capacity = fcntl(fds[1], F_GETPIPE_SZ);
+	if (capacity < 0 || ft_strlen(word) >= capacity
+		|| herestring_write(fds[1], word) == -1)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return (herestring_memfd(word));
+	}
+	close(fds[1]);
+	return (fds[0]);
+}
+
+/**
+ * @brief Gives a heredoc the next body read with the script text.
+ * @param p Parser state holding the bodies left for the command.
+ * @param redir Redirection just parsed.
+ * @note Bodies go to the `<<` operators in order; a heredoc left without
+ * one reads its body from the input when it runs.
+ */
+void	heredoc_take(t_parse *p, t_redir *redir)
+{
+	t_heredoc	*hd;
+
+	redir->body = NULL;
+	redir->heredoc_quoted = 0;
+	if (redir->type != T_HEREDOC || !p->heredocs)
+		return ;
+	hd = p->heredocs->content;
+	p->heredocs = p->heredocs->next;
+	redir->body = hd->body;
+	redir->heredoc_quoted = hd->quoted;
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_file.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the name of the history file.
+ * @return Allocated $HISTFILE, or "$HOME" HIST_FILE_NAME when unset;
+ * NULL when HISTFILE is empty (history is then not saved).
+ */
+char	*hist_file_name(void)
+{
+	const char	*file;
+
+	file = env_value("HISTFILE");
+	if (file && !*file)
+		return (NULL);
+	if (file)
+		return (ft_strdup(file));
+	if (!env_value("HOME"))
+		return (NULL);
+	return (ft_strjoin(env_value("HOME"), HIST_FILE_NAME));
+}
+
+/**
+ * @brief Opens the history file for appending.
+ * @param h History with `file` set.
+ * @return 0 on success, -1 on failure (`fd` is then -1).
+ * @note The descriptor is moved to FDPLAN_MIN_FD or above, out of the way
+ * of `exec 3>file`, and is close-on-exec.
+ */
+int	hist_file_reopen(t_history *h)
+{
+	int	fd;
+
+	if (h->fd != -1)
+		close(h->fd);
+	h->fd = -1;
+	fd = open(h->file, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+	if (fd == -1)
+		return (-1);
+	h->fd = fcntl(fd, F_DUPFD_CLOEXEC, FDPLAN_MIN_FD);
+	close(fd);
+	return (-(h->fd == -1));
+}
+
+/**
+ * @brief Loads the history file.
+ * @param h History.
+ * @note The file is read under an exclusive lock. A file holding more
+ * than HIST_COMPACT_RATIO times the history size is rewritten with only
+ * the entries kept in memory.
+ */
+void	hist_file_open(t_history *h)
+{
+	t_strbuf	sb;
+	size_t		records;
+
+	h->file = hist_file_name();
+	if (!h->file || hist_file_reopen(h) == -1)
+		return ;
+	flock(h->fd, LOCK_EX);
+	sb_init(&sb);
+	records = 0;
+	if (sb_read_fd(&sb, h->fd) == 0)
+		records = hist_log_load(&sb);
+	sb_free(&sb);
+	if (records > HIST_COMPACT_RATIO * h->cap)
+		hist_file_compact(h);
+	flock(h->fd, LOCK_UN);
+}
+
+/**
+ * @brief Rewrites the history file with the entries in memory.
+ * @param h History, its file locked exclusively.
+ * @note The new file replaces the old one by rename. Shells waiting to
+ * append to the old file notice the swap in hist_file_lock and reopen,
+ * so no entry is lost.
+ */
+void	hist_file_compact(t_history *h)
+{
+	t_strbuf	sb;
+	uint32_t	seq;
+
+	sb_init(&sb);
+	seq = hist_first(h);
+	while (seq < h->next)
+	{
+		if (hist_line(h, seq))
+			hist_encode(hist_line(h, seq), &sb);
+		seq++;
+	}
+	if (sb_replace_file(&sb, h->file, 0600) == 0)
+		hist_file_reopen(h);
+	sb_free(&sb);
+}
+
+/**
+ * @brief Locks the history file for an append.
+ * @param h History.
+ * @return 0 with a shared lock held, -1 on failure.
+ * @note If the file was replaced (compacted by another shell, or
+ * removed) since it was opened, the current one is opened instead.
+ */
+int	hist_file_lock(t_history *h)
+{
+	struct stat	fst;
+	struct stat	pst;
+	int			tries;
+
+	tries = 0;
+	while (h->fd != -1 && tries++ < 3)
+	{
+		if (flock(h->fd, LOCK_SH) == 0 && fstat(h->fd, &fst) == 0
+			&& stat(h->file, &pst) == 0 && fst.st_ino == pst.st_ino
+			&& fst.st_dev == pst.st_dev)
+			return (0);
+		hist_file_reopen(h);
+	}
+	return (-1);
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_index.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Adds an entry to the gram index.
+ * @param h History.
+ * @param seq Sequence number of the new entry.
+ * @note Each distinct gram of the line gets `seq` appended to its list
+ * once; lists stay sorted since entries are added in order. The index is
+ * pruned once stale postings outnumber live ones.
+ */
+void	hist_index_add(t_history *h, uint32_t seq)
+{
+	t_hist_slot	*slot;
+	t_hist_post	*p;
+	size_t		i;
+
+	slot = &h->ring[seq % h->slots];
+	i = 0;
+	while (slot->line[i] && slot->line[i + 1] && slot->line[i + 2])
+	{
+		p = hist_post(h, hist_gram(slot->line + i++), 1);
+		if (!p || (p->len && p->seqs[p->len - 1] == seq)
+			|| hist_seqs_grow(p) == -1)
+			continue ;
+		p->seqs[p->len++] = seq;
+		slot->grams++;
+	}
+	h->postings += slot->grams;
+	h->live += slot->grams;
+	if (h->postings > 2 * h->live + HIST_INDEX_SLACK)
+		hist_index_prune(h);
+}
+
+/**
+ * @brief Removes erased entries from every posting list.
+ * @param h History.
+ * @note Keeps the index proportional to the history it describes.
+ */
+void	hist_index_prune(t_history *h)
+{
+	t_hist_post	*p;
+	size_t		i;
+	size_t		j;
+	size_t		k;
+
+	h->postings = 0;
+	i = 0;
+	while (i < h->grams_cap)
+	{
+		p = &h->grams[i++];
+		j = 0;
+		k = 0;
+		while (j < p->len)
+		{
+			if (hist_line(h, p->seqs[j]))
+				p->seqs[k++] = p->seqs[j];
+			j++;
+		}
+		p->len = k;
+		h->postings += k;
+	}
+}
+
+/**
+ * @brief Erases every history entry (`history -c`).
+ * @param h History.
+ * @note The file is left alone, as in bash.
+ */
+void	hist_clear(t_history *h)
+{
+	uint32_t	seq;
+
+	seq = hist_first(h);
+	while (h->ring && seq < h->next)
+	{
+		if (hist_line(h, seq))
+			hist_drop(h, seq);
+		seq++;
+	}
+	hist_index_prune(h);
+	if (h->lines)
+		hist_lines_rehash(h);
+}
+
+/**
+ * @brief Renumbers the live entries to squeeze out erased ones.
+ * @param h History whose ring wrapped onto a live entry.
+ * @note The entries are placed again, oldest first, from `next` on; the
+ * tables are rebuilt on the way. With at most `cap` live entries in
+ * twice as many slots, this runs at most once every `cap` additions.
+ */
+void	hist_compact(t_history *h)
+{
+	char		**lines;
+	size_t		n;
+	size_t		i;
+	uint32_t	seq;
+
+	lines = malloc(sizeof(char *) * (h->count + 1));
+	if (!lines)
+		return ;
+	n = 0;
+	seq = hist_first(h);
+	while (seq < h->next)
+	{
+		lines[n] = hist_line(h, seq);
+		if (lines[n])
+			h->ring[seq % h->slots].line = NULL;
+		n += (lines[n] != NULL);
+		seq++;
+	}
+	h->count = 0;
+	h->live = 0;
+	hist_clear(h);
+	i = 0;
+	while (i < n)
+		hist_place(h, lines[i++]);
+	free(lines);
+}
+
+/**
+ * @brief Releases the history and closes its file.
+ */
+void	hist_free(void)
+{
+	t_history	*h;
+	size_t		i;
+
+	h = get_history();
+	i = 0;
+	while (h->ring && i < h->slots)
+		free(h->ring[i++].line);
+	i = 0;
+	while (i < h->grams_cap)
+		free(h->grams[i++].seqs);
+	free(h->ring);
+	free(h->lines);
+	free(h->grams);
+	free(h->draft);
+	free(h->query);
+	free(h->file);
+	if (h->fd != -1)
+		close(h->fd);
+	ft_bzero(h, sizeof(t_history));
+	h->fd = -1;
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_keys.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Goes back to the line being typed before a new prompt.
+ */
+void	hist_nav_reset(void)
+{
+	t_history	*h;
+
+	h = get_history();
+	h->nav = h->next;
+	free(h->draft);
+	h->draft = NULL;
+	free(h->query);
+	h->query = NULL;
+}
+
+/**
+ * @brief Puts a history entry in the line being edited.
+ * @param h History.
+ * @param seq Entry to show; `next` brings back the typed line.
+ * @note The typed line is saved when navigation leaves it.
+ */
+void	hist_show(t_history *h, uint32_t seq)
+{
+	t_rl_api	*rl;
+	const char	*line;
+
+	rl = get_rl_api();
+	if (h->nav == h->next && seq != h->next)
+	{
+		free(h->draft);
+		h->draft = ft_strdup(*rl->line_buffer);
+	}
+	line = hist_line(h, seq);
+	if (seq == h->next)
+		line = h->draft;
+	if (!line)
+		line = "";
+	rl->replace_line(line, 0);
+	*rl->point = *rl->end;
+	h->nav = seq;
+}
+
+/**
+ * @brief readline command showing the previous history entry.
+ * @param count Repeat count (unused).
+ * @param key Key pressed (unused).
+ * @return 0.
+ */
+int	hist_key_prev(int count, int key)
+{
+	t_history	*h;
+	uint32_t	seq;
+
+	(void)count;
+	(void)key;
+	h = get_history();
+	seq = h->nav;
+	while (seq > hist_first(h) && !hist_line(h, seq - 1))
+		seq--;
+	if (seq <= hist_first(h) || !h->ring)
+		return (get_rl_api()->ding());
+	hist_show(h, seq - 1);
+	return (0);
+}
+
+/**
+ * @brief readline command showing the next history entry.
+ * @param count Repeat count (unused).
+ * @param key Key pressed (unused).
+ * @return 0.
+ */
+int	hist_key_next(int count, int key)
+{
+	t_history	*h;
+	uint32_t	seq;
+
+	(void)count;
+	(void)key;
+	h = get_history();
+	if (h->nav >= h->next)
+		return (get_rl_api()->ding());
+	seq = h->nav + 1;
+	while (seq < h->next && !hist_line(h, seq))
+		seq++;
+	hist_show(h, seq);
+	return (0);
+}
+
+/**
+ * @brief readline command searching the history backwards (Ctrl-R).
+ * @param count Repeat count (unused).
+ * @param key Key pressed (unused).
+ * @return 0.
+ * @note The typed text is the query: the line is replaced by the newest
+ * entry containing it, and pressing Ctrl-R again on that entry moves to
+ * the next older match. Editing the line starts a new search.
+ */
+int	hist_key_search(int count, int key)
+{
+	t_history	*h;
+	t_rl_api	*rl;
+	const char	*line;
+	uint32_t	seq;
+
+	(void)count;
+	(void)key;
+	h = get_history();
+	rl = get_rl_api();
+	line = hist_line(h, h->nav);
+	if (!h->query || !line || ft_strcmp(*rl->line_buffer, line))
+	{
+		free(h->query);
+		h->query = ft_strdup(*rl->line_buffer);
+		h->nav = h->next;
+	}
+	seq = 0;
+	if (h->query)
+		seq = hist_search(h, h->query, h->nav);
+	if (!seq)
+		return (rl->ding());
+	hist_show(h, seq);
+	return (0);
+}
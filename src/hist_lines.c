@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_lines.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the text of a live history entry.
+ * @param h History.
+ * @param seq Sequence number.
+ * @return The line, or NULL if the entry was erased or pushed out.
+ */
+char	*hist_line(t_history *h, uint32_t seq)
+{
+	t_hist_slot	*slot;
+
+	if (!seq || !h->ring)
+		return (NULL);
+	slot = &h->ring[seq % h->slots];
+	if (slot->seq != seq)
+		return (NULL);
+	return (slot->line);
+}
+
+/**
+ * @brief Hashes a line for the deduplication table.
+ * @param s Line.
+ * @return 32-bit FNV-1a hash.
+ */
+uint32_t	hist_hash(const char *s)
+{
+	uint32_t	h;
+
+	h = 2166136261u;
+	while (*s)
+		h = (h ^ (unsigned char)*s++) * 16777619u;
+	return (h);
+}
+
+/**
+ * @brief Finds the live entry holding a line.
+ * @param h History.
+ * @param line Line to look for.
+ * @return Its sequence number, 0 if the line is not in the history.
+ * @note Open addressing with linear probing; slots of erased entries are
+ * walked over like tombstones.
+ */
+uint32_t	hist_lines_find(t_history *h, const char *line)
+{
+	size_t	i;
+	char	*cur;
+
+	i = hist_hash(line) & (h->lines_cap - 1);
+	while (h->lines[i])
+	{
+		cur = hist_line(h, h->lines[i]);
+		if (cur && !ft_strcmp(cur, line))
+			return (h->lines[i]);
+		i = (i + 1) & (h->lines_cap - 1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Records a new entry in the deduplication table.
+ * @param h History.
+ * @param seq Sequence number of the entry (not yet counted in `next`).
+ * @note A stale slot on the probe path is reused. Once three quarters of
+ * the table is used the live entries are rehashed.
+ */
+void	hist_lines_put(t_history *h, uint32_t seq)
+{
+	size_t	i;
+
+	if ((h->lines_used + 1) * 4 > h->lines_cap * 3)
+		hist_lines_rehash(h);
+	i = hist_hash(hist_line(h, seq)) & (h->lines_cap - 1);
+	while (h->lines[i] && hist_line(h, h->lines[i]))
+		i = (i + 1) & (h->lines_cap - 1);
+	if (!h->lines[i])
+		h->lines_used++;
+	h->lines[i] = seq;
+}
+
+/**
+ * @brief Rebuilds the deduplication table from the live entries.
+ * @param h History.
+ * @note The table has at least twice `cap` slots, so live entries alone
+ * never trigger another rehash.
+ */
+void	hist_lines_rehash(t_history *h)
+{
+	uint32_t	seq;
+
+	ft_bzero(h->lines, h->lines_cap * sizeof(uint32_t));
+	h->lines_used = 0;
+	seq = hist_first(h);
+	while (seq < h->next)
+	{
+		if (hist_line(h, seq))
+			hist_lines_put(h, seq);
+		seq++;
+	}
+}
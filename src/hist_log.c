@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_log.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends one history record to a buffer.
+ * @param line Entry text.
+ * @param sb Destination buffer.
+ * @note A record is one line: backslashes are doubled and newlines of
+ * multi-line commands written as "\n".
+ */
+void	hist_encode(const char *line, t_strbuf *sb)
+{
+	while (*line)
+	{
+		if (*line == '\\' || *line == '\n')
+			sb_putc(sb, '\\');
+		if (*line == '\n')
+			sb_putc(sb, 'n');
+		else
+			sb_putc(sb, *line);
+		line++;
+	}
+	sb_putc(sb, '\n');
+}
+
+/**
+ * @brief Decodes one history record.
+ * @param rec Record text, without its newline.
+ * @param len Length of the record.
+ * @return Allocated entry text, or NULL on allocation failure.
+ */
+char	*hist_decode(const char *rec, size_t len)
+{
+	t_strbuf	sb;
+	size_t		i;
+	char		c;
+
+	sb_init(&sb);
+	i = 0;
+	while (i < len)
+	{
+		c = rec[i++];
+		if (c == '\\' && i < len)
+		{
+			c = rec[i++];
+			if (c == 'n')
+				c = '\n';
+		}
+		sb_putc(&sb, c);
+	}
+	return (sb_detach(&sb));
+}
+
+/**
+ * @brief Adds the records of a history file to the history.
+ * @param sb File contents.
+ * @return Number of records read.
+ * @note Records are replayed oldest first, so deduplication and the size
+ * cap leave the most recent entries, as if typed again.
+ */
+size_t	hist_log_load(t_strbuf *sb)
+{
+	char	*start;
+	char	*end;
+	char	*line;
+	size_t	records;
+
+	records = 0;
+	start = sb->data;
+	while (start && start < sb->data + sb->len)
+	{
+		end = ft_memchr(start, '\n', sb->data + sb->len - start);
+		if (!end)
+			end = sb->data + sb->len;
+		line = hist_decode(start, end - start);
+		if (line)
+			hist_add(line);
+		free(line);
+		records++;
+		start = end + 1;
+	}
+	return (records);
+}
+
+/**
+ * @brief Appends an entry to the history file.
+ * @param h History.
+ * @param line Entry text.
+ * @note The record goes out in a single write on an O_APPEND descriptor,
+ * so records of shells sharing the file never interleave.
+ */
+void	hist_log_append(t_history *h, const char *line)
+{
+	t_strbuf	sb;
+
+	if (h->fd == -1)
+		return ;
+	sb_init(&sb);
+	hist_encode(line, &sb);
+	if (!sb.failed && hist_file_lock(h) == 0)
+	{
+		write(h->fd, sb.data, sb.len);
+		flock(h->fd, LOCK_UN);
+	}
+	sb_free(&sb);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_post.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Packs the three bytes at `s` into a gram key.
+ * @param s At least three bytes of text.
+ * @return The key, never 0 since text holds no NUL.
+ */
+uint32_t	hist_gram(const char *s)
+{
+	return ((uint32_t)(unsigned char)s[0]
+		| (uint32_t)(unsigned char)s[1] << 8
+		| (uint32_t)(unsigned char)s[2] << 16);
+}
+
+/**
+ * @brief Returns the home slot of a gram in the index table.
+ * @param gram Gram key.
+ * @param cap Table size, a power of two.
+ * @return Slot number.
+ * @note Fibonacci hashing, so grams sharing their first byte spread out.
+ */
+size_t	hist_gram_slot(uint32_t gram, size_t cap)
+{
+	return ((size_t)(((uint64_t)gram * 0x9E3779B97F4A7C15ULL) >> 32)
+		& (cap - 1));
+}
+
+/**
+ * @brief Finds the posting list of a gram.
+ * @param h History.
+ * @param gram Gram key.
+ * @param create 1 to add an empty list when the gram is new.
+ * @return The list, or NULL if absent (or on allocation failure).
+ */
+t_hist_post	*hist_post(t_history *h, uint32_t gram, int create)
+{
+	size_t	i;
+
+	if (create && (h->grams_used + 1) * 2 > h->grams_cap
+		&& hist_post_grow(h) == -1)
+		return (NULL);
+	if (!h->grams_cap)
+		return (NULL);
+	i = hist_gram_slot(gram, h->grams_cap);
+	while (h->grams[i].gram && h->grams[i].gram != gram)
+		i = (i + 1) & (h->grams_cap - 1);
+	if (!h->grams[i].gram && !create)
+		return (NULL);
+	if (!h->grams[i].gram)
+	{
+		h->grams[i].gram = gram;
+		h->grams_used++;
+	}
+	return (&h->grams[i]);
+}
+
+/**
+ * @brief Doubles the gram table.
+ * @param h History.
+ * @return 0 on success, -1 on allocation failure (table unchanged).
+ */
+int	hist_post_grow(t_history *h)
+{
+	t_hist_post	*grown;
+	size_t		n;
+	size_t		i;
+	size_t		j;
+
+	n = h->grams_cap * 2;
+	if (!n)
+		n = HIST_MIN_TABLE;
+	grown = ft_calloc(n, sizeof(t_hist_post));
+	if (!grown)
+		return (-1);
+	i = 0;
+	while (i < h->grams_cap)
+	{
+		j = hist_gram_slot(h->grams[i].gram, n);
+		while (h->grams[i].gram && grown[j].gram)
+			j = (j + 1) & (n - 1);
+		if (h->grams[i].gram)
+			grown[j] = h->grams[i];
+		i++;
+	}
+	free(h->grams);
+	h->grams = grown;
+	h->grams_cap = n;
+	return (0);
+}
+
+/**
+ * @brief Makes room for one more sequence number in a posting list.
+ * @param p Posting list.
+ * @return 0 on success, -1 on allocation failure.
+ */
+int	hist_seqs_grow(t_hist_post *p)
+{
+	uint32_t	*grown;
+	uint32_t	cap;
+
+	if (p->len < p->cap)
+		return (0);
+	cap = p->cap * 2;
+	if (!cap)
+		cap = 4;
+	grown = malloc(sizeof(uint32_t) * cap);
+	if (!grown)
+		return (-1);
+	if (p->len)
+		ft_memcpy(grown, p->seqs, sizeof(uint32_t) * p->len);
+	free(p->seqs);
+	p->seqs = grown;
+	p->cap = cap;
+	return (0);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hist_search.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the oldest entry that may still be live.
+ * @param h History.
+ * @return Its sequence number (`next` for an empty history).
+ * @note Moves `oldest` past erased entries, each one only once.
+ */
+uint32_t	hist_first(t_history *h)
+{
+	while (h->oldest < h->next && !hist_line(h, h->oldest))
+		h->oldest++;
+	return (h->oldest);
+}
+
+/**
+ * @brief Picks the shortest posting list among the grams of a query.
+ * @param h History.
+ * @param query Search text, at least three bytes long.
+ * @return The list, or NULL if some gram appears in no entry.
+ */
+t_hist_post	*hist_rarest(t_history *h, const char *query)
+{
+	t_hist_post	*best;
+	t_hist_post	*p;
+	size_t		i;
+
+	best = NULL;
+	i = 0;
+	while (query[i] && query[i + 1] && query[i + 2])
+	{
+		p = hist_post(h, hist_gram(query + i++), 0);
+		if (!p || !p->len)
+			return (NULL);
+		if (!best || p->len < best->len)
+			best = p;
+	}
+	return (best);
+}
+
+/**
+ * @brief Walks a posting list back from an entry for a match.
+ * @param h History.
+ * @param p Posting list of a gram of `query`.
+ * @param query Search text.
+ * @param before Only entries older than this are considered.
+ * @return Sequence number of the newest matching entry, 0 if none.
+ * @note A binary search finds where to start; candidates are then
+ * confirmed with a substring test, which also skips erased entries.
+ */
+uint32_t	hist_search_post(t_history *h, t_hist_post *p,
+	const char *query, uint32_t before)
+{
+	size_t	lo;
+	size_t	hi;
+	size_t	mid;
+	char	*line;
+
+	lo = 0;
+	hi = p->len;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (p->seqs[mid] < before)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	while (lo--)
+	{
+		line = hist_line(h, p->seqs[lo]);
+		if (line && ft_strnstr(line, query, ft_strlen(line)))
+			return (p->seqs[lo]);
+	}
+	return (0);
+}
+
+/**
+ * @brief Scans the history back from an entry for a match.
+ * @param h History.
+ * @param query Search text, shorter than a gram.
+ * @param before Only entries older than this are considered.
+ * @return Sequence number of the newest matching entry, 0 if none.
+ */
+uint32_t	hist_search_scan(t_history *h, const char *query, uint32_t before)
+{
+	uint32_t	first;
+	char		*line;
+
+	first = hist_first(h);
+	while (before-- > first)
+	{
+		line = hist_line(h, before);
+		if (line && ft_strnstr(line, query, ft_strlen(line)))
+			return (before);
+	}
+	return (0);
+}
+
+/**
+ * @brief Finds the newest entry containing a text.
+ * @param h History.
+ * @param query Search text.
+ * @param before Only entries older than this are considered.
+ * @return Sequence number of the entry, 0 if none matches.
+ * @note Queries of three bytes or more only look at the entries listed
+ * under their rarest gram, so a search stays fast on a large history.
+ */
+uint32_t	hist_search(t_history *h, const char *query, uint32_t before)
+{
+	t_hist_post	*p;
+
+	if (!h->ring)
+		return (0);
+	if (ft_strlen(query) < 3)
+		return (hist_search_scan(h, query, before));
+	p = hist_rarest(h, query);
+	if (!p)
+		return (0);
+	return (hist_search_post(h, p, query, before));
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 09:48:27 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the command history of the shell.
+ * @return History of the current shell context (empty until hist_init).
+ */
+t_history	*get_history(void)
+{
+	return (&get_shell_ctx()->history);
+}
+
+/**
+ * @brief Sets the history up for an interactive shell.
+ * @return 0 on success, -1 if history is off or cannot be allocated.
+ * @note Keeps HISTSIZE entries (HIST_DEFAULT_SIZE when unset or invalid,
+ * at most HIST_MAX_SIZE, none for 0) in a ring of twice as many slots,
+ * then loads the history file.
+ */
+int	hist_init(void)
+{
+	t_history	*h;
+	char		*size;
+	long		cap;
+
+	h = get_history();
+	size = env_value("HISTSIZE");
+	cap = HIST_DEFAULT_SIZE;
+	if (ft_isnumber(size) && ft_strlen(size) < 10)
+		cap = ft_atoi(size);
+	if (cap > HIST_MAX_SIZE)
+		cap = HIST_MAX_SIZE;
+	if (cap <= 0)
+		return (-1);
+	h->cap = cap;
+	h->slots = 2 * h->cap;
+	h->lines_cap = HIST_MIN_TABLE;
+	while (h->lines_cap < h->slots)
+		h->lines_cap *= 2;
+	h->ring = ft_calloc(h->slots, sizeof(t_hist_slot));
+	h->lines = ft_calloc(h->lines_cap, sizeof(uint32_t));
+	h->next = 1;
+	if (!h->ring || !h->lines)
+		return (hist_free(), -1);
+	hist_file_open(h);
+	return (0);
+}
+
+/**
+ * @brief Adds an accepted line to the history.
+ * @param line Command text.
+ * @return 1 if the line was added, 0 if it was skipped.
+ * @note An earlier copy of the line is erased, so each command appears
+ * once, at its latest use; repeating the newest entry changes nothing.
+ * With `cap` entries kept, the oldest makes room. Erased entries leave
+ * holes in the ring, squeezed out by hist_compact when the ring wraps.
+ */
+int	hist_add(const char *line)
+{
+	t_history	*h;
+	uint32_t	old;
+	char		*copy;
+
+	h = get_history();
+	if (!h->ring || !*line)
+		return (0);
+	old = hist_lines_find(h, line);
+	if (old && old == h->next - 1)
+		return (0);
+	copy = ft_strdup(line);
+	if (!copy)
+		return (0);
+	if (old)
+		hist_drop(h, old);
+	else if (h->count == h->cap)
+		hist_drop(h, hist_first(h));
+	if (h->ring[h->next % h->slots].line)
+		hist_compact(h);
+	if (h->ring[h->next % h->slots].line)
+		hist_drop(h, h->ring[h->next % h->slots].seq);
+	hist_place(h, copy);
+	return (1);
+}
+
+/**
+ * @brief Stores a line as the newest entry.
+ * @param h History, the slot of `next` free.
+ * @param line Entry text (ownership is taken).
+ */
+void	hist_place(t_history *h, char *line)
+{
+	t_hist_slot	*slot;
+
+	slot = &h->ring[h->next % h->slots];
+	slot->line = line;
+	slot->seq = h->next;
+	slot->grams = 0;
+	hist_lines_put(h, h->next);
+	hist_index_add(h, h->next++);
+	h->count++;
+}
+
+/**
+ * @brief Erases one history entry.
+ * @param h History.
+ * @param seq Sequence number of a live entry.
+ * @note Its slots in the line table and the gram index go stale and are
+ * skipped by lookups until the next rehash or prune.
+ */
+void	hist_drop(t_history *h, uint32_t seq)
+{
+	t_hist_slot	*slot;
+
+	slot = &h->ring[seq % h->slots];
+	free(slot->line);
+	slot->line = NULL;
+	h->live -= slot->grams;
+	slot->grams = 0;
+	h->count--;
+}
+
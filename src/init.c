@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 09:53:29 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/08 16:30:40 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,8 +24,9 @@ void	init_parser(t_parse *p, char *input)
 	p->curr_char = input[0];
 	p->token_type = T_EOF;
 	p->token_value = NULL;
-	p->redir_fd = 0;
+	p->redir_fd = -1;
 	p->syntax_error = 0;
+	p->heredocs = NULL;
 }
 
 /**
@@ -76,18 +77,13 @@ int	initialize_pipeline_resources(t_cmd *pipeline, int prev_pipe[2],
  * @brief Initializes the pipeline context and resources.
  * @param pipeline Linked list of commands to execute.
  * @param ctx Pointer to the pipeline context to initialize.
- * @param old_sa Pointer to the old sigaction structure to restore later.
  * @return 0 on success, 1 on failure.
  */
-int	initialize_pipeline(t_cmd *pipeline,
-	t_pipeline_context *ctx, struct sigaction *old_sa)
+int	initialize_pipeline(t_cmd *pipeline, t_pipeline_context *ctx)
 {
 	if (initialize_pipeline_resources(pipeline, ctx->prev_pipe,
 			ctx->next_pipe, &ctx->child_pids))
-	{
-		sigaction(SIGINT, old_sa, NULL);
 		return (1);
-	}
 	ctx->index = 0;
 	ctx->current = pipeline;
 	return (0);
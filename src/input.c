@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 18:13:53 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/07 16:55:27 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 17:42:10 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,7 +20,10 @@
  *
  * @note Expansion rules:
  * - `$VAR` → Replaced with environment variable value.
+ * - `${...}`, `$((...))` and `$(...)` → See expand_param, expand_arith
+ *   and expand_cmdsub.
  * - `$?` → Replaced with the last exit status.
+ * - `$1`..`$9`, `$#`, `$@`, `$*`, `$0` → See special_param_value.
  * - Single-quoted strings suppress expansion.
  * - Double-quoted strings allow `$VAR` and `$?` expansion.
  */
@@ -31,10 +34,11 @@ char	*expand_variable(const char *input, size_t *i)
 	char	*var_name;
 	char	*var_value;
 
-	if (input[*i] == '?')
+	if (is_special_param(input[*i]))
 	{
-		value = ft_itoa(get_exit_status());
-		(*i)++;
+		value = special_param_value(input[(*i)++]);
+		if (!value)
+			value = ft_strdup("");
 	}
 	else
 	{
@@ -42,7 +46,7 @@ char	*expand_variable(const char *input, size_t *i)
 		while (input[*i] && (ft_isalnum(input[*i]) || input[*i] == '_'))
 			(*i)++;
 		var_name = ft_substr(input, start, *i - start);
-		var_value = getenv(var_name);
+		var_value = env_value(var_name);
 		if (var_value)
 			value = ft_strdup(var_value);
 		else
@@ -56,10 +60,9 @@ char	*expand_variable(const char *input, size_t *i)
  * @brief Expands a variable or `$?` and appends it to the result string.
  * @param input The input string to process.
  * @param i Pointer to the current index in the input string.
- * @param result Pointer to the result string being built.
- * @return Updated result string with the expanded variable appended.
+ * @param out Expansion built so far.
  */
-char	*expand_and_append_variable(const char *input, size_t *i, char *result)
+void	expand_and_append_variable(const char *input, size_t *i, t_strbuf *out)
 {
 	char	*var_value;
 
@@ -67,46 +70,32 @@ char	*expand_and_append_variable(const char *input, size_t *i, char *result)
 	if (input[*i])
 	{
 		var_value = expand_variable(input, i);
-		result = ft_strjoin_free(result, var_value);
+		if (var_value)
+			sb_append(out, var_value, ft_strlen(var_value));
 		free(var_value);
 	}
-	return (result);
 }
 
 /**
  * @brief Expands environment variables and `$?` in a string.
  * @param input The input string to process.
  * @return char* New string with variables expanded. Must be freed by the caller.
+ * @note Backslashes are left as they are (see expand_escaped).
  */
 char	*expand_variables(const char *input)
 {
-	char	*result;
-	size_t	i;
-
-	i = 0;
-	result = ft_strdup("");
-	while (input[i])
-	{
-		if (input[i] == '$' && (input[i + 1] == '?'
-				|| ft_isalpha(input[i + 1]) || input[i + 1] == '_'))
-			result = expand_and_append_variable(input, &i, result);
-		else
-			result = ft_strjoin_char(result, input[i++]);
-		if (!result)
-			return (NULL);
-	}
-	return (result);
+	return (expand_escaped(input, EXPAND_PLAIN));
 }
 
 /**
  * @brief Executes external programs via fork/exec.
  * @param cmd Command structure with arguments.
- * @note Uses PATH resolution and reports command errors.
+ * @note Uses PATH resolution and reports command errors. Descriptors the
+ * command must not inherit are closed first.
  */
 void	exec_external_command(t_cmd *cmd)
 {
-	extern char	**environ;
-	char		*path;
+	char	*path;
 
 	if (!cmd->args[0])
 	{
@@ -123,7 +112,9 @@ void	exec_external_command(t_cmd *cmd)
 		ft_putstr_fd(": command not found\n", STDERR_FILENO);
 		exit(CMD_NOT_FOUND);
 	}
-	execve(path, cmd->args, environ);
+	close_stray_fds(cmd);
+	fd_debug_check(cmd);
+	execve(path, cmd->args, *get_env());
 	perror("minishell");
 	free(path);
 	exit(EXIT_FAILURE);
@@ -137,7 +128,8 @@ void	exec_external_command(t_cmd *cmd)
  */
 int	handle_redirection(t_redir *current, int fd)
 {
-	if (current->type == T_REDIR_IN || current->type == T_HEREDOC)
+	if (current->type == T_REDIR_IN || current->type == T_HEREDOC
+		|| current->type == T_HERESTRING)
 	{
 		if (dup2(fd, STDIN_FILENO) == -1)
 		{
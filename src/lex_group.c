@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lex_group.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 18:06:02 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Skips a quoted section inside an expansion group.
+ * @param p Parser state positioned on the opening quote.
+ * @note Leaves the parser on the closing quote (or at end of input).
+ */
+void	skip_group_quote(t_parse *p)
+{
+	char	quote;
+
+	quote = p->curr_char;
+	next_char(p);
+	while (p->curr_char && p->curr_char != quote)
+	{
+		if (p->curr_char == '\\' && quote == '"')
+			next_char(p);
+		next_char(p);
+	}
+}
+
+/**
+ * @brief Tells whether an expansion group starts at the parser position.
+ * @param p Parser state.
+ * @param ws State of the word being read.
+ * @return 1 on `$(`, `${` (also inside double quotes), `<(` or `>(`,
+ * and on a backslash quoting the next character, so that `my\ file` or
+ * `a\|b` stays one word.
+ */
+int	word_group_at(t_parse *p, t_word_state *ws)
+{
+	char	next;
+
+	next = p->input[p->pos + 1];
+	if ((p->curr_char == '$' && (next == '(' || next == '{'))
+		|| (p->curr_char == '\\' && next))
+		return (!ws->in_quote || ws->quote_char == '"');
+	if ((p->curr_char == '<' || p->curr_char == '>') && next == '(')
+		return (!ws->in_quote);
+	return (0);
+}
+
+/**
+ * @brief Skips a `$(...)`, `$((...))`, `${...}`, `<(...)` or `>(...)`
+ * group inside a word, or a backslash and the character it quotes.
+ * @param p Parser state positioned on the '$', '<', '>' or '\'.
+ * @note Whitespace and metacharacters inside the group belong to the word,
+ * so `$((a < b))` is a single token.
+ */
+void	skip_expansion_group(t_parse *p)
+{
+	char	open;
+	char	close;
+	int		depth;
+
+	open = p->input[p->pos + 1];
+	close = '}';
+	if (open == '(')
+		close = ')';
+	depth = (p->curr_char != '\\');
+	next_char(p);
+	next_char(p);
+	while (p->curr_char && depth > 0)
+	{
+		if (p->curr_char == '\'' || p->curr_char == '"')
+			skip_group_quote(p);
+		else if (p->curr_char == open)
+			depth++;
+		else if (p->curr_char == close)
+			depth--;
+		next_char(p);
+	}
+}
+
+/**
+ * @brief Finds the character closing a bracketed group in a string.
+ * @param s String to scan.
+ * @param i Index of the opening '(' or '{'.
+ * @return Index of the matching closer, 0 if the group is unterminated.
+ * @note Quoted sections are skipped.
+ */
+size_t	match_group_end(const char *s, size_t i)
+{
+	char	open;
+	char	close;
+	int		depth;
+	char	quote;
+
+	open = s[i];
+	close = '}';
+	if (open == '(')
+		close = ')';
+	depth = 0;
+	quote = 0;
+	while (s[i])
+	{
+		if (quote && s[i] == quote)
+			quote = 0;
+		else if (!quote && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else if (!quote && s[i] == open)
+			depth++;
+		else if (!quote && s[i] == close && --depth == 0)
+			return (i);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Skips a `$(...)` group while splitting a command line.
+ * @param str Current position.
+ * @param in_single Non-zero inside single quotes, where `$(` is literal.
+ * @return Pointer to the closing ')' of the group, or `str` unchanged.
+ * @note Keeps `$(a; b)` in one command when splitting on ';'.
+ */
+const char	*skip_subst_group(const char *str, int in_single)
+{
+	size_t	end;
+
+	if (in_single || str[0] != '$' || str[1] != '(')
+		return (str);
+	end = match_group_end(str, 1);
+	if (!end)
+		return (str);
+	return (str + end);
+}
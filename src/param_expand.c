@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:42:10 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Expands `${...}` and appends the result.
+ * @param input String being expanded.
+ * @param i Index of the '$'; moved past the closing '}'.
+ * @param out Expansion built so far.
+ * @note On error nothing is appended and the command is dropped.
+ */
+void	expand_param(const char *input, size_t *i, t_strbuf *out)
+{
+	size_t	end;
+	char	*body;
+	char	*value;
+
+	end = match_group_end(input, *i + 1);
+	if (!end)
+	{
+		sb_putc(out, input[(*i)++]);
+		return ;
+	}
+	body = ft_calloc(end - *i - 1, 1);
+	if (body)
+		ft_memcpy(body, input + *i + 2, end - *i - 2);
+	*i = end + 1;
+	value = NULL;
+	if (body)
+		value = param_evaluate(body);
+	free(body);
+	if (!value)
+		raise_expand_error();
+	else
+		sb_append(out, value, ft_strlen(value));
+	free(value);
+}
+
+/**
+ * @brief Evaluates the body of a `${...}` expansion.
+ * @param body Text between the braces.
+ * @return Newly allocated value, or NULL on error (already reported).
+ */
+char	*param_evaluate(const char *body)
+{
+	t_param	p;
+	char	*out;
+
+	if (param_parse(body, &p) == -1)
+	{
+		free(p.name);
+		return (param_bad_subst(body));
+	}
+	p.value = param_lookup(p.name);
+	out = param_apply(&p);
+	free(p.value);
+	free(p.name);
+	return (out);
+}
+
+/**
+ * @brief Splits a `${...}` body into name, operator and word.
+ * @param body Text between the braces.
+ * @param p Receives the parsed expansion.
+ * @return 0 on success, -1 on a bad substitution.
+ */
+int	param_parse(const char *body, t_param *p)
+{
+	size_t	i;
+	size_t	start;
+
+	ft_bzero(p, sizeof(*p));
+	i = 0;
+	if (body[0] == '#' && body[1])
+		p->length = 1;
+	i += p->length;
+	start = i;
+	if (is_special_param(body[i]))
+		i++;
+	else if (ft_isalpha(body[i]) || body[i] == '_')
+	{
+		while (ft_isalnum(body[i]) || body[i] == '_')
+			i++;
+	}
+	if (i == start)
+		return (-1);
+	p->name = ft_substr(body, start, i - start);
+	if (!p->name || (p->length && body[i]))
+		return (-1);
+	return (param_split_op(body + i, p));
+}
+
+/**
+ * @brief Reads the operator following the parameter name.
+ * @param rest Text after the name.
+ * @param p Receives the operator and the (unexpanded) word.
+ * @return 0 on success, -1 on an unknown operator.
+ * @note Special parameters cannot be assigned with `${?=word}`.
+ */
+int	param_split_op(const char *rest, t_param *p)
+{
+	size_t	len;
+
+	len = 0;
+	if (rest[0] == ':' && rest[1] && ft_strchr("-=+?", rest[1]))
+		len = 2;
+	else if (rest[0] && ft_strchr("-=+?%#/", rest[0]))
+	{
+		len = 1;
+		if (ft_strchr("%#/", rest[0]) && rest[1] == rest[0])
+			len = 2;
+	}
+	else if (rest[0])
+		return (-1);
+	if (is_special_param(p->name[0]) && len && rest[len - 1] == '=')
+		return (-1);
+	ft_strlcpy(p->op, rest, len + 1);
+	p->word = rest + len;
+	return (0);
+}
+
+/**
+ * @brief Returns a copy of a parameter's value.
+ * @param name Variable name or special parameter.
+ * @return Newly allocated value, or NULL if the variable is unset.
+ */
+char	*param_lookup(const char *name)
+{
+	char	*value;
+
+	if (is_special_param(name[0]))
+		return (special_param_value(name[0]));
+	value = env_value(name);
+	if (!value)
+		return (NULL);
+	return (ft_strdup(value));
+}
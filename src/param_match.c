@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_match.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 15:02:18 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Finds the prefix removed by `#` / `##`.
+ * @param g Compiled pattern.
+ * @param s Value.
+ * @param longest 1 for `##`.
+ * @return Length of the prefix to remove (0 if none matches).
+ */
+size_t	param_prefix_len(const t_glob *g, const char *s, int longest)
+{
+	size_t	n;
+	size_t	i;
+	size_t	k;
+
+	n = ft_strlen(s);
+	i = 0;
+	while (i <= n)
+	{
+		k = i;
+		if (longest)
+			k = n - i;
+		if (glob_match(g, s, k))
+			return (k);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Finds the suffix removed by `%` / `%%`.
+ * @param g Compiled pattern.
+ * @param s Value.
+ * @param longest 1 for `%%`.
+ * @return Index where the suffix to remove starts (strlen if none).
+ */
+size_t	param_suffix_start(const t_glob *g, const char *s, int longest)
+{
+	size_t	n;
+	size_t	i;
+	size_t	start;
+
+	n = ft_strlen(s);
+	i = 0;
+	while (i <= n)
+	{
+		start = n - i;
+		if (longest)
+			start = i;
+		if (glob_match(g, s + start, n - start))
+			return (start);
+		i++;
+	}
+	return (n);
+}
+
+/**
+ * @brief Evaluates `#`, `##`, `%` and `%%`.
+ * @param p Parsed expansion.
+ * @return Newly allocated result, or NULL on allocation failure.
+ */
+char	*param_trim(t_param *p)
+{
+	t_glob		g;
+	char		*pattern;
+	const char	*s;
+	char		*out;
+
+	s = p->value;
+	if (!s)
+		s = "";
+	pattern = expand_variables(p->word);
+	if (!pattern || glob_compile(pattern, &g) == -1)
+	{
+		free(pattern);
+		return (NULL);
+	}
+	free(pattern);
+	if (p->op[0] == '#')
+		out = ft_strdup(s + param_prefix_len(&g, s, p->op[1] == '#'));
+	else
+		out = ft_substr(s, 0, param_suffix_start(&g, s, p->op[1] == '%'));
+	glob_free(&g);
+	return (out);
+}
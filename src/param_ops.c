@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 15:02:18 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reports a malformed `${...}` expansion.
+ * @param body Text between the braces.
+ * @return Always NULL.
+ */
+char	*param_bad_subst(const char *body)
+{
+	ft_putstr_fd("minishell: ${", STDERR_FILENO);
+	ft_putstr_fd((char *)body, STDERR_FILENO);
+	ft_putstr_fd("}: bad substitution\n", STDERR_FILENO);
+	return (NULL);
+}
+
+/**
+ * @brief Applies the operator of a parsed `${...}` expansion.
+ * @param p Parsed expansion with its value looked up.
+ * @return Newly allocated result, or NULL on error.
+ */
+char	*param_apply(t_param *p)
+{
+	char	buf[PF_NUM_BUF];
+
+	if (p->length)
+	{
+		if (!p->value)
+			return (ft_strdup("0"));
+		pf_utoa(buf, ft_strlen(p->value), 10, 0);
+		return (ft_strdup(buf));
+	}
+	if (!p->op[0] && !p->value)
+		return (ft_strdup(""));
+	if (!p->op[0])
+		return (ft_strdup(p->value));
+	if (ft_strchr("-=+?", p->op[ft_strlen(p->op) - 1]))
+		return (param_default(p));
+	if (p->op[0] == '/')
+		return (param_replace(p));
+	return (param_trim(p));
+}
+
+/**
+ * @brief Reports `${name:?word}` on an unset or empty parameter.
+ * @param p Parsed expansion.
+ * @param word Expanded word, freed here.
+ * @return Always NULL.
+ */
+char	*param_unset_error(t_param *p, char *word)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(p->name, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	if (word && *word)
+		ft_putstr_fd(word, STDERR_FILENO);
+	else
+		ft_putstr_fd("parameter null or not set", STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+	free(word);
+	return (NULL);
+}
+
+/**
+ * @brief Evaluates `-`, `=`, `+` and `?` (with or without ':').
+ * @param p Parsed expansion.
+ * @return Newly allocated result, or NULL on error.
+ * @note With ':' an empty value counts as unset. The word is only
+ * expanded when it is used.
+ */
+char	*param_default(t_param *p)
+{
+	int		unset;
+	char	op;
+	char	*word;
+
+	unset = (!p->value || (p->op[0] == ':' && !*p->value));
+	op = p->op[ft_strlen(p->op) - 1];
+	if (op == '+' && unset)
+		return (ft_strdup(""));
+	if (op == '+')
+		return (expand_variables(p->word));
+	if (!unset)
+		return (ft_strdup(p->value));
+	word = expand_variables(p->word);
+	if (op == '?')
+		return (param_unset_error(p, word));
+	if (op == '=' && word && set_env_value(p->name, word) == -1)
+	{
+		free(word);
+		return (NULL);
+	}
+	return (word);
+}
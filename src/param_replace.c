@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   param_replace.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:02:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 15:02:18 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Splits and expands the `pat/rep` word of `${name/pat/rep}`.
+ * @param p Parsed expansion.
+ * @param pattern Receives the expanded pattern.
+ * @param rep Receives the expanded replacement ("" when omitted).
+ * @return 0 on success, -1 on allocation failure.
+ * @note The word is split before expansion so a '/' coming from a
+ * variable does not end the pattern.
+ */
+int	param_replace_args(t_param *p, char **pattern, char **rep)
+{
+	const char	*slash;
+	char		*raw;
+
+	slash = ft_strchr(p->word, '/');
+	if (slash)
+		raw = ft_substr(p->word, 0, slash - p->word);
+	else
+		raw = ft_strdup(p->word);
+	*pattern = NULL;
+	if (raw)
+		*pattern = expand_variables(raw);
+	free(raw);
+	if (slash)
+		*rep = expand_variables(slash + 1);
+	else
+		*rep = ft_strdup("");
+	if (*pattern && *rep)
+		return (0);
+	free(*pattern);
+	free(*rep);
+	return (-1);
+}
+
+/**
+ * @brief Replaces the longest matches of a pattern in a string.
+ * @param g Compiled pattern.
+ * @param s Value.
+ * @param rep Replacement text.
+ * @param global 1 to replace every match (`//`), 0 for the first only.
+ * @return Newly allocated result, or NULL on allocation failure.
+ */
+char	*param_substitute(const t_glob *g, const char *s, const char *rep,
+			int global)
+{
+	t_strbuf	sb;
+	size_t		n;
+	size_t		i;
+	size_t		len;
+
+	sb_init(&sb);
+	n = ft_strlen(s);
+	i = 0;
+	while (i < n)
+	{
+		len = 0;
+		if (global >= 0)
+			len = glob_longest_prefix(g, s + i, n - i);
+		if (len && !global)
+			global = -1;
+		if (len)
+			sb_append(&sb, rep, ft_strlen(rep));
+		else
+			sb_putc(&sb, s[i]);
+		i += len + (len == 0);
+	}
+	return (sb_detach(&sb));
+}
+
+/**
+ * @brief Evaluates `/pat/rep` and `//pat/rep`.
+ * @param p Parsed expansion.
+ * @return Newly allocated result, or NULL on allocation failure.
+ */
+char	*param_replace(t_param *p)
+{
+	t_glob	g;
+	char	*pattern;
+	char	*rep;
+	char	*out;
+
+	if (!p->value)
+		return (ft_strdup(""));
+	if (param_replace_args(p, &pattern, &rep) == -1)
+		return (NULL);
+	out = NULL;
+	if (!*pattern)
+		out = ft_strdup(p->value);
+	else if (glob_compile(pattern, &g) == 0)
+	{
+		out = param_substitute(&g, p->value, rep, p->op[1] == '/');
+		glob_free(&g);
+	}
+	free(pattern);
+	free(rep);
+	return (out);
+}
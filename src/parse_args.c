@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/23 14:36:26 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/07 16:27:50 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,6 +25,7 @@ void	process_argument(t_parse *p, t_list **args)
 	arg = malloc(sizeof(t_arg));
 	arg->value = ft_strdup(p->token_value);
 	arg->type = p->token_type;
+	arg->raw = ft_substr(p->input, p->token_start, p->pos - p->token_start);
 	ft_lstadd_back(args, ft_lstnew(arg));
 }
 
@@ -43,15 +44,17 @@ t_redir	*process_redirection(t_parse *p, t_list **args, t_redir *redirs)
 	redir = malloc(sizeof(t_redir));
 	if (!redir)
 		return (NULL);
-	redir->fd = p->redir_fd;
+	redir->fd = -1;
+	redir->io_number = p->redir_fd;
 	redir->type = p->token_type;
 	next_token(p);
 	if (!p->token_value || (p->token_type != T_WORD && p->token_type
 			!= T_SINGLE_QUOTED && p->token_type != T_DOUBLE_QUOTED))
 		return (free(redir), handle_redir_error(p, args, redirs));
-	p->redir_fd = 0;
-	redir->filename = ft_strdup(p->token_value);
+	p->redir_fd = -1;
+	redir->filename = redir_target(p, redir->type);
 	redir->next = NULL;
+	heredoc_take(p, redir);
 	if (p->syntax_error)
 	{
 		free(redir);
@@ -82,8 +85,11 @@ t_cmd	*create_command(t_list *args, t_redir *redirs)
 		return (NULL);
 	}
 	cmd->args = build_expanded_args(args);
+	procsub_claim(NULL, cmd);
 	cmd->redirections = redirs;
 	cmd->next = NULL;
+	cmd->script = NULL;
+	cmd->plan = NULL;
 	ft_lstclear(&args, free_arg);
 	return (cmd);
 }
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 18:43:01 by luinasci          #+#             */
-/*   Updated: 2025/05/07 14:42:01 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 17:33:51 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,12 +17,18 @@
  * @param p Parser state.
  * @param quote Quote character (' or ").
  * @return 1 if the closing quote is found, 0 otherwise.
+ * @note Inside double quotes a backslash skips the character after it,
+ * so `"a\\"` ends at its last quote.
  */
 int	advance_to_closing_quote(t_parse *p, char quote)
 {
-	while (p->curr_char && (p->curr_char != quote
-			|| (p->input[p->pos - 1] == '\\' && quote == '"')))
+	while (p->curr_char && p->curr_char != quote)
 	{
+		if (quote == '"' && p->curr_char == '$' && p->input[p->pos + 1] == '(')
+		{
+			skip_expansion_group(p);
+			continue ;
+		}
 		if (p->curr_char == '\\' && quote == '"')
 			next_char(p);
 		next_char(p);
@@ -77,6 +83,7 @@ void	next_token(t_parse *p)
 	skip_whitespace(p);
 	free(p->token_value);
 	p->token_value = NULL;
+	p->token_start = p->pos;
 	if (!p->curr_char)
 	{
 		p->token_type = T_EOF;
@@ -85,7 +92,8 @@ void	next_token(t_parse *p)
 	if (p->curr_char == '\'' || p->curr_char == '"')
 		handle_quotes(p, p->curr_char);
 	else if (p->curr_char == '|' || p->curr_char == ';'
-		|| p->curr_char == '>' || p->curr_char == '<')
+		|| ((p->curr_char == '>' || p->curr_char == '<')
+			&& p->input[p->pos + 1] != '(') || at_fd_redirection(p))
 		handle_special(p);
 	else
 		handle_word(p);
@@ -94,7 +102,8 @@ void	next_token(t_parse *p)
 /**
  * @brief Processes unquoted word tokens.
  * @param p Parser state.
- * @note Collects characters until whitespace or special character.
+ * @note Collects characters until whitespace or special character;
+ * `$(...)`, `${...}`, `<(...)` and `>(...)` groups are kept whole.
  */
 void	handle_word(t_parse *p)
 {
@@ -102,8 +111,8 @@ void	handle_word(t_parse *p)
 	t_quote_state	quote_state;
 
 	init_word_and_quote_states(p, &word_state, &quote_state);
-	while (p->curr_char && (!ft_isspace(p->curr_char)
-			&& (!is_special_char(p->curr_char) || word_state.in_quote)))
+	while (p->curr_char && (word_state.in_quote || word_group_at(p, &word_state)
+			|| (!ft_isspace(p->curr_char) && !is_special_char(p->curr_char))))
 	{
 		if (!word_state.in_quote && (p->curr_char == '\''
 				|| p->curr_char == '"'))
@@ -112,6 +121,8 @@ void	handle_word(t_parse *p)
 		else if (word_state.in_quote && p->curr_char == word_state.quote_char)
 			word_state.value = handle_end_of_quote(p, word_state.value,
 					&word_state.segment_start, &word_state.in_quote);
+		else if (word_group_at(p, &word_state))
+			skip_expansion_group(p);
 		else
 			next_char(p);
 	}
@@ -6,42 +6,69 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/17 09:46:38 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/07 16:50:14 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 17:46:30 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
+/**
+ * @brief Expands a single parsed argument according to its quoting.
+ * @param a Argument to expand.
+ * @return Newly allocated expanded string.
+ * @note Process substitutions are started before any other expansion.
+ * The backslashes of a word are removed while it expands, so those
+ * inside `$(...)` reach the substituted command. Inside double quotes
+ * only those before `$`, `"`, `\` and `` ` `` are, so `"\$HOME"` stays
+ * a literal `$HOME`.
+ */
+char	*expand_arg(t_arg *a)
+{
+	char	*substituted;
+	char	*expanded;
+
+	if (a->type == T_SINGLE_QUOTED)
+		return (ft_strdup(a->value));
+	if (a->type == T_DOUBLE_QUOTED)
+		return (expand_escaped(a->value, EXPAND_DQUOTE));
+	substituted = expand_procsub(a->value);
+	if (!substituted)
+		return (NULL);
+	expanded = expand_escaped(substituted, EXPAND_WORD);
+	free(substituted);
+	return (expanded);
+}
+
 /**
  * @brief Converts a list of t_arg structs to an array of expanded strings.
  *
  * @param args Linked list of t_arg structs.
  * @return char** Array of expanded arguments. Must be freed with ft_free_array.
+ * @note `"$@"` expands to one argument per positional parameter, and to
+ * none at all when there are no parameters. Words with an unquoted `*`,
+ * `?` or `[...]` expand to the matching paths.
  */
 char	**build_expanded_args(t_list *args)
 {
-	char	**arr;
-	t_list	*current;
-	int		i;
-	t_arg	*a;
-	char	*processed;
+	t_strvec	v;
+	t_arg		*arg;
+	char		*value;
 
-	arr = malloc(sizeof(char *) * (ft_lstsize(args) + 1));
-	current = args;
-	i = 0;
-	while (current)
+	ft_bzero(&v, sizeof(v));
+	while (args && !v.failed)
 	{
-		a = (t_arg *)current->content;
-		if (a->type == T_SINGLE_QUOTED)
-			arr[i++] = ft_strdup(a->value);
+		arg = (t_arg *)args->content;
+		if (arg->type == T_WORD && ft_strcmp(arg->value, "$@") == 0)
+			positional_push(&v);
+		else if (arg->type == T_WORD && arg->raw && word_has_glob(arg->raw))
+			glob_push(&v, word_expand(arg->raw, 1));
 		else
 		{
-			processed = process_escapes(a->value);
-			arr[i++] = expand_variables(processed);
-			free(processed);
+			value = expand_arg(arg);
+			if (value)
+				strvec_push(&v, value);
 		}
-		current = current->next;
+		args = args->next;
 	}
-	arr[i] = NULL;
-	return (arr);
+	return (strvec_finish(&v));
 }
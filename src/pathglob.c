@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pathglob.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 00:14:33 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 15:57:03 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Splits a pattern into path components and compiles them.
+ * @param pg Receives the compiled pattern.
+ * @param pat Pattern such as `src/main*.c`.
+ * @param out Vector receiving the matches.
+ * @return 0 on success, -1 on allocation failure.
+ * @note Each component with an unescaped `*`, `?` or `[...]` is compiled
+ * once here, however many directories it is matched in; the others stay
+ * literal, their backslashes removed (see glob_literal).
+ */
+int	pathglob_init(t_pathglob *pg, const char *pat, t_strvec *out)
+{
+	size_t	i;
+
+	ft_bzero(pg, sizeof(*pg));
+	pg->out = out;
+	pg->dirs_only = (pat[0] && pat[ft_strlen(pat) - 1] == '/');
+	pg->comps = ft_split(pat, '/');
+	if (!pg->comps)
+		return (-1);
+	while (pg->comps[pg->n])
+		pg->n++;
+	pg->globs = ft_calloc(pg->n + 1, sizeof(t_glob));
+	if (!pg->globs)
+		return (-1);
+	i = 0;
+	while (i < pg->n)
+	{
+		if (glob_compile(pg->comps[i], &pg->globs[i]) == -1
+			|| glob_literal(&pg->globs[i], &pg->comps[i]) == -1)
+			return (-1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Frees a compiled path pattern.
+ * @param pg Compiled pattern.
+ */
+void	pathglob_free(t_pathglob *pg)
+{
+	size_t	i;
+
+	i = 0;
+	while (pg->globs && i < pg->n)
+		glob_free(&pg->globs[i++]);
+	free(pg->globs);
+	ft_free_array(pg->comps);
+	pg->globs = NULL;
+	pg->comps = NULL;
+}
+
+/**
+ * @brief Matches the components of a pattern from a given one on.
+ * @param pg Compiled pattern.
+ * @param prefix Directory reached so far ("" or ending with '/').
+ * @param i Index of the next component.
+ * @return 0 on success, -1 on allocation failure.
+ * @note Literal components are appended without any stat call; only a
+ * literal last component following a pattern is checked with lstat.
+ */
+int	pathglob_walk(t_pathglob *pg, const char *prefix, size_t i)
+{
+	struct stat	st;
+	char		*path;
+	int			ret;
+
+	path = ft_strdup(prefix);
+	while (path && i < pg->n && !pg->globs[i].toks)
+	{
+		path = ft_strjoin_free(path, pg->comps[i++]);
+		if (path && (i < pg->n || pg->dirs_only))
+			path = ft_strjoin_free(path, "/");
+	}
+	if (!path)
+		return (-1);
+	if (i == pg->n && lstat(path, &st) == 0)
+		return (strvec_push(pg->out, path));
+	ret = 0;
+	if (i < pg->n)
+		ret = pathglob_scan(pg, path, i);
+	free(path);
+	return (ret);
+}
+
+/**
+ * @brief Matches one pattern component against a directory.
+ * @param pg Compiled pattern.
+ * @param dir Directory to scan ("" or ending with '/').
+ * @param i Index of the pattern component.
+ * @return 0 on success (including unreadable directories), -1 on
+ * allocation failure.
+ */
+int	pathglob_scan(t_pathglob *pg, const char *dir, size_t i)
+{
+	t_dirscan	ds;
+	t_dirent64	*ent;
+	char		*path;
+	size_t		dlen;
+	int			ret;
+
+	if (dirscan_open(&ds, dir) == -1)
+		return (0);
+	dlen = ft_strlen(dir);
+	ret = 0;
+	ent = dirscan_next(&ds);
+	while (ent && ret == 0)
+	{
+		if (glob_name_matches(pg, i, ent->name))
+		{
+			path = dirscan_path(dir, dlen, ent->name);
+			ret = -1;
+			if (path)
+				ret = pathglob_take(pg, path, ent, i);
+		}
+		ent = dirscan_next(&ds);
+	}
+	dirscan_close(&ds);
+	return (ret);
+}
+
+/**
+ * @brief Records a matching entry or descends into it.
+ * @param pg Compiled pattern.
+ * @param path Path of the entry (ownership is taken).
+ * @param ent Directory entry.
+ * @param i Index of the component it matched.
+ * @return 0 on success, -1 on allocation failure.
+ */
+int	pathglob_take(t_pathglob *pg, char *path, t_dirent64 *ent, size_t i)
+{
+	int	ret;
+
+	if (i + 1 == pg->n && !pg->dirs_only)
+		return (strvec_push(pg->out, path));
+	ret = 0;
+	if (dirent_is_dir(path, ent))
+	{
+		path = ft_strjoin_free(path, "/");
+		if (!path)
+			return (-1);
+		if (i + 1 == pg->n)
+			return (strvec_push(pg->out, path));
+		ret = pathglob_walk(pg, path, i + 1);
+	}
+	free(path);
+	return (ret);
+}
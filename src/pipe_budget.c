@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_budget.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 14:08:37 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 14:08:37 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Counts the descriptors the shell has open.
+ * @return The count, or -1 if /proc/self/fd cannot be read.
+ * @note The descriptor used for the scan itself is left out.
+ */
+int	fd_count_open(void)
+{
+	t_dirscan	ds;
+	t_dirent64	*ent;
+	int			count;
+
+	if (dirscan_open(&ds, "/proc/self/fd") == -1)
+		return (-1);
+	count = 0;
+	ent = dirscan_next(&ds);
+	while (ent)
+	{
+		if (ft_isdigit(ent->name[0]))
+			count++;
+		ent = dirscan_next(&ds);
+	}
+	dirscan_close(&ds);
+	return (count - 1);
+}
+
+/**
+ * @brief Works out how many descriptors a pipeline needs in the shell.
+ * @param pipeline Pipeline about to run.
+ * @return The number of descriptors.
+ * @note The shell holds at most two pipes at once, plus the files and
+ * saved descriptors of the stage being started; the number of stages
+ * does not matter (children are waited for through a bounded window of
+ * pidfds, see evloop_watch).
+ */
+int	pipe_fd_need(t_cmd *pipeline)
+{
+	t_redir	*r;
+	int		redirs;
+	int		most;
+
+	most = 0;
+	while (pipeline)
+	{
+		redirs = 0;
+		r = pipeline->redirections;
+		while (r)
+		{
+			redirs++;
+			r = r->next;
+		}
+		if (redirs > most)
+			most = redirs;
+		pipeline = pipeline->next;
+	}
+	return (PIPE_PARENT_FDS + 2 * most);
+}
+
+/**
+ * @brief Checks the descriptor budget of a pipeline before it starts.
+ * @param pipeline Pipeline about to run.
+ * @return 0 if it fits under RLIMIT_NOFILE, -1 otherwise.
+ * @note Failing here leaves nothing half started, where running out of
+ * descriptors at stage 300 would leave the first 299 without a reader.
+ */
+int	pipe_fd_budget(t_cmd *pipeline)
+{
+	struct rlimit	lim;
+	int				open_fds;
+	int				need;
+
+	if (getrlimit(RLIMIT_NOFILE, &lim) == -1 || lim.rlim_cur == RLIM_INFINITY)
+		return (0);
+	open_fds = fd_count_open();
+	need = pipe_fd_need(pipeline);
+	if (open_fds < 0 || (rlim_t)(open_fds + need) <= lim.rlim_cur)
+		return (0);
+	ft_putstr_fd("minishell: pipeline: too many open files (", STDERR_FILENO);
+	ft_putnbr_fd(open_fds, STDERR_FILENO);
+	ft_putstr_fd(" open, ", STDERR_FILENO);
+	ft_putnbr_fd(need, STDERR_FILENO);
+	ft_putstr_fd(" more needed, limit ", STDERR_FILENO);
+	ft_putnbr_fd((int)lim.rlim_cur, STDERR_FILENO);
+	ft_putstr_fd(")\n", STDERR_FILENO);
+	return (-1);
+}
@@ -6,62 +6,46 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/08 16:30:16 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/08 16:31:07 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/19 14:00:00 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
 /**
- * @brief Sets up signal handling for the pipeline execution.
- * @param sa Pointer to the new sigaction structure.
- * @param old_sa Pointer to the old sigaction structure to restore later.
+ * @brief Creates a pipe and handles errors.
+ * @param next_pipe Array representing the next pipe.
  * @return 0 on success, 1 on failure.
  */
-int	setup_signal_handling(struct sigaction *sa, struct sigaction *old_sa)
+int	create_pipe(int next_pipe[2])
 {
-	sa->sa_handler = SIG_IGN;
-	sa->sa_flags = SA_RESTART;
-	sigemptyset(&sa->sa_mask);
-	if (sigaction(SIGINT, sa, old_sa) == -1)
+	if (pipe2(next_pipe, O_CLOEXEC) < 0)
 	{
-		perror("minishell: sigaction");
+		perror("minishell: pipe");
 		return (1);
 	}
 	return (0);
 }
 
 /**
- * @brief Sets up and restores signal handling for pipeline execution.
- * @param old_sa Pointer to the old sigaction structure to restore later.
- * @param was_signaled Pointer to a flag indicating if a signal was received.
- * @return 0 on success, 1 on failure.
+ * @brief Gives up on a pipeline after some of its stages started.
+ * @param ctx Pipeline context.
+ * @param exit_code Exit status to record.
+ * @return exit_code.
+ * @note The shell's pipe ends are closed first, so the stages already
+ * running see end of input or SIGPIPE; they are then waited for instead
+ * of being left behind as zombies.
  */
-int	manage_signal_handling(struct sigaction *old_sa, int was_signaled)
+int	pipeline_abort(t_pipeline_context *ctx, int exit_code)
 {
-	if (was_signaled)
-		write(STDOUT_FILENO, "\n", 1);
-	if (sigaction(SIGINT, old_sa, NULL) == -1)
-	{
-		perror("minishell: sigaction");
-		return (1);
-	}
-	return (0);
-}
+	int	was_signaled;
 
-/**
- * @brief Creates a pipe and handles errors.
- * @param next_pipe Array representing the next pipe.
- * @param child_pids Array of child process IDs to free in case of error.
- * @return 0 on success, 1 on failure.
- */
-int	create_pipe(int next_pipe[2], pid_t *child_pids)
-{
-	if (pipe(next_pipe) < 0)
-	{
-		perror("minishell: pipe");
-		free(child_pids);
-		return (1);
-	}
-	return (0);
+	close_remaining_pipes(ctx->prev_pipe);
+	close_remaining_pipes(ctx->next_pipe);
+	ft_memset(ctx->prev_pipe, -1, sizeof(ctx->prev_pipe));
+	ft_memset(ctx->next_pipe, -1, sizeof(ctx->next_pipe));
+	wait_for_children(ctx->child_pids, ctx->index, &was_signaled);
+	get_pipe_stats()->on = 0;
+	set_exit_status(exit_code);
+	return (cleanup_on_failure(&ctx->child_pids, exit_code));
 }
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_spawn.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 14:08:37 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:53:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Works out the standard streams a stage would end up with.
+ * @param pipes Previous and next pipes of the stage.
+ * @param cmd Stage, with its redirection plan compiled.
+ * @param map Receives the descriptors of stdin, stdout and stderr.
+ * @return 0 if the stage can be started without forking the shell, -1
+ * otherwise.
+ * @note Only plain external commands qualify, whose redirections touch
+ * the standard streams alone (see fdplan_virtual) and that would not
+ * inherit any other descriptor: no process substitution, none of the
+ * shell's own, as left by `exec 3>file`, and none the shell inherited
+ * (see fd_inherit_scan). A stage whose redirection failed is left to
+ * the usual fork, which exits with status 1 without running the
+ * command.
+ */
+int	stage_fd_map(int *pipes[2], t_cmd *cmd, int map[3])
+{
+	int	fd;
+
+	if (!cmd->args || !cmd->args[0] || cmd->script || is_builtin(cmd->args)
+		|| func_for_cmd(cmd) || procsub_next_fd(cmd, 0) != -1
+		|| (cmd->redirections && !cmd->plan)
+		|| (cmd->plan && cmd->plan->failed) || fd_inherited_next(0) != -1)
+		return (-1);
+	fd = STDERR_FILENO;
+	while (++fd < FDPLAN_MIN_FD)
+		if (fcntl(fd, F_GETFD) == 0)
+			return (-1);
+	map[STDIN_FILENO] = STDIN_FILENO;
+	if (pipes[0][0] != -1)
+		map[STDIN_FILENO] = pipes[0][0];
+	map[STDOUT_FILENO] = STDOUT_FILENO;
+	if (cmd->next)
+		map[STDOUT_FILENO] = pipes[1][1];
+	map[STDERR_FILENO] = STDERR_FILENO;
+	if (cmd->plan && fdplan_virtual(cmd->plan, map) == -1)
+		return (-1);
+	return (-(map[0] < 0 || map[1] < 0 || map[2] < 0));
+}
+
+/**
+ * @brief Starts a pipeline stage with posix_spawn when it can.
+ * @param pipes Previous and next pipes of the stage.
+ * @param cmd Stage, with its redirection plan compiled.
+ * @return Pid of the command, or -1 to fork it as usual.
+ * @note posix_spawn does not copy the shell's page tables, so wide
+ * pipelines launch at the same pace whatever the shell's size. A command
+ * that is not found or fails to exec is left to the usual fork, which
+ * reports the error; so is everything under MINISHELL_FD_DEBUG.
+ */
+pid_t	pipe_spawn(int *pipes[2], t_cmd *cmd)
+{
+	posix_spawn_file_actions_t	actions;
+	posix_spawnattr_t			attr;
+	int							map[3];
+	char						*path;
+	pid_t						pid;
+
+	if (env_value("MINISHELL_FD_DEBUG") || stage_fd_map(pipes, cmd, map))
+		return (-1);
+	path = get_cmd_path(cmd->args[0]);
+	if (!path)
+		return (-1);
+	pid = -1;
+	if (pipe_spawn_setup(&actions, &attr, map) == 0
+		&& posix_spawn(&pid, path, &actions, &attr, cmd->args,
+			*get_env()) != 0)
+		pid = -1;
+	posix_spawn_file_actions_destroy(&actions);
+	posix_spawnattr_destroy(&attr);
+	free(path);
+	return (pid);
+}
+
+/**
+ * @brief Prepares the descriptors and signals of a spawned stage.
+ * @param actions Receives the descriptor actions.
+ * @param attr Receives the signal attributes.
+ * @param map Descriptors of stdin, stdout and stderr.
+ * @return 0 on success, -1 on failure (both are still initialized).
+ * @note Mirrors close_stray_fds: nothing stays open past stderr.
+ */
+int	pipe_spawn_setup(posix_spawn_file_actions_t *actions,
+	posix_spawnattr_t *attr, int map[3])
+{
+	int	failed;
+	int	fd;
+
+	failed = posix_spawn_file_actions_init(actions);
+	failed |= posix_spawnattr_init(attr);
+	fd = 0;
+	while (!failed && fd <= STDERR_FILENO)
+	{
+		failed = posix_spawn_file_actions_adddup2(actions, map[fd], fd);
+		fd++;
+	}
+	if (!failed)
+		failed = posix_spawn_file_actions_addclosefrom_np(actions,
+				STDERR_FILENO + 1);
+	if (!failed)
+		failed = pipe_spawn_signals(attr);
+	return (-(failed != 0));
+}
+
+/**
+ * @brief Gives a spawned stage the signals of a forked one.
+ * @param attr Spawn attributes.
+ * @return 0 on success, an error number otherwise.
+ * @note Mirrors setup_child_signals: Ctrl+C and Ctrl+\ back to their
+ * defaults and the shell's signals unblocked, the rest of the mask kept.
+ */
+int	pipe_spawn_signals(posix_spawnattr_t *attr)
+{
+	sigset_t	mask;
+	sigset_t	shell;
+	int			sig;
+
+	sigprocmask(SIG_SETMASK, NULL, &mask);
+	shell_sigset(&shell);
+	sig = 0;
+	while (++sig < NSIG)
+		if (sigismember(&shell, sig) == 1)
+			sigdelset(&mask, sig);
+	if (posix_spawnattr_setsigmask(attr, &mask)
+		|| posix_spawnattr_setsigdefault(attr, &shell))
+		return (EINVAL);
+	return (posix_spawnattr_setflags(attr,
+			POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF));
+}
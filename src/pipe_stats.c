@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_stats.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 14:08:37 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 14:08:37 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the shell's pipeline statistics.
+ * @return Statistics of the current shell context.
+ */
+t_pipe_stats	*get_pipe_stats(void)
+{
+	return (&get_shell_ctx()->pipe_stats);
+}
+
+/**
+ * @brief Starts measuring a pipeline if MINISHELL_PIPE_STATS is set.
+ * @param stages Number of stages.
+ */
+void	pipe_stats_start(int stages)
+{
+	t_pipe_stats	*st;
+	char			*flag;
+
+	st = get_pipe_stats();
+	flag = env_value(PIPE_STATS_ENV);
+	st->on = (flag && *flag && ft_strcmp(flag, "0") != 0);
+	if (!st->on)
+		return ;
+	st->stages = stages;
+	st->fds_peak = 0;
+	clock_gettime(CLOCK_MONOTONIC, &st->start);
+	st->launched = st->start;
+	pipe_stats_sample(0);
+}
+
+/**
+ * @brief Records how many descriptors the shell has open right now.
+ * @param launched 1 once the last stage has started, to time the launch.
+ * @note Called where the count peaks: with a stage's pipes and files
+ * open, and with the pidfds of the wait.
+ */
+void	pipe_stats_sample(int launched)
+{
+	t_pipe_stats	*st;
+	int				open_fds;
+
+	st = get_pipe_stats();
+	if (!st->on)
+		return ;
+	if (launched)
+		clock_gettime(CLOCK_MONOTONIC, &st->launched);
+	open_fds = fd_count_open();
+	if (open_fds > st->fds_peak)
+		st->fds_peak = open_fds;
+}
+
+/**
+ * @brief Reports the measures of the pipeline that just finished.
+ * @note Example: `minishell: pipeline: 500 stages, launched in 41.377 ms,
+ * done in 152.906 ms, at most 9 descriptors open`.
+ */
+void	pipe_stats_report(void)
+{
+	t_pipe_stats	*st;
+	struct timespec	now;
+
+	st = get_pipe_stats();
+	if (!st->on)
+		return ;
+	st->on = 0;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	ft_putstr_fd("minishell: pipeline: ", STDERR_FILENO);
+	ft_putnbr_fd(st->stages, STDERR_FILENO);
+	if (st->stages == 1)
+		ft_putstr_fd(" stage, launched in ", STDERR_FILENO);
+	else
+		ft_putstr_fd(" stages, launched in ", STDERR_FILENO);
+	pipe_stats_ms(&st->start, &st->launched);
+	ft_putstr_fd(", done in ", STDERR_FILENO);
+	pipe_stats_ms(&st->start, &now);
+	ft_putstr_fd(", at most ", STDERR_FILENO);
+	ft_putnbr_fd(st->fds_peak, STDERR_FILENO);
+	ft_putstr_fd(" descriptors open\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Prints the time between two instants in milliseconds.
+ * @param from Start.
+ * @param to End.
+ */
+void	pipe_stats_ms(struct timespec *from, struct timespec *to)
+{
+	long	us;
+
+	us = (to->tv_sec - from->tv_sec) * 1000000L
+		+ (to->tv_nsec - from->tv_nsec) / 1000;
+	ft_putnbr_fd((int)(us / 1000), STDERR_FILENO);
+	ft_putchar_fd('.', STDERR_FILENO);
+	ft_putchar_fd('0' + us % 1000 / 100, STDERR_FILENO);
+	ft_putchar_fd('0' + us % 100 / 10, STDERR_FILENO);
+	ft_putchar_fd('0' + us % 10, STDERR_FILENO);
+	ft_putstr_fd(" ms", STDERR_FILENO);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipeline.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:57:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Frees a command pipeline and associated resources.
+ * @param pipeline Linked list of command structures.
+ */
+void	free_pipeline(t_cmd *pipeline)
+{
+	t_cmd	*current;
+	t_redir	*redir;
+	t_redir	*tmp_redir;
+
+	while (pipeline)
+	{
+		current = pipeline;
+		pipeline = pipeline->next;
+		if (current->args)
+			ft_free_array(current->args);
+		redir = current->redirections;
+		while (redir)
+		{
+			tmp_redir = redir;
+			redir = redir->next;
+			if (tmp_redir->fd >= 0)
+				close(tmp_redir->fd);
+			free(tmp_redir->filename);
+			free(tmp_redir);
+		}
+		free(current->plan);
+		free(current);
+	}
+}
+
+/**
+ * @brief Parses and validates the command pipeline.
+ * @param command The command string to process.
+ * @param parser Pointer to the parser structure.
+ * @return Parsed pipeline or NULL if an error occurs.
+ * @note Heredoc bodies left by the script node being run go to the
+ * `<<` of this pipeline only, not to those of nested substitutions.
+ */
+t_cmd	*parse_and_validate_pipeline(char *command, t_parse *parser)
+{
+	char	*trimmed_cmd;
+	t_cmd	*pipeline;
+	t_list	*heredocs;
+
+	heredocs = get_exec_ctl()->heredocs;
+	get_exec_ctl()->heredocs = NULL;
+	trimmed_cmd = ft_strtrim(command, " \t\n");
+	if (!trimmed_cmd || *trimmed_cmd == '\0')
+	{
+		free(trimmed_cmd);
+		return (NULL);
+	}
+	init_parser(parser, trimmed_cmd);
+	parser->heredocs = heredocs;
+	pipeline = parse_pipeline(parser);
+	free(trimmed_cmd);
+	if (parser->syntax_error)
+		set_exit_status(SYNTAX_ERROR);
+	if (consume_expand_error() || parser->syntax_error)
+	{
+		free_pipeline(pipeline);
+		return (NULL);
+	}
+	return (pipeline);
+}
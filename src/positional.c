@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   positional.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:37:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the current positional parameter frame.
+ * @return Pointer to the top-of-stack pointer of the current context.
+ * @note The bottom frame is the shell's own, which has no parameters.
+ */
+t_frame	**get_frame(void)
+{
+	return (&get_shell_ctx()->frame);
+}
+
+/**
+ * @brief Pushes a positional parameter frame.
+ * @param frame Frame to fill and push (owned by the caller).
+ * @param args Parameters `$1`, `$2`, ... (not copied).
+ */
+void	frame_push(t_frame *frame, char **args)
+{
+	frame->argv = args;
+	frame->argc = 0;
+	while (args && args[frame->argc])
+		frame->argc++;
+	frame->prev = *get_frame();
+	*get_frame() = frame;
+}
+
+/**
+ * @brief Tells whether a character names a special parameter.
+ * @param c Character following '$'.
+ * @return 1 for `?`, `#`, `@`, `*` and the digits, 0 otherwise.
+ */
+int	is_special_param(char c)
+{
+	return (c && ft_strchr("?#@*0123456789", c) != NULL);
+}
+
+/**
+ * @brief Returns the value of a special parameter.
+ * @param c Parameter name (see is_special_param).
+ * @return Allocated value, or NULL for an unset `$N`.
+ * @note `$@` and `$*` are joined with spaces here; argument lists
+ * expand `"$@"` to separate words instead (see positional_append).
+ */
+char	*special_param_value(char c)
+{
+	t_frame	*f;
+
+	f = *get_frame();
+	if (c == '?')
+		return (ft_itoa(get_exit_status()));
+	if (c == '0')
+		return (ft_strdup("minishell"));
+	if (c == '#')
+		return (ft_itoa(f->argc));
+	if (c == '@' || c == '*')
+		return (positional_join(f));
+	if (c - '0' > f->argc)
+		return (NULL);
+	return (ft_strdup(f->argv[c - '1']));
+}
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   positional_words.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:37:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 00:14:33 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Joins the parameters of a frame with spaces.
+ * @param f Positional parameter frame.
+ * @return Allocated string ("" without parameters), NULL on failure.
+ */
+char	*positional_join(t_frame *f)
+{
+	char	*joined;
+	int		i;
+
+	joined = ft_strdup("");
+	i = 0;
+	while (joined && i < f->argc)
+	{
+		if (i > 0)
+			joined = ft_strjoin_free(joined, " ");
+		if (joined)
+			joined = ft_strjoin_free(joined, f->argv[i]);
+		i++;
+	}
+	return (joined);
+}
+
+/**
+ * @brief Appends each positional parameter as its own word.
+ * @param words NULL-terminated array to grow.
+ * @return The grown array, NULL on allocation failure.
+ */
+char	**positional_append(char **words)
+{
+	t_frame	*f;
+	int		i;
+
+	f = *get_frame();
+	i = 0;
+	while (words && i < f->argc)
+		words = script_append(words, ft_strdup(f->argv[i++]));
+	return (words);
+}
+
+/**
+ * @brief Pushes each positional parameter as its own word.
+ * @param v Vector receiving the words.
+ * @return 0 on success, -1 on allocation failure.
+ */
+int	positional_push(t_strvec *v)
+{
+	t_frame	*f;
+	int		i;
+
+	f = *get_frame();
+	i = 0;
+	while (i < f->argc)
+	{
+		if (strvec_push(v, ft_strdup(f->argv[i++])) == -1)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Tells whether a raw word is `$@` or `"$@"`.
+ * @param raw Unexpanded word.
+ * @return 1 if it is, 0 otherwise.
+ */
+int	is_all_params(const char *raw)
+{
+	return (ft_strcmp(raw, "$@") == 0 || ft_strcmp(raw, "\"$@\"") == 0);
+}
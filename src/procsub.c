@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   procsub.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:10:36 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 02:41:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Child side of a process substitution.
+ * @param body Command text.
+ * @param fds Pipe shared with the shell.
+ * @param dir '<' when the child writes, '>' when it reads.
+ */
+void	procsub_child(const char *body, int fds[2], char dir)
+{
+	int	ret;
+
+	if (dir == '<')
+		ret = dup2(fds[1], STDOUT_FILENO);
+	else
+		ret = dup2(fds[0], STDIN_FILENO);
+	close(fds[0]);
+	close(fds[1]);
+	if (ret == -1)
+		exit(EXIT_FAILURE);
+	run_subshell(body);
+}
+
+/**
+ * @brief Records the shell's end of a process substitution.
+ * @param fd Descriptor kept by the shell.
+ * @param pid Child running the substituted command.
+ * @return The descriptor.
+ */
+int	procsub_register(int fd, pid_t pid)
+{
+	t_procsub_table	*t;
+
+	t = get_procsub_table();
+	t->entries[t->count].fd = fd;
+	t->entries[t->count].pid = pid;
+	t->entries[t->count].owner = NULL;
+	t->count++;
+	return (fd);
+}
+
+/**
+ * @brief Starts `<(body)` or `>(body)` and returns the shell's fd.
+ * @param body Command text (not NUL-terminated).
+ * @param len Length of the command text.
+ * @param dir '<' or '>'.
+ * @return Descriptor to pass as /dev/fd/N, -1 on error (reported).
+ * @note At most PROCSUB_MAX substitutions run per pipeline.
+ */
+int	procsub_start(const char *body, size_t len, char dir)
+{
+	int		fds[2];
+	pid_t	pid;
+	char	*cmd;
+
+	cmd = NULL;
+	if (get_procsub_table()->count < PROCSUB_MAX)
+		cmd = ft_substr(body, 0, len);
+	if (!cmd || pipe2(fds, O_CLOEXEC) == -1)
+	{
+		free(cmd);
+		ft_putstr_fd("minishell: cannot start process substitution\n", 2);
+		return (-1);
+	}
+	pid = fork();
+	if (pid == 0)
+		procsub_child(cmd, fds, dir);
+	free(cmd);
+	close(fds[dir == '<']);
+	if (pid != -1)
+		return (procsub_register(fds[dir != '<'], pid));
+	perror("minishell: fork");
+	close(fds[dir != '<']);
+	return (-1);
+}
+
+/**
+ * @brief Replaces one `<(...)` or `>(...)` group by its /dev/fd path.
+ * @param word Word being expanded.
+ * @param i Index of the '<' or '>'; moved past the group.
+ * @param sb Output buffer.
+ * @return 0 on success, -1 on error.
+ */
+int	procsub_expand_one(const char *word, size_t *i, t_strbuf *sb)
+{
+	size_t	end;
+	int		fd;
+	char	num[PF_NUM_BUF];
+
+	end = match_group_end(word, *i + 1);
+	if (!end)
+	{
+		sb_putc(sb, word[(*i)++]);
+		return (0);
+	}
+	fd = procsub_start(word + *i + 2, end - *i - 2, word[*i]);
+	*i = end + 1;
+	if (fd == -1)
+		return (-1);
+	pf_utoa(num, fd, 10, 0);
+	sb_append(sb, "/dev/fd/", 8);
+	sb_append(sb, num, ft_strlen(num));
+	return (0);
+}
+
+/**
+ * @brief Expands the process substitutions of an unquoted word.
+ * @param word Raw word.
+ * @return Newly allocated word, or NULL on error.
+ * @note `$(...)` groups are copied untouched for the later expansion.
+ */
+char	*expand_procsub(const char *word)
+{
+	t_strbuf	sb;
+	size_t		i;
+	size_t		end;
+
+	sb_init(&sb);
+	i = 0;
+	while (word[i])
+	{
+		end = 0;
+		if (word[i] == '$' && word[i + 1] == '(')
+			end = match_group_end(word, i + 1);
+		if (end)
+		{
+			sb_append(&sb, word + i, end + 1 - i);
+			i = end + 1;
+		}
+		else if ((word[i] == '<' || word[i] == '>') && word[i + 1] == '(')
+		{
+			if (procsub_expand_one(word, &i, &sb) == -1)
+				raise_expand_error();
+		}
+		else
+			sb_putc(&sb, word[i++]);
+	}
+	return (sb_detach(&sb));
+}
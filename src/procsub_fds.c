@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   procsub_fds.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:10:36 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the table of running process substitutions.
+ * @return Table of the current shell context.
+ */
+t_procsub_table	*get_procsub_table(void)
+{
+	return (&get_shell_ctx()->procsubs);
+}
+
+/**
+ * @brief Hands unclaimed process substitutions to a command.
+ * @param from Current owner (NULL for substitutions not yet claimed).
+ * @param to New owner.
+ * @note Called once a command's words are expanded, so each pipeline
+ * stage only keeps its own /dev/fd descriptors.
+ */
+void	procsub_claim(t_cmd *from, t_cmd *to)
+{
+	t_procsub_table	*t;
+	int				i;
+
+	t = get_procsub_table();
+	i = 0;
+	while (i < t->count)
+	{
+		if (t->entries[i].owner == from)
+			t->entries[i].owner = to;
+		i++;
+	}
+}
+
+/**
+ * @brief Closes the substitution descriptors not owned by a command.
+ * @param keep Command whose descriptors stay open (NULL closes all).
+ * @note Used in forked children, so the table itself is left intact.
+ * The shell opens them close-on-exec; those of `keep` lose the flag so
+ * the command can open its /dev/fd paths.
+ */
+void	procsub_close_others(t_cmd *keep)
+{
+	t_procsub_table	*t;
+	int				i;
+
+	t = get_procsub_table();
+	i = 0;
+	while (i < t->count)
+	{
+		if (!keep || t->entries[i].owner != keep)
+			close(t->entries[i].fd);
+		else
+			fcntl(t->entries[i].fd, F_SETFD, 0);
+		i++;
+	}
+}
+
+/**
+ * @brief Tells whether a substitution belongs to a pipeline.
+ * @param owner Owner recorded in the table.
+ * @param pipeline Pipeline that finished.
+ * @return 1 if owned by one of its stages or unclaimed, 0 otherwise.
+ */
+int	procsub_owned(t_cmd *owner, t_cmd *pipeline)
+{
+	if (!owner)
+		return (1);
+	while (pipeline)
+	{
+		if (pipeline == owner)
+			return (1);
+		pipeline = pipeline->next;
+	}
+	return (0);
+}
+
+/**
+ * @brief Closes the shell's ends of a pipeline's substitutions and waits
+ * for them.
+ * @param pipeline Pipeline that finished (NULL reaps unclaimed entries).
+ * @note Closing first lets `>(cmd)` readers see end of file. Entries of
+ * other pipelines, such as a loop's `done < <(cmd)`, stay in the table.
+ */
+void	procsub_reap(t_cmd *pipeline)
+{
+	t_procsub_table	*t;
+	int				i;
+	int				kept;
+
+	t = get_procsub_table();
+	i = 0;
+	while (i < t->count)
+	{
+		if (procsub_owned(t->entries[i].owner, pipeline))
+			close(t->entries[i].fd);
+		i++;
+	}
+	i = 0;
+	kept = 0;
+	while (i < t->count)
+	{
+		if (!procsub_owned(t->entries[i].owner, pipeline))
+			t->entries[kept++] = t->entries[i];
+		else if (waitpid(t->entries[i].pid, NULL, 0) == -1 && errno == EINTR)
+			continue ;
+		i++;
+	}
+	t->count = kept;
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rl_front.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 06:14:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 18:06:02 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the readline entry points.
+ * @return Pointer to the static t_rl_api (all NULL until loaded).
+ */
+t_rl_api	*get_rl_api(void)
+{
+	static t_rl_api	rl;
+
+	return (&rl);
+}
+
+/**
+ * @brief Loads readline when standard input is a terminal.
+ * @return 1 if readline is ready to use, 0 otherwise.
+ * @note Piped and scripted runs never map readline or its terminfo
+ * dependency; they read lines with line_read. If the library or one of
+ * its functions is missing, interactive input falls back to line_read.
+ * Tab completion goes through complete_attempt, and the history keys
+ * through the shell's own history (see rl_front_keys). An empty list of
+ * quote characters makes readline ask complete_char_quoted about each
+ * blank, so a backslashed one does not end the word being completed.
+ */
+int	rl_front_load(void)
+{
+	t_rl_api	*rl;
+
+	rl = get_rl_api();
+	rl->tty = isatty(STDIN_FILENO);
+	if (!rl->tty)
+		return (0);
+	rl->handle = dlopen(RL_LIBRARY, RTLD_NOW | RTLD_LOCAL);
+	if (!rl->handle)
+		rl->handle = dlopen(RL_LIBRARY_DEV, RTLD_NOW | RTLD_LOCAL);
+	if (!rl_front_bind(rl))
+		return (0);
+	*rl->attempted = complete_attempt;
+	*rl->char_quoted = complete_char_quoted;
+	*rl->quote_chars = "";
+	*rl->word_breaks = COMPLETE_WORD_BREAKS;
+	if (hist_init() == 0)
+		rl_front_keys(rl);
+	return (1);
+}
+
+/**
+ * @brief Binds the history keys to the shell's history.
+ * @param rl readline entry points.
+ * @note Up/Down (in both cursor key modes), Ctrl-P/Ctrl-N and Ctrl-R
+ * replace readline's own history commands, whose list the shell does
+ * not fill.
+ */
+void	rl_front_keys(t_rl_api *rl)
+{
+	rl->bind_keyseq("\\C-p", hist_key_prev);
+	rl->bind_keyseq("\\C-n", hist_key_next);
+	rl->bind_keyseq("\\e[A", hist_key_prev);
+	rl->bind_keyseq("\\e[B", hist_key_next);
+	rl->bind_keyseq("\\eOA", hist_key_prev);
+	rl->bind_keyseq("\\eOB", hist_key_next);
+	rl->bind_keyseq("\\C-r", hist_key_search);
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rl_front_bind.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 16:24:09 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 18:06:02 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Resolves the readline functions and variables in the library.
+ * @param rl readline entry points; `handle` is cleared on failure.
+ * @return 1 if every symbol was found, 0 otherwise.
+ * @note The symbols are looked up into a copy, which replaces `rl` only
+ * once all of them are found: after a failure no member points into the
+ * closed library.
+ */
+int	rl_front_bind(t_rl_api *rl)
+{
+	t_rl_api	found;
+
+	if (!rl->handle)
+		return (0);
+	found = *rl;
+	rl_bind_calls(&found);
+	rl_bind_vars(&found);
+	if (rl_bound(&found))
+	{
+		*rl = found;
+		return (1);
+	}
+	dlclose(rl->handle);
+	rl->handle = NULL;
+	return (0);
+}
+
+/**
+ * @brief Looks up the readline functions.
+ * @param rl Entry points to fill in.
+ */
+void	rl_bind_calls(t_rl_api *rl)
+{
+	rl->readline = dlsym(rl->handle, "readline");
+	rl->handler_install = dlsym(rl->handle, "rl_callback_handler_install");
+	rl->read_char = dlsym(rl->handle, "rl_callback_read_char");
+	rl->handler_remove = dlsym(rl->handle, "rl_callback_handler_remove");
+	rl->sigcleanup = dlsym(rl->handle, "rl_callback_sigcleanup");
+	rl->replace_line = dlsym(rl->handle, "rl_replace_line");
+	rl->on_new_line = dlsym(rl->handle, "rl_on_new_line");
+	rl->redisplay = dlsym(rl->handle, "rl_redisplay");
+	rl->echo_signal_char = dlsym(rl->handle, "rl_echo_signal_char");
+	rl->crlf = dlsym(rl->handle, "rl_crlf");
+	rl->ding = dlsym(rl->handle, "rl_ding");
+	rl->bind_keyseq = dlsym(rl->handle, "rl_bind_keyseq");
+}
+
+/**
+ * @brief Looks up the readline variables used by completion and history
+ * navigation.
+ * @param rl Entry points to fill in.
+ */
+void	rl_bind_vars(t_rl_api *rl)
+{
+	rl->attempted = dlsym(rl->handle, "rl_attempted_completion_function");
+	rl->line_buffer = dlsym(rl->handle, "rl_line_buffer");
+	rl->completion_over = dlsym(rl->handle, "rl_attempted_completion_over");
+	rl->suppress_append = dlsym(rl->handle,
+			"rl_completion_suppress_append");
+	rl->point = dlsym(rl->handle, "rl_point");
+	rl->end = dlsym(rl->handle, "rl_end");
+	rl->char_quoted = dlsym(rl->handle, "rl_char_is_quoted_p");
+	rl->quote_chars = dlsym(rl->handle, "rl_completer_quote_characters");
+	rl->word_breaks = dlsym(rl->handle,
+			"rl_completer_word_break_characters");
+}
+
+/**
+ * @brief Tells whether every readline symbol was found.
+ * @param rl Entry points.
+ * @return 1 if none is NULL, 0 otherwise.
+ */
+int	rl_bound(const t_rl_api *rl)
+{
+	return (rl->readline && rl->handler_install && rl->read_char
+		&& rl->handler_remove && rl->sigcleanup && rl->replace_line
+		&& rl->on_new_line && rl->redisplay && rl->echo_signal_char
+		&& rl->crlf && rl->ding && rl->bind_keyseq && rl->attempted
+		&& rl->line_buffer && rl->completion_over && rl->suppress_append
+		&& rl->point && rl->end && rl->char_quoted && rl->quote_chars
+		&& rl->word_breaks);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_case.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 19:24:07 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Consumes the `a|b*` patterns of a case item up to its `)`.
+ * @param sc Script parser state.
+ * @return Raw pattern text, NULL on error.
+ */
+char	*script_take_patterns(t_script *sc)
+{
+	size_t	start;
+	size_t	end;
+
+	script_skip_blank(sc);
+	start = sc->pos;
+	while (sc->src[sc->pos] != ')')
+	{
+		end = script_word_end(sc->src, sc->pos);
+		if (sc->src[sc->pos] == '|' && end == sc->pos)
+			end++;
+		if (end == sc->pos)
+			return (script_error(sc), NULL);
+		sc->pos = end;
+		script_skip_blank(sc);
+	}
+	if (sc->pos == start)
+		return (script_error(sc), NULL);
+	return (ft_substr(sc->src, start, sc->pos - start));
+}
+
+/**
+ * @brief Parses one `[(]pattern[|pattern]) list ;;` item.
+ * @param sc Script parser state.
+ * @return The N_CASE_ITEM node (`words` holds the raw patterns).
+ * @note The `;;` may be omitted before `esac`.
+ */
+t_node	*parse_case_item(t_script *sc)
+{
+	t_node	*item;
+
+	item = node_new(sc, N_CASE_ITEM);
+	if (!item)
+		return (NULL);
+	if (sc->src[sc->pos] == '(')
+		sc->pos++;
+	item->words = script_take_patterns(sc);
+	if (sc->error)
+		return (item);
+	sc->pos++;
+	item->body = parse_list(sc);
+	if (!sc->error && script_at_op(sc, ";;"))
+		sc->pos += 2;
+	else if (!sc->error && !script_at_word(sc, "esac"))
+		script_error(sc);
+	return (item);
+}
+
+/**
+ * @brief Parses `case word in item... esac`.
+ * @param sc Script parser state, on the `case`.
+ * @return The N_CASE node; items are chained through `alt`.
+ */
+t_node	*parse_case(t_script *sc)
+{
+	t_node	*n;
+	t_node	**tail;
+
+	n = node_new(sc, N_CASE);
+	if (!n)
+		return (NULL);
+	sc->pos = script_word_end(sc->src, sc->pos);
+	n->text = script_take_word(sc);
+	script_skip_space(sc);
+	if (!script_expect(sc, "in"))
+		return (n);
+	tail = &n->alt;
+	script_skip_space(sc);
+	while (!sc->error && sc->src[sc->pos] && !script_at_word(sc, "esac"))
+	{
+		*tail = parse_case_item(sc);
+		if (*tail)
+			tail = &(*tail)->alt;
+		script_skip_space(sc);
+	}
+	script_expect(sc, "esac");
+	return (n);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_compound.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 19:24:07 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Parses `if list; then list; [elif ...;] [else list;] fi`.
+ * @param sc Script parser state, on the `if` (or `elif`).
+ * @return The N_IF node.
+ * @note An `elif` becomes a nested N_IF in `alt`, which consumes the
+ * shared `fi`.
+ */
+t_node	*parse_if(t_script *sc)
+{
+	t_node	*n;
+
+	n = node_new(sc, N_IF);
+	if (!n)
+		return (NULL);
+	sc->pos = script_word_end(sc->src, sc->pos);
+	n->cond = parse_list(sc);
+	if (!n->cond)
+		script_error(sc);
+	if (script_expect(sc, "then"))
+		n->body = parse_list(sc);
+	if (!sc->error && !n->body)
+		script_error(sc);
+	if (!sc->error && script_at_word(sc, "elif"))
+	{
+		n->alt = parse_if(sc);
+		return (n);
+	}
+	if (!sc->error && script_at_word(sc, "else")
+		&& script_expect(sc, "else"))
+		n->alt = parse_list(sc);
+	script_expect(sc, "fi");
+	return (n);
+}
+
+/**
+ * @brief Parses the `do list; done` part of a loop.
+ * @param sc Script parser state.
+ * @param n Loop node receiving the body.
+ */
+void	parse_do_group(t_script *sc, t_node *n)
+{
+	if (script_expect(sc, "do"))
+		n->body = parse_list(sc);
+	if (!sc->error && !n->body)
+		script_error(sc);
+	script_expect(sc, "done");
+}
+
+/**
+ * @brief Parses `while list; do list; done` and its `until` form.
+ * @param sc Script parser state, on the `while` or `until`.
+ * @return The N_WHILE or N_UNTIL node.
+ */
+t_node	*parse_loop(t_script *sc)
+{
+	t_node	*n;
+
+	n = node_new(sc, N_WHILE);
+	if (!n)
+		return (NULL);
+	if (sc->src[sc->pos] == 'u')
+		n->type = N_UNTIL;
+	sc->pos = script_word_end(sc->src, sc->pos);
+	n->cond = parse_list(sc);
+	if (!n->cond)
+		script_error(sc);
+	parse_do_group(sc, n);
+	return (n);
+}
+
+/**
+ * @brief Parses `for name [in words]; do list; done`.
+ * @param sc Script parser state, on the `for`.
+ * @return The N_FOR node (`text` is the name, `words` the raw list).
+ * @note Without `in`, `words` stays NULL and the loop runs over the
+ * positional parameters.
+ */
+t_node	*parse_for(t_script *sc)
+{
+	t_node	*n;
+
+	n = node_new(sc, N_FOR);
+	if (!n)
+		return (NULL);
+	sc->pos = script_word_end(sc->src, sc->pos);
+	n->text = script_take_word(sc);
+	if (n->text && !is_valid_var_name(n->text))
+	{
+		sc->pos -= ft_strlen(n->text);
+		script_error(sc);
+	}
+	script_skip_space(sc);
+	if (!sc->error && script_at_word(sc, "in"))
+	{
+		sc->pos += 2;
+		n->words = script_take_words(sc);
+	}
+	if (!sc->error && script_at_sep(sc))
+		sc->pos++;
+	script_skip_space(sc);
+	parse_do_group(sc, n);
+	return (n);
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_exec.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Runs a pipeline through the regular parse-and-execute path.
+ * @param n N_PIPELINE node.
+ * @param should_exit Pointer to the exit flag.
+ * @return Exit status of the pipeline.
+ * @note A syntax error or Ctrl+C aborts the rest of the input line, loops
+ * included; a command that merely exits with 130 does not.
+ */
+int	ast_exec_pipeline(t_node *n, int *should_exit)
+{
+	t_exec_ctl	*ctl;
+
+	ctl = get_exec_ctl();
+	ctl->sigint = 0;
+	ctl->heredocs = n->heredocs;
+	if (handle_command_pipeline(n->text, should_exit))
+	{
+		set_exit_status(SYNTAX_ERROR);
+		ctl->abort = SYNTAX_ERROR;
+	}
+	else if (ctl->sigint)
+		ctl->abort = 130;
+	return (get_exit_status());
+}
+
+/**
+ * @brief Runs `a && b` or `a || b`.
+ * @param n N_AND or N_OR node (`cond` is the left side, `body` the right).
+ * @param should_exit Pointer to the exit flag.
+ * @return Status of the last command run.
+ */
+int	ast_exec_and_or(t_node *n, int *should_exit)
+{
+	int	status;
+
+	status = ast_exec(n->cond, should_exit);
+	if (*should_exit || exec_interrupted())
+		return (status);
+	if ((n->type == N_AND) == (status == 0))
+		status = ast_exec(n->body, should_exit);
+	return (status);
+}
+
+/**
+ * @brief Runs an if/elif/else chain.
+ * @param n N_IF node.
+ * @param should_exit Pointer to the exit flag.
+ * @return Status of the branch taken, 0 when none is.
+ */
+int	ast_exec_if(t_node *n, int *should_exit)
+{
+	int	status;
+
+	status = ast_exec_list(n->cond, should_exit);
+	if (*should_exit || exec_interrupted())
+		return (status);
+	if (status == 0)
+		return (ast_exec_list(n->body, should_exit));
+	return (ast_exec_list(n->alt, should_exit));
+}
+
+/**
+ * @brief Consumes pending `break`/`continue` levels after a loop pass.
+ * @param ctl Execution control state.
+ * @return 1 if the loop must stop, 0 to go on with the next pass.
+ * @note `continue 2` stops this loop and continues the enclosing one.
+ */
+int	ast_loop_done(t_exec_ctl *ctl)
+{
+	if (ctl->abort || ctl->ret || ctl->exited)
+		return (1);
+	if (ctl->brk)
+	{
+		ctl->brk--;
+		return (1);
+	}
+	if (ctl->cont)
+	{
+		ctl->cont--;
+		return (ctl->cont > 0);
+	}
+	return (0);
+}
+
+/**
+ * @brief Runs a while or until loop.
+ * @param n N_WHILE or N_UNTIL node.
+ * @param should_exit Pointer to the exit flag.
+ * @return Status of the last body command, 0 if the body never ran.
+ */
+int	ast_exec_loop(t_node *n, int *should_exit)
+{
+	t_exec_ctl	*ctl;
+	int			status;
+	int			cond;
+
+	ctl = get_exec_ctl();
+	ctl->loop_depth++;
+	status = 0;
+	while (!*should_exit)
+	{
+		cond = ast_exec_list(n->cond, should_exit);
+		if (ast_loop_done(ctl) || *should_exit
+			|| (cond == 0) != (n->type == N_WHILE))
+			break ;
+		status = ast_exec_list(n->body, should_exit);
+		if (ast_loop_done(ctl))
+			break ;
+	}
+	ctl->loop_depth--;
+	return (status);
+}
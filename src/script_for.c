@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_for.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 15:38:12 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Runs a for loop.
+ * @param n N_FOR node.
+ * @param should_exit Pointer to the exit flag.
+ * @return Status of the last body command, 0 if the body never ran.
+ * @note The word list is expanded once, before the first pass.
+ */
+int	ast_exec_for(t_node *n, int *should_exit)
+{
+	t_exec_ctl	*ctl;
+	char		**words;
+	int			status;
+	int			i;
+
+	words = script_expand_words(n->words);
+	if (!words)
+		return (1);
+	ctl = get_exec_ctl();
+	ctl->loop_depth++;
+	status = 0;
+	i = 0;
+	while (words[i] && !*should_exit && !ctl->abort)
+	{
+		set_env_value(n->text, words[i++]);
+		status = ast_exec_list(n->body, should_exit);
+		if (ast_loop_done(ctl))
+			break ;
+	}
+	ctl->loop_depth--;
+	ft_free_array(words);
+	return (status);
+}
+
+/**
+ * @brief Runs the first case item whose pattern matches the word.
+ * @param n N_CASE node.
+ * @param should_exit Pointer to the exit flag.
+ * @return Status of the item run, 0 when nothing matches.
+ */
+int	ast_exec_case(t_node *n, int *should_exit)
+{
+	t_node	*item;
+	char	*word;
+	int		status;
+
+	word = word_expand(n->text, 0);
+	if (!word)
+		return (1);
+	status = 0;
+	item = n->alt;
+	while (item && !ast_case_matches(item->words, word))
+		item = item->alt;
+	if (item)
+		status = ast_exec_list(item->body, should_exit);
+	free(word);
+	return (status);
+}
+
+/**
+ * @brief Tells whether any `|`-separated pattern of an item matches.
+ * @param patterns Raw pattern text of the item.
+ * @param word Expanded case word.
+ * @return 1 on the first match, 0 otherwise.
+ */
+int	ast_case_matches(const char *patterns, const char *word)
+{
+	char	*raw;
+	size_t	i;
+	size_t	end;
+	int		match;
+
+	i = 0;
+	match = 0;
+	while (!match && patterns[i])
+	{
+		end = script_word_end(patterns, i);
+		if (end > i)
+		{
+			raw = ft_substr(patterns, i, end - i);
+			match = ast_pattern_matches(raw, word);
+			free(raw);
+		}
+		i = end + (end == i);
+	}
+	return (match);
+}
+
+/**
+ * @brief Expands one pattern and matches it against the case word.
+ * @param raw Unexpanded pattern.
+ * @param word Expanded case word.
+ * @return 1 if it matches, 0 otherwise.
+ * @note Uses the same compiled matcher as `${name#pattern}`. Neither the
+ * pattern nor the word is pathname-expanded, and quoted characters of
+ * the pattern match literally (see word_expand).
+ */
+int	ast_pattern_matches(const char *raw, const char *word)
+{
+	t_glob	g;
+	char	*pat;
+	int		match;
+
+	if (!raw)
+		return (0);
+	pat = word_expand(raw, 1);
+	if (!pat || glob_compile(pat, &g) != 0)
+	{
+		free(pat);
+		return (0);
+	}
+	match = glob_match(&g, word, ft_strlen(word));
+	glob_free(&g);
+	free(pat);
+	return (match);
+}
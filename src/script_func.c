@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_func.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 20:37:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a function definition `name()` starts here.
+ * @param sc Script parser state.
+ * @return 1 if the next word is followed by `()`, 0 otherwise.
+ */
+int	script_at_funcdef(t_script *sc)
+{
+	size_t	i;
+
+	script_skip_blank(sc);
+	i = script_word_end(sc->src, sc->pos);
+	if (i == sc->pos)
+		return (0);
+	while (sc->src[i] == ' ' || sc->src[i] == '\t')
+		i++;
+	if (sc->src[i++] != '(')
+		return (0);
+	while (sc->src[i] == ' ' || sc->src[i] == '\t')
+		i++;
+	return (sc->src[i] == ')');
+}
+
+/**
+ * @brief Parses `{ list; }`.
+ * @param sc Script parser state, on the `{`.
+ * @return The N_GROUP node.
+ */
+t_node	*parse_group(t_script *sc)
+{
+	t_node	*n;
+
+	n = node_new(sc, N_GROUP);
+	if (!n)
+		return (NULL);
+	sc->pos++;
+	n->body = parse_list(sc);
+	if (!sc->error && !n->body)
+		script_error(sc);
+	script_expect(sc, "}");
+	return (n);
+}
+
+/**
+ * @brief Parses `name() compound-command [redirections]`.
+ * @param sc Script parser state, on the name.
+ * @return The N_FUNCDEF node (`text` is the name, `words` the body
+ * source, parsed again when the definition runs).
+ * @note The body parsed here is kept in `body` until the script is freed,
+ * so heredocs still waiting for their line to end stay valid.
+ */
+t_node	*parse_funcdef(t_script *sc)
+{
+	t_node	*n;
+	size_t	start;
+
+	n = node_new(sc, N_FUNCDEF);
+	if (!n)
+		return (NULL);
+	start = sc->pos;
+	n->text = script_take_word(sc);
+	if (n->text && !is_valid_var_name(n->text))
+	{
+		sc->pos = start;
+		return (script_error(sc), n);
+	}
+	sc->pos = ft_strchr(sc->src + sc->pos, ')') - sc->src + 1;
+	script_skip_space(sc);
+	start = sc->pos;
+	if (!sc->error && !script_at_compound(sc))
+		return (script_error(sc), n);
+	n->body = parse_command(sc);
+	if (!sc->error)
+		n->words = ft_substr(sc->src, start, sc->pos - start);
+	return (n);
+}
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_heredoc.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:10:12 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:21:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Copies a heredoc delimiter without its quotes and backslashes.
+ * @param s Raw delimiter word.
+ * @param len Length of the word.
+ * @return The delimiter line, or NULL on allocation failure.
+ */
+char	*script_unquote(const char *s, size_t len)
+{
+	char	*out;
+	char	quote;
+	size_t	i;
+	size_t	j;
+
+	out = ft_calloc(len + 1, 1);
+	if (!out)
+		return (NULL);
+	quote = 0;
+	i = 0;
+	j = 0;
+	while (i < len)
+	{
+		if (quote && s[i] == quote)
+			quote = 0;
+		else if (!quote && (s[i] == '\'' || s[i] == '"'))
+			quote = s[i];
+		else
+		{
+			i += (s[i] == '\\' && quote != '\'' && i + 1 < len);
+			out[j++] = s[i];
+		}
+		i++;
+	}
+	return (out);
+}
+
+/**
+ * @brief Records the heredoc whose delimiter starts at the current position.
+ * @param sc Script parser state, past a `<<` operator and its blanks.
+ * @note The heredoc goes to the command being scanned and waits in
+ * `pending` for the end of the line, where its body starts. A delimiter
+ * that lost characters to unquoting was quoted.
+ */
+void	script_heredoc_add(t_script *sc)
+{
+	t_heredoc	*hd;
+	t_list		*item;
+	t_list		*link;
+	size_t		end;
+
+	end = script_word_end(sc->src, sc->pos);
+	if (end == sc->pos)
+		return ;
+	hd = ft_calloc(1, sizeof(t_heredoc));
+	item = ft_lstnew(hd);
+	link = ft_lstnew(hd);
+	if (hd)
+		hd->delim = script_unquote(sc->src + sc->pos, end - sc->pos);
+	if (!hd || !item || !link || !hd->delim)
+	{
+		heredoc_free(hd);
+		free(item);
+		free(link);
+		perror("minishell");
+		sc->error = SCRIPT_SYNTAX;
+		return ;
+	}
+	hd->quoted = ((size_t)ft_strlen(hd->delim) != end - sc->pos);
+	ft_lstadd_back(&sc->heredocs, item);
+	ft_lstadd_back(&sc->pending, link);
+}
+
+/**
+ * @brief Reads the body of one heredoc from the script text.
+ * @param sc Script parser state, at the start of the body.
+ * @param hd Heredoc receiving the lines up to its delimiter.
+ * @note Without a delimiter the body runs to the end of the text; when
+ * probing for more input the script is incomplete instead, so the
+ * reader fetches the rest of the body.
+ */
+void	script_heredoc_body(t_script *sc, t_heredoc *hd)
+{
+	size_t	start;
+	size_t	end;
+	size_t	len;
+
+	start = sc->pos;
+	len = ft_strlen(hd->delim);
+	while (sc->src[sc->pos])
+	{
+		end = sc->pos;
+		while (sc->src[end] && sc->src[end] != '\n')
+			end++;
+		if (end - sc->pos == len
+			&& ft_strncmp(sc->src + sc->pos, hd->delim, len) == 0)
+		{
+			hd->body = ft_substr(sc->src, start, sc->pos - start);
+			sc->pos = end + (sc->src[end] == '\n');
+			return ;
+		}
+		sc->pos = end + (sc->src[end] == '\n');
+	}
+	if (sc->quiet)
+		sc->error = SCRIPT_INCOMPLETE;
+	hd->body = ft_substr(sc->src, start, sc->pos - start);
+}
+
+/**
+ * @brief Reads the bodies of the heredocs opened on the line just ended.
+ * @param sc Script parser state, just past the newline.
+ * @note Bodies follow each other in the order of their `<<`, as in
+ * `cat <<A <<B`.
+ */
+void	script_heredoc_read(t_script *sc)
+{
+	t_list	*next;
+
+	while (sc->pending && !sc->error)
+	{
+		script_heredoc_body(sc, sc->pending->content);
+		next = sc->pending->next;
+		free(sc->pending);
+		sc->pending = next;
+	}
+}
+
+/**
+ * @brief Releases the heredoc lists of the parser state.
+ * @param sc Script parser state.
+ * @note Heredocs still pending once the text has ended keep a NULL body
+ * and read it from the input when they run, as `cat <<EOF` typed on
+ * its own line does. In a file they get an empty body instead.
+ */
+void	script_heredoc_end(t_script *sc)
+{
+	t_list	*next;
+
+	if (sc->file)
+		script_heredoc_read(sc);
+	while (sc->pending)
+	{
+		next = sc->pending->next;
+		free(sc->pending);
+		sc->pending = next;
+	}
+	ft_lstclear(&sc->heredocs, heredoc_free);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_match.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 19:24:07 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether the next word is exactly a given reserved word.
+ * @param sc Script parser state.
+ * @param word Word to look for.
+ * @return 1 if it is, 0 otherwise.
+ * @note `done;` matches `done`, `donee` does not.
+ */
+int	script_at_word(t_script *sc, const char *word)
+{
+	size_t	len;
+
+	script_skip_blank(sc);
+	len = ft_strlen(word);
+	return (ft_strncmp(sc->src + sc->pos, word, len) == 0
+		&& script_word_end(sc->src, sc->pos) == sc->pos + len);
+}
+
+/**
+ * @brief Tells whether the text continues with an operator.
+ * @param sc Script parser state.
+ * @param op Operator spelling (`&&`, `;;`, ...).
+ * @return 1 if it does, 0 otherwise.
+ */
+int	script_at_op(t_script *sc, const char *op)
+{
+	script_skip_blank(sc);
+	return (ft_strncmp(sc->src + sc->pos, op, ft_strlen(op)) == 0);
+}
+
+/**
+ * @brief Tells whether a command separator (';' or newline) follows.
+ * @param sc Script parser state.
+ * @return 1 if it does, 0 otherwise (`;;` is not a separator).
+ */
+int	script_at_sep(t_script *sc)
+{
+	script_skip_blank(sc);
+	if (sc->src[sc->pos] == '\n')
+		return (1);
+	return (sc->src[sc->pos] == ';' && sc->src[sc->pos + 1] != ';');
+}
+
+/**
+ * @brief Tells whether the current command list ends here.
+ * @param sc Script parser state.
+ * @return 1 at the end of the text, `)`, `;;` or a closing reserved word.
+ */
+int	script_at_end(t_script *sc)
+{
+	static const char	*words[] = {"then", "elif", "else", "fi", "do",
+		"done", "esac", "}", NULL};
+	int					i;
+
+	script_skip_blank(sc);
+	if (!sc->src[sc->pos] || sc->src[sc->pos] == ')'
+		|| script_at_op(sc, ";;"))
+		return (1);
+	i = 0;
+	while (words[i])
+	{
+		if (script_at_word(sc, words[i]))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Consumes a reserved word or reports an error.
+ * @param sc Script parser state.
+ * @param word Reserved word expected next.
+ * @return 1 if it was consumed, 0 otherwise.
+ */
+int	script_expect(t_script *sc, const char *word)
+{
+	if (sc->error)
+		return (0);
+	if (!script_at_word(sc, word))
+	{
+		script_error(sc);
+		return (0);
+	}
+	sc->pos += ft_strlen(word);
+	return (1);
+}
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_node.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Allocates an empty script node.
+ * @param sc Script parser state (flagged on allocation failure).
+ * @param type Kind of node.
+ * @return The node, or NULL on allocation failure.
+ */
+t_node	*node_new(t_script *sc, t_node_type type)
+{
+	t_node	*n;
+
+	n = ft_calloc(1, sizeof(t_node));
+	if (!n)
+	{
+		perror("minishell");
+		sc->error = SCRIPT_SYNTAX;
+		return (NULL);
+	}
+	n->type = type;
+	return (n);
+}
+
+/**
+ * @brief Frees a command list and every node below it.
+ * @param n First node of the list (may be NULL).
+ */
+void	node_free(t_node *n)
+{
+	t_node	*next;
+
+	while (n)
+	{
+		next = n->next;
+		free(n->text);
+		free(n->words);
+		free(n->redirs);
+		ft_lstclear(&n->heredocs, heredoc_free);
+		node_free(n->cond);
+		node_free(n->body);
+		node_free(n->alt);
+		free(n);
+		n = next;
+	}
+}
+
+/**
+ * @brief Reports a syntax error at the current position.
+ * @param sc Script parser state.
+ * @return Always NULL, for use in parser return statements.
+ * @note At the end of the text nothing is printed: the input is only
+ * incomplete, and the reader may fetch another line.
+ */
+t_node	*script_error(t_script *sc)
+{
+	size_t	len;
+
+	if (sc->error)
+		return (NULL);
+	sc->error = SCRIPT_INCOMPLETE;
+	if (!sc->src[sc->pos])
+		return (NULL);
+	sc->error = SCRIPT_SYNTAX;
+	if (sc->quiet)
+		return (NULL);
+	len = script_word_end(sc->src, sc->pos) - sc->pos;
+	if (len == 0)
+		len = 1 + (sc->src[sc->pos + 1] == sc->src[sc->pos]);
+	ft_putstr_fd("minishell: syntax error near unexpected token '",
+		STDERR_FILENO);
+	if (sc->src[sc->pos] == '\n')
+		ft_putstr_fd("newline", STDERR_FILENO);
+	else
+		write(STDERR_FILENO, sc->src + sc->pos, len);
+	ft_putstr_fd("'\n", STDERR_FILENO);
+	return (NULL);
+}
+
+/**
+ * @brief Consumes one word and returns a copy of its raw text.
+ * @param sc Script parser state.
+ * @return The unexpanded word, or NULL (error reported) on an operator.
+ */
+char	*script_take_word(t_script *sc)
+{
+	size_t	end;
+	char	*word;
+
+	script_skip_blank(sc);
+	end = script_word_end(sc->src, sc->pos);
+	if (end == sc->pos)
+		return (script_error(sc), NULL);
+	word = ft_substr(sc->src, sc->pos, end - sc->pos);
+	sc->pos = end;
+	return (word);
+}
+
+/**
+ * @brief Consumes words up to the next operator or newline.
+ * @param sc Script parser state.
+ * @return Raw text of the words (possibly empty), NULL on failure.
+ * @note Used for the word list of `for name in ...`.
+ */
+char	*script_take_words(t_script *sc)
+{
+	size_t	start;
+
+	script_skip_blank(sc);
+	start = sc->pos;
+	while (!script_is_meta(sc->src, sc->pos))
+	{
+		sc->pos = script_word_end(sc->src, sc->pos);
+		script_skip_blank(sc);
+	}
+	return (ft_substr(sc->src, start, sc->pos - start));
+}
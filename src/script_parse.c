@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_parse.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:21:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Parses a script into a command list.
+ * @param src Script text (one or more lines).
+ * @param flags SCRIPT_QUIET to parse without reporting syntax errors,
+ * SCRIPT_FILE for the text of a sourced file.
+ * @param status Receives 0, SCRIPT_SYNTAX or SCRIPT_INCOMPLETE.
+ * @return The command list, NULL on error or for an empty script.
+ */
+t_node	*script_parse(const char *src, int flags, int *status)
+{
+	t_script	sc;
+	t_node		*list;
+
+	sc.src = src;
+	sc.pos = 0;
+	sc.error = 0;
+	sc.quiet = (flags & SCRIPT_QUIET) != 0;
+	sc.file = (flags & SCRIPT_FILE) != 0;
+	sc.heredocs = NULL;
+	sc.pending = NULL;
+	list = parse_list(&sc);
+	script_skip_space(&sc);
+	if (sc.src[sc.pos])
+		script_error(&sc);
+	script_heredoc_end(&sc);
+	*status = sc.error;
+	if (!sc.error)
+		return (list);
+	node_free(list);
+	return (NULL);
+}
+
+/**
+ * @brief Parses commands separated by ';' or newlines.
+ * @param sc Script parser state.
+ * @return The list, linked through `next` (NULL if empty).
+ * @note Stops before a closing reserved word, `;;` or `)`, which the
+ * enclosing compound command consumes.
+ */
+t_node	*parse_list(t_script *sc)
+{
+	t_node	*head;
+	t_node	**tail;
+
+	head = NULL;
+	tail = &head;
+	while (!sc->error)
+	{
+		script_skip_space(sc);
+		if (script_at_sep(sc))
+			sc->pos++;
+		else if (script_at_end(sc))
+			break ;
+		else
+		{
+			*tail = parse_and_or(sc);
+			if (*tail)
+				tail = &(*tail)->next;
+			if (!sc->error && !script_at_sep(sc) && !script_at_end(sc))
+				script_error(sc);
+		}
+	}
+	return (head);
+}
+
+/**
+ * @brief Parses pipelines joined by `&&` and `||`.
+ * @param sc Script parser state.
+ * @return The pipeline, or a left-associative N_AND/N_OR chain.
+ * @note A newline may follow the operator.
+ */
+t_node	*parse_and_or(t_script *sc)
+{
+	t_node	*left;
+	t_node	*node;
+
+	left = parse_pipe(sc);
+	while (!sc->error && (script_at_op(sc, "&&") || script_at_op(sc, "||")))
+	{
+		node = node_new(sc, N_OR);
+		if (!node)
+			break ;
+		if (sc->src[sc->pos] == '&')
+			node->type = N_AND;
+		sc->pos += 2;
+		script_skip_space(sc);
+		node->cond = left;
+		left = node;
+		node->body = parse_pipe(sc);
+	}
+	return (left);
+}
+
+/**
+ * @brief Parses a compound command or a pipeline.
+ * @param sc Script parser state.
+ * @return The command node (possibly partial on error).
+ * @note Reserved words are only recognised in command position.
+ */
+t_node	*parse_command(t_script *sc)
+{
+	t_node	*n;
+
+	if (script_at_word(sc, "if"))
+		n = parse_if(sc);
+	else if (script_at_word(sc, "while") || script_at_word(sc, "until"))
+		n = parse_loop(sc);
+	else if (script_at_word(sc, "for"))
+		n = parse_for(sc);
+	else if (script_at_word(sc, "case"))
+		n = parse_case(sc);
+	else if (script_at_word(sc, "{"))
+		n = parse_group(sc);
+	else if (script_at_funcdef(sc))
+		return (parse_funcdef(sc));
+	else
+		return (parse_simple(sc));
+	if (n && !sc->error)
+		parse_redirs(sc, n);
+	return (n);
+}
+
+/**
+ * @brief Collects the redirections following a compound command.
+ * @param sc Script parser state.
+ * @param n Compound command receiving the raw redirection text.
+ * @note `done < file` is kept as text and applied at each execution.
+ */
+void	parse_redirs(t_script *sc, t_node *n)
+{
+	size_t	start;
+
+	script_skip_blank(sc);
+	start = sc->pos;
+	while (!sc->error && script_skip_redir_op(sc))
+	{
+		script_skip_blank(sc);
+		if (script_word_end(sc->src, sc->pos) == sc->pos)
+			script_error(sc);
+		sc->pos = script_word_end(sc->src, sc->pos);
+		script_skip_blank(sc);
+	}
+	if (!sc->error && sc->pos > start)
+		n->redirs = ft_substr(sc->src, start, sc->pos - start);
+	n->heredocs = sc->heredocs;
+	sc->heredocs = NULL;
+}
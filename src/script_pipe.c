@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_pipe.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a compound command starts at the current position.
+ * @param sc Script parser state.
+ * @return 1 before `if`, `while`, `until`, `for`, `case` or `{`.
+ */
+int	script_at_compound(t_script *sc)
+{
+	return (script_at_word(sc, "if") || script_at_word(sc, "while")
+		|| script_at_word(sc, "until") || script_at_word(sc, "for")
+		|| script_at_word(sc, "case") || script_at_word(sc, "{"));
+}
+
+/**
+ * @brief Parses a pipeline that may have compound stages.
+ * @param sc Script parser state.
+ * @return The single command, or an N_PIPE node listing the stages.
+ * @note Runs of simple commands stay one N_PIPELINE stage; a '|' is
+ * only left to this function before or after a compound command.
+ */
+t_node	*parse_pipe(t_script *sc)
+{
+	t_node	*first;
+	t_node	*pipe;
+	t_node	**tail;
+
+	first = parse_command(sc);
+	if (sc->error || !script_at_op(sc, "|") || script_at_op(sc, "||"))
+		return (first);
+	pipe = node_new(sc, N_PIPE);
+	if (!pipe)
+		return (first);
+	pipe->body = first;
+	tail = &first->next;
+	while (!sc->error && script_at_op(sc, "|") && !script_at_op(sc, "||"))
+	{
+		sc->pos++;
+		script_skip_space(sc);
+		*tail = parse_command(sc);
+		if (*tail)
+			tail = &(*tail)->next;
+	}
+	return (pipe);
+}
+
+/**
+ * @brief Builds the t_cmd stages for one node of an N_PIPE.
+ * @param stage Pipeline text or compound command.
+ * @return Parsed commands, or a single stage carrying the compound
+ * command in `script`; NULL on error.
+ */
+t_cmd	*ast_pipe_stage(t_node *stage)
+{
+	t_parse	parser;
+	t_cmd	*cmd;
+
+	if (stage->type == N_PIPELINE)
+	{
+		get_exec_ctl()->heredocs = stage->heredocs;
+		cmd = parse_and_validate_pipeline(stage->text, &parser);
+		if (!cmd && parser.syntax_error)
+			get_exec_ctl()->abort = SYNTAX_ERROR;
+		return (cmd);
+	}
+	cmd = ft_calloc(1, sizeof(t_cmd));
+	if (cmd)
+		cmd->script = stage;
+	return (cmd);
+}
+
+/**
+ * @brief Builds the full t_cmd pipeline of an N_PIPE node.
+ * @param n N_PIPE node.
+ * @return The pipeline, NULL on error (partial stages are released).
+ */
+t_cmd	*ast_pipe_build(t_node *n)
+{
+	t_cmd	*pipeline;
+	t_cmd	**tail;
+	t_node	*stage;
+
+	pipeline = NULL;
+	tail = &pipeline;
+	stage = n->body;
+	while (stage)
+	{
+		*tail = ast_pipe_stage(stage);
+		if (!*tail)
+		{
+			procsub_reap(pipeline);
+			free_pipeline(pipeline);
+			return (NULL);
+		}
+		while (*tail)
+			tail = &(*tail)->next;
+		stage = stage->next;
+	}
+	return (pipeline);
+}
+
+/**
+ * @brief Runs a pipeline with compound stages through execute_pipeline.
+ * @param n N_PIPE node.
+ * @param should_exit Pointer to the exit flag.
+ * @return Exit status of the last stage.
+ * @note Compound stages run in the forked stage process, so
+ * `ls | while read f; do ...; done` works as in other shells. Ctrl+C
+ * aborts the rest of the input, as in ast_exec_pipeline.
+ */
+int	ast_exec_pipe(t_node *n, int *should_exit)
+{
+	t_cmd	*pipeline;
+
+	get_exec_ctl()->sigint = 0;
+	pipeline = ast_pipe_build(n);
+	if (!pipeline)
+		return (get_exit_status());
+	if (execute_pipeline(pipeline) == EXIT_CODE_EXIT)
+		*should_exit = 1;
+	procsub_reap(pipeline);
+	free_pipeline(pipeline);
+	if (get_exec_ctl()->sigint)
+		get_exec_ctl()->abort = 130;
+	return (get_exit_status());
+}
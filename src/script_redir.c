@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_redir.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Runs a compound command with its trailing redirections.
+ * @param n Compound node with a non-NULL `redirs`.
+ * @param should_exit Pointer to the exit flag.
+ * @return Exit status of the command, 1 if a redirection fails.
+ * @note The redirections are parsed as those of a `true` command, so
+ * `done < <(cmd)` and here-strings behave as they do on pipelines.
+ */
+int	ast_exec_redirected(t_node *n, int *should_exit)
+{
+	t_parse		parser;
+	t_cmd		*cmd;
+	t_fdplan	plan;
+	char		*text;
+	int			status;
+
+	cmd = NULL;
+	text = ft_strjoin("true ", n->redirs);
+	get_exec_ctl()->heredocs = n->heredocs;
+	if (text)
+		cmd = parse_and_validate_pipeline(text, &parser);
+	free(text);
+	if (!cmd)
+		return (get_exit_status());
+	status = 130;
+	if (handle_heredoc_redirections(cmd->redirections) != 130)
+	{
+		status = 1;
+		if (redirect_push(&plan, cmd->redirections) == 0)
+			status = ast_exec_node(n, should_exit);
+		redirect_pop(&plan);
+	}
+	procsub_reap(cmd);
+	free_pipeline(cmd);
+	return (status);
+}
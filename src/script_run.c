@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_run.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:21:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Parses and runs a script in the current process.
+ * @param text Script text.
+ * @param should_exit Pointer to the exit flag, set once `exit` has run.
+ * @return 1 if a syntax error occurred, 0 otherwise.
+ * @note Loop control state is reset afterwards (see script_exec_end).
+ */
+int	script_run(const char *text, int *should_exit)
+{
+	t_node	*list;
+	int		status;
+
+	list = script_parse(text, 0, &status);
+	if (status == SCRIPT_INCOMPLETE)
+		ft_putstr_fd("minishell: syntax error: unexpected end of file\n",
+			STDERR_FILENO);
+	if (status)
+	{
+		set_exit_status(SYNTAX_ERROR);
+		return (1);
+	}
+	script_exec_top(list, should_exit);
+	node_free(list);
+	return (script_exec_end(should_exit));
+}
+
+/**
+ * @brief Reads continuation lines while a script is incomplete.
+ * @param input First line (ownership is taken).
+ * @return The joined script, or NULL on allocation failure.
+ * @note `while true; do` followed by Enter prompts for the rest of the
+ * loop; end of input leaves the script incomplete for the parser to
+ * report.
+ */
+char	*script_read_more(char *input)
+{
+	char	*line;
+	char	*joined;
+	int		status;
+
+	while (input)
+	{
+		node_free(script_parse(input, SCRIPT_QUIET, &status));
+		if (status != SCRIPT_INCOMPLETE)
+			return (input);
+		line = shell_readline("> ");
+		if (!line)
+			return (input);
+		joined = ft_strjoin3(input, "\n", line);
+		free(input);
+		free(line);
+		input = joined;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Runs the commands of a list in order.
+ * @param n First node of the list.
+ * @param should_exit Pointer to the exit flag.
+ * @return Status of the last command run (0 for an empty list).
+ * @note Stops early on `exit`, `break`, `continue` or an aborted line.
+ */
+int	ast_exec_list(t_node *n, int *should_exit)
+{
+	int	status;
+
+	status = 0;
+	while (n && !*should_exit && !exec_interrupted())
+	{
+		status = ast_exec(n, should_exit);
+		n = n->next;
+	}
+	return (status);
+}
+
+/**
+ * @brief Runs one command node and records its exit status.
+ * @param n Node to run.
+ * @param should_exit Pointer to the exit flag.
+ * @return Exit status of the command.
+ */
+int	ast_exec(t_node *n, int *should_exit)
+{
+	int	status;
+
+	if (n->redirs)
+		status = ast_exec_redirected(n, should_exit);
+	else
+		status = ast_exec_node(n, should_exit);
+	set_exit_status(status);
+	return (status);
+}
+
+/**
+ * @brief Dispatches a node to the function running its kind.
+ * @param n Node to run.
+ * @param should_exit Pointer to the exit flag.
+ * @return Exit status of the command.
+ */
+int	ast_exec_node(t_node *n, int *should_exit)
+{
+	if (n->type == N_PIPELINE)
+		return (ast_exec_pipeline(n, should_exit));
+	if (n->type == N_PIPE)
+		return (ast_exec_pipe(n, should_exit));
+	if (n->type == N_AND || n->type == N_OR)
+		return (ast_exec_and_or(n, should_exit));
+	if (n->type == N_IF)
+		return (ast_exec_if(n, should_exit));
+	if (n->type == N_FOR)
+		return (ast_exec_for(n, should_exit));
+	if (n->type == N_CASE)
+		return (ast_exec_case(n, should_exit));
+	if (n->type == N_GROUP || n->type == N_FUNCDEF)
+		return (ast_exec_group(n, should_exit));
+	return (ast_exec_loop(n, should_exit));
+}
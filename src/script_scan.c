@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_scan.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Finds the closing quote of a quoted section.
+ * @param s Script text.
+ * @param i Index of the opening quote.
+ * @return Index of the closing quote, or of the terminating NUL.
+ * @note `$(...)` groups inside double quotes may contain quotes.
+ */
+size_t	script_quote_end(const char *s, size_t i)
+{
+	char	quote;
+	size_t	end;
+
+	quote = s[i++];
+	while (s[i] && s[i] != quote)
+	{
+		end = 0;
+		if (quote == '"' && s[i] == '\\' && s[i + 1])
+			end = i + 1;
+		else if (quote == '"' && s[i] == '$' && s[i + 1] == '(')
+			end = match_group_end(s, i + 1);
+		if (end)
+			i = end;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Tells whether a character ends a word.
+ * @param s Script text.
+ * @param i Index to check.
+ * @return 1 on blanks, newlines, operators and the end of the text.
+ * @note `<(` and `>(` start a process substitution, not a redirection.
+ */
+int	script_is_meta(const char *s, size_t i)
+{
+	if (!s[i])
+		return (1);
+	if ((s[i] == '<' || s[i] == '>') && s[i + 1] == '(')
+		return (0);
+	return (ft_strchr(" \t\n;&|<>()", s[i]) != NULL);
+}
+
+/**
+ * @brief Finds the end of the word starting at an index.
+ * @param s Script text.
+ * @param i Index of the first character of the word.
+ * @return Index just past the word (equal to `i` on an operator).
+ * @note Quotes, backslashes and expansion groups are part of the word.
+ */
+size_t	script_word_end(const char *s, size_t i)
+{
+	size_t	end;
+
+	while (!script_is_meta(s, i))
+	{
+		end = 0;
+		if (s[i] == '\\' && s[i + 1])
+			end = i + 1;
+		else if (s[i] == '\'' || s[i] == '"')
+			end = script_quote_end(s, i);
+		else if (ft_strchr("$<>", s[i])
+			&& (s[i + 1] == '(' || (s[i] == '$' && s[i + 1] == '{')))
+			end = match_group_end(s, i + 1);
+		if (end)
+			i = end;
+		if (s[i])
+			i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Skips blanks and a comment, stopping at a newline.
+ * @param sc Script parser state.
+ */
+void	script_skip_blank(t_script *sc)
+{
+	while (sc->src[sc->pos] == ' ' || sc->src[sc->pos] == '\t')
+		sc->pos++;
+	if (sc->src[sc->pos] == '#')
+	{
+		while (sc->src[sc->pos] && sc->src[sc->pos] != '\n')
+			sc->pos++;
+	}
+}
+
+/**
+ * @brief Skips blanks, comments and newlines.
+ * @param sc Script parser state.
+ * @note The bodies of the heredocs opened on a line are skipped with
+ * its newline (see script_heredoc_read).
+ */
+void	script_skip_space(t_script *sc)
+{
+	script_skip_blank(sc);
+	while (sc->src[sc->pos] == '\n')
+	{
+		sc->pos++;
+		script_heredoc_read(sc);
+		script_skip_blank(sc);
+	}
+}
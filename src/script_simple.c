@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_simple.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:14:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Consumes a redirection operator (`<`, `>>`, `2>&`, ...).
+ * @param sc Script parser state.
+ * @return 1 if one was consumed, 0 otherwise.
+ * @note `<(` and `>(` are process substitutions, not operators. The
+ * blanks after the operator are skipped, and a `<<` records its heredoc,
+ * whose body is read once the line ends.
+ */
+int	script_skip_redir_op(t_script *sc)
+{
+	size_t	i;
+	size_t	op;
+
+	i = sc->pos;
+	while (ft_isdigit(sc->src[i]))
+		i++;
+	if ((sc->src[i] != '<' && sc->src[i] != '>') || sc->src[i + 1] == '(')
+		return (0);
+	op = i;
+	while (sc->src[i] == '<' || sc->src[i] == '>' || sc->src[i] == '&')
+		i++;
+	sc->pos = i;
+	script_skip_blank(sc);
+	if (i - op == 2 && sc->src[op] == '<' && sc->src[op + 1] == '<')
+		script_heredoc_add(sc);
+	return (1);
+}
+
+/**
+ * @brief Tells whether a pipeline ends at the current position.
+ * @param sc Script parser state.
+ * @return 1 before a separator, `&&`, `||`, `)` or the end of the text.
+ */
+int	script_simple_stop(t_script *sc)
+{
+	char	c;
+
+	script_skip_blank(sc);
+	c = sc->src[sc->pos];
+	if (!c || c == '\n' || c == ';' || c == ')')
+		return (1);
+	return ((c == '&' || c == '|') && sc->src[sc->pos + 1] == c);
+}
+
+/**
+ * @brief Consumes a '|' and the newlines allowed after it.
+ * @param sc Script parser state, on the '|'.
+ * @return 1 if consumed, 0 (nothing consumed) before a compound command.
+ * @note `a |` at the end of a line is incomplete, not an error.
+ */
+int	script_skip_pipe(t_script *sc)
+{
+	size_t	start;
+
+	start = sc->pos++;
+	script_skip_space(sc);
+	if (script_at_compound(sc))
+	{
+		sc->pos = start;
+		return (0);
+	}
+	if (script_simple_stop(sc))
+		script_error(sc);
+	return (1);
+}
+
+/**
+ * @brief Consumes the next word, operator or '|' of a pipeline.
+ * @param sc Script parser state.
+ * @return 0 when the pipeline continues into a compound command.
+ */
+int	script_simple_step(t_script *sc)
+{
+	size_t	end;
+
+	if (sc->src[sc->pos] == '|')
+		return (script_skip_pipe(sc));
+	end = script_word_end(sc->src, sc->pos);
+	if (end > sc->pos)
+		sc->pos = end;
+	else if (!script_skip_redir_op(sc))
+		script_error(sc);
+	return (1);
+}
+
+/**
+ * @brief Parses a pipeline of simple commands.
+ * @param sc Script parser state.
+ * @return An N_PIPELINE node holding the raw text, NULL on error.
+ * @note The text is parsed and expanded by the regular parser each time
+ * it runs, so loop bodies see the current variable values.
+ */
+t_node	*parse_simple(t_script *sc)
+{
+	t_node	*n;
+	size_t	start;
+
+	script_skip_blank(sc);
+	start = sc->pos;
+	while (!sc->error && !script_simple_stop(sc))
+	{
+		if (!script_simple_step(sc))
+			break ;
+	}
+	if (!sc->error && sc->pos == start)
+		script_error(sc);
+	if (sc->error)
+		return (NULL);
+	n = node_new(sc, N_PIPELINE);
+	if (n)
+	{
+		n->text = ft_substr(sc->src, start, sc->pos - start);
+		n->heredocs = sc->heredocs;
+		sc->heredocs = NULL;
+	}
+	return (n);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_words.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:24:07 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 15:57:03 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends a word to a NULL-terminated array.
+ * @param words Array (freed on failure).
+ * @param word Word to append (freed on failure).
+ * @return The new array, NULL on allocation failure.
+ */
+char	**script_append(char **words, char *word)
+{
+	char	**grown;
+
+	grown = NULL;
+	if (word && words)
+		grown = ft_array_append(words, word);
+	if (!grown)
+	{
+		free(word);
+		ft_free_array(words);
+	}
+	return (grown);
+}
+
+/**
+ * @brief Splits an expansion result on IFS whitespace.
+ * @param words Array receiving the fields.
+ * @param value Expanded text.
+ * @return The grown array, NULL on allocation failure.
+ * @note `for f in $(ls)` iterates over the lines of the output.
+ */
+char	**script_split_fields(char **words, const char *value)
+{
+	const char	*ifs;
+	size_t		i;
+	size_t		start;
+
+	ifs = env_value("IFS");
+	if (!ifs)
+		ifs = " \t\n";
+	i = 0;
+	while (words && value[i])
+	{
+		while (is_ifs_space(value[i], ifs))
+			i++;
+		start = i;
+		while (value[i] && !is_ifs_space(value[i], ifs))
+			i++;
+		if (i > start)
+			words = script_append(words, ft_substr(value, start, i - start));
+	}
+	return (words);
+}
+
+/**
+ * @brief Expands one word of a for list and appends the result.
+ * @param words Array receiving the words.
+ * @param raw Unexpanded word.
+ * @return The grown array, NULL on allocation failure.
+ * @note Unquoted expansions are split into fields; quoted words are
+ * kept whole, except `"$@"` which gives one word per parameter, and
+ * words with an unquoted pattern give the matching paths.
+ */
+char	**script_add_word(char **words, const char *raw)
+{
+	t_arg	arg;
+	char	*value;
+
+	if (is_all_params(raw))
+		return (positional_append(words));
+	if (word_has_glob(raw))
+		return (script_add_glob(words, raw));
+	if (ft_strchr(raw, '\'') || ft_strchr(raw, '"') || !ft_strchr(raw, '$'))
+	{
+		value = word_expand(raw, 0);
+		if (!value)
+			return (words);
+		return (script_append(words, value));
+	}
+	arg.value = (char *)raw;
+	arg.type = T_WORD;
+	arg.raw = NULL;
+	value = expand_arg(&arg);
+	if (!value)
+		return (words);
+	words = script_split_fields(words, value);
+	free(value);
+	return (words);
+}
+
+/**
+ * @brief Expands the word list of a for loop.
+ * @param text Raw word list (NULL for the positional parameters).
+ * @return NULL-terminated array of words, NULL on allocation failure.
+ */
+char	**script_expand_words(const char *text)
+{
+	char	**words;
+	char	*raw;
+	size_t	i;
+	size_t	end;
+
+	words = ft_calloc(1, sizeof(char *));
+	if (!text)
+		return (positional_append(words));
+	i = 0;
+	while (words && text[i])
+	{
+		end = script_word_end(text, i);
+		if (end > i)
+		{
+			raw = ft_substr(text, i, end - i);
+			if (raw)
+				words = script_add_word(words, raw);
+			free(raw);
+		}
+		i = end + (end == i);
+	}
+	return (words);
+}
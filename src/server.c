@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 12:14:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 12:14:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Runs `minishell --server path` until SIGINT or SIGTERM.
+ * @param path Socket path.
+ * @return Exit status of the server.
+ * @note One warm process answers many short command lines, so a job
+ * runner does not pay startup, environment import and readline for each
+ * of them. A signal stops new requests; the running ones still finish
+ * and get their reply.
+ */
+int	server_run(const char *path)
+{
+	t_server	srv;
+	int			ret;
+
+	if (server_setup(&srv, path) == -1)
+		return (EXIT_FAILURE);
+	ret = 0;
+	while (ret == 0 && (srv.lfd != -1 || srv.running))
+		ret = server_step(&srv);
+	if (ret == -1)
+		server_error("epoll_wait");
+	server_stop(&srv);
+	close(srv.sigfd);
+	close(srv.epfd);
+	return (-ret);
+}
+
+/**
+ * @brief Opens the socket, the signalfd and the epoll instance.
+ * @param srv Server state to fill.
+ * @param path Socket path.
+ * @return 0 on success, -1 (reported) on failure.
+ * @note Descriptors 0 to 2 are opened on /dev/null if closed, so the
+ * descriptors a request brings never land on them.
+ */
+int	server_setup(t_server *srv, const char *path)
+{
+	struct epoll_event	ev;
+	int					fd;
+
+	ft_bzero(srv, sizeof(t_server));
+	srv->path = path;
+	srv->lfd = -1;
+	fd = open("/dev/null", O_RDWR);
+	while (fd >= 0 && fd <= STDERR_FILENO)
+		fd = open("/dev/null", O_RDWR);
+	if (fd > STDERR_FILENO)
+		close(fd);
+	if (server_signals(srv) == -1 || server_bind(srv) == -1)
+		return (-1);
+	ev.events = EPOLLIN;
+	ev.data.u32 = SRV_TAG_LISTEN;
+	if (epoll_ctl(srv->epfd, EPOLL_CTL_ADD, srv->lfd, &ev) == -1)
+		return (server_error("epoll_ctl"));
+	return (0);
+}
+
+/**
+ * @brief Reads SIGINT and SIGTERM through the server's epoll instance.
+ * @param srv Server state.
+ * @return 0 on success, -1 (reported) on failure.
+ * @note Request processes unblock them again (see server_child).
+ */
+int	server_signals(t_server *srv)
+{
+	struct epoll_event	ev;
+	sigset_t			set;
+
+	sigemptyset(&set);
+	sigaddset(&set, SIGINT);
+	sigaddset(&set, SIGTERM);
+	sigprocmask(SIG_BLOCK, &set, NULL);
+	srv->sigfd = signalfd(-1, &set, SFD_NONBLOCK | SFD_CLOEXEC);
+	srv->epfd = epoll_create1(EPOLL_CLOEXEC);
+	ev.events = EPOLLIN;
+	ev.data.u32 = SRV_TAG_SIGNAL;
+	if (srv->sigfd == -1 || srv->epfd == -1
+		|| epoll_ctl(srv->epfd, EPOLL_CTL_ADD, srv->sigfd, &ev) == -1)
+		return (server_error("signalfd"));
+	return (0);
+}
+
+/**
+ * @brief Waits for and handles the next events.
+ * @param srv Server state.
+ * @return 0 to go on, -1 on failure.
+ * @note A free slot is never waited for: wait4 on pid 0 would reap any
+ * child of the group.
+ */
+int	server_step(t_server *srv)
+{
+	struct epoll_event	events[EVLOOP_MAX_EVENTS];
+	int					n;
+	uint32_t			tag;
+
+	n = epoll_wait(srv->epfd, events, EVLOOP_MAX_EVENTS, -1);
+	if (n == -1 && errno != EINTR)
+		return (-1);
+	while (n-- > 0)
+	{
+		tag = events[n].data.u32;
+		if (tag == SRV_TAG_SIGNAL)
+			server_stop(srv);
+		else if (tag == SRV_TAG_LISTEN && srv->lfd != -1)
+			server_accept(srv);
+		else if (tag >= SRV_TAG_JOB && srv->jobs[tag - SRV_TAG_JOB].pid)
+			server_finish(srv, tag - SRV_TAG_JOB);
+	}
+	return (0);
+}
+
+/**
+ * @brief Stops accepting requests and removes the socket.
+ * @param srv Server state.
+ * @note Reads the pending signal so the signalfd goes quiet.
+ */
+void	server_stop(t_server *srv)
+{
+	struct signalfd_siginfo	info;
+
+	read(srv->sigfd, &info, sizeof(info));
+	if (srv->lfd == -1)
+		return ;
+	close(srv->lfd);
+	srv->lfd = -1;
+	unlink(srv->path);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_child.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 12:14:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 12:14:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Runs one request in a process forked from the server.
+ * @param srv Server state.
+ * @param conn Connection of the request.
+ * @param req Request read.
+ * @note A process per request keeps requests apart: the working
+ * directory, descriptors 0 to 2 and the environment overlay are
+ * process-wide, and `exit` or a crash only ends that request. The fork
+ * itself is cheap, the server being small and already initialised.
+ */
+void	server_child(t_server *srv, int conn, t_srv_req *req)
+{
+	char		*line;
+	char		*end;
+	sigset_t	set;
+
+	sigemptyset(&set);
+	sigaddset(&set, SIGTERM);
+	sigprocmask(SIG_UNBLOCK, &set, NULL);
+	if (server_child_fds(srv, conn, req->fds) == -1)
+		exit(EXIT_FAILURE);
+	end = req->body + req->head.len;
+	line = req->body + ft_strlen(req->body) + 1;
+	if (chdir(req->body) == -1)
+	{
+		server_error(req->body);
+		exit(EXIT_FAILURE);
+	}
+	set_env_value("PWD", req->body);
+	server_overlay(line + ft_strlen(line) + 1, end);
+	run_subshell(line);
+}
+
+/**
+ * @brief Puts the client's descriptors on 0 to 2 and closes the server's.
+ * @param srv Server state.
+ * @param conn Connection of the request.
+ * @param fds Client's stdin, stdout and stderr.
+ * @return 0 on success, -1 if a descriptor could not be installed.
+ */
+int	server_child_fds(t_server *srv, int conn, int fds[3])
+{
+	int	i;
+
+	close(conn);
+	close(srv->lfd);
+	close(srv->sigfd);
+	close(srv->epfd);
+	i = 0;
+	while (i < SRV_MAX_JOBS)
+	{
+		if (srv->jobs[i].pid)
+		{
+			close(srv->jobs[i].conn);
+			close(srv->jobs[i].pidfd);
+		}
+		i++;
+	}
+	i = 0;
+	while (i < 3)
+	{
+		if (dup2(fds[i], i) == -1)
+			return (-1);
+		close(fds[i++]);
+	}
+	return (0);
+}
+
+/**
+ * @brief Applies the environment overlay of a request.
+ * @param entry First `NAME=value` entry.
+ * @param end End of the request body.
+ * @note Entries without `=` or with an invalid name are ignored.
+ */
+void	server_overlay(char *entry, const char *end)
+{
+	char	*next;
+	char	*eq;
+
+	while (entry < end)
+	{
+		next = entry + ft_strlen(entry) + 1;
+		eq = ft_strchr(entry, '=');
+		if (eq)
+		{
+			*eq = '\0';
+			if (is_valid_var_name(entry))
+				set_env_value(entry, eq + 1);
+		}
+		entry = next;
+	}
+}
+
+/**
+ * @brief Reports a failed system call of the server.
+ * @param what Name reported before the reason from errno.
+ * @return Always -1.
+ */
+int	server_error(const char *what)
+{
+	char	*reason;
+
+	reason = strerror(errno);
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd((char *)what, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putstr_fd(reason, STDERR_FILENO);
+	ft_putstr_fd("\n", STDERR_FILENO);
+	return (-1);
+}
+
+/**
+ * @brief Releases what a request holds in the server.
+ * @param req Request (descriptors set to -1 when not received).
+ */
+void	server_req_free(t_srv_req *req)
+{
+	int	i;
+
+	i = 0;
+	while (i < 3)
+	{
+		if (req->fds[i] != -1)
+			close(req->fds[i]);
+		i++;
+	}
+	free(req->body);
+	req->body = NULL;
+}
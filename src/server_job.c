@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_job.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 12:14:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 12:14:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Accepts a connection and starts its request.
+ * @param srv Server state.
+ * @note The request is read here, with a receive timeout, so a client
+ * that connects and sends nothing holds the server for a few seconds at
+ * most. Connections from other users are dropped.
+ */
+void	server_accept(t_server *srv)
+{
+	t_srv_req		req;
+	struct timeval	tv;
+	int				conn;
+
+	conn = accept4(srv->lfd, NULL, NULL, SOCK_CLOEXEC);
+	if (conn == -1)
+		return ;
+	tv.tv_sec = SRV_RECV_TIMEOUT;
+	tv.tv_usec = 0;
+	setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	ft_memset(req.fds, -1, sizeof(req.fds));
+	req.body = NULL;
+	if (server_peer_ok(conn) && server_recv(conn, &req) == 0)
+		server_spawn(srv, conn, &req);
+	else
+		close(conn);
+	server_req_free(&req);
+}
+
+/**
+ * @brief Forks the process running a request and watches its pidfd.
+ * @param srv Server state (with a free slot).
+ * @param conn Connection of the request, owned by the slot from now on.
+ * @param req Request read.
+ * @note The command index is validated once here, so each request
+ * inherits the checked mapping.
+ */
+void	server_spawn(t_server *srv, int conn, t_srv_req *req)
+{
+	t_srv_job			*job;
+	int					slot;
+
+	slot = 0;
+	while (srv->jobs[slot].pid)
+		slot++;
+	job = &srv->jobs[slot];
+	cmd_index_expire();
+	cmd_index_sync();
+	job->pid = fork();
+	if (job->pid == 0)
+		server_child(srv, conn, req);
+	if (job->pid == -1)
+	{
+		job->pid = 0;
+		close(conn);
+		server_error("fork");
+		return ;
+	}
+	job->conn = conn;
+	srv->running++;
+	server_watch(srv, slot);
+}
+
+/**
+ * @brief Watches the pidfd of a request that was just started.
+ * @param srv Server state.
+ * @param slot Slot of the request.
+ * @note Without a pidfd the request is waited for at once.
+ */
+void	server_watch(t_server *srv, int slot)
+{
+	struct epoll_event	ev;
+	t_srv_job			*job;
+
+	job = &srv->jobs[slot];
+	job->pidfd = syscall(SYS_pidfd_open, job->pid, 0);
+	ev.events = EPOLLIN;
+	ev.data.u32 = SRV_TAG_JOB + slot;
+	if (job->pidfd == -1
+		|| epoll_ctl(srv->epfd, EPOLL_CTL_ADD, job->pidfd, &ev) == -1)
+		server_finish(srv, slot);
+	else if (srv->running == SRV_MAX_JOBS)
+		server_pause(srv, 0);
+}
+
+/**
+ * @brief Reaps a finished request and sends its reply.
+ * @param srv Server state.
+ * @param slot Slot of the request.
+ * @note wait4 reports the usage of the request process together with
+ * the commands it waited for. The pidfd is removed from the epoll set
+ * explicitly: a request forked meanwhile may still hold a copy of it,
+ * and close alone would leave it registered under a reused slot.
+ */
+void	server_finish(t_server *srv, int slot)
+{
+	t_srv_job		*job;
+	t_srv_reply		reply;
+	struct rusage	ru;
+	int				status;
+
+	job = &srv->jobs[slot];
+	status = 0;
+	ft_bzero(&ru, sizeof(ru));
+	wait4(job->pid, &status, 0, &ru);
+	reply.status = child_status(status, NULL);
+	reply.utime_us = ru.ru_utime.tv_sec * 1000000LL + ru.ru_utime.tv_usec;
+	reply.stime_us = ru.ru_stime.tv_sec * 1000000LL + ru.ru_stime.tv_usec;
+	reply.maxrss_kb = ru.ru_maxrss;
+	reply.minflt = ru.ru_minflt;
+	reply.majflt = ru.ru_majflt;
+	send(job->conn, &reply, sizeof(reply), MSG_NOSIGNAL);
+	close(job->conn);
+	if (job->pidfd != -1)
+	{
+		epoll_ctl(srv->epfd, EPOLL_CTL_DEL, job->pidfd, NULL);
+		close(job->pidfd);
+	}
+	job->pid = 0;
+	if (srv->running-- == SRV_MAX_JOBS && srv->lfd != -1)
+		server_pause(srv, EPOLLIN);
+}
+
+/**
+ * @brief Stops or resumes watching the listening socket.
+ * @param srv Server state.
+ * @param events 0 while every slot is busy, EPOLLIN otherwise.
+ * @note Pending connections wait in the socket's backlog meanwhile.
+ */
+void	server_pause(t_server *srv, uint32_t events)
+{
+	struct epoll_event	ev;
+
+	ev.events = events;
+	ev.data.u32 = SRV_TAG_LISTEN;
+	epoll_ctl(srv->epfd, EPOLL_CTL_MOD, srv->lfd, &ev);
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   server_sock.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 12:14:05 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 12:14:05 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Creates the listening socket of the server.
+ * @param srv Server state; `path` is the socket path.
+ * @return 0 on success, -1 (reported) on failure.
+ * @note The socket is created with mode 0600: whoever can connect runs
+ * commands as the server's user (see also server_peer_ok).
+ */
+int	server_bind(t_server *srv)
+{
+	struct sockaddr_un	addr;
+	mode_t				mask;
+	int					ret;
+
+	if ((size_t)ft_strlen(srv->path) >= sizeof(addr.sun_path))
+	{
+		errno = ENAMETOOLONG;
+		return (server_error(srv->path));
+	}
+	ft_bzero(&addr, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	ft_strlcpy(addr.sun_path, srv->path, sizeof(addr.sun_path));
+	if (server_stale(&addr) == -1)
+		return (-1);
+	srv->lfd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (srv->lfd == -1)
+		return (server_error("socket"));
+	mask = umask(077);
+	ret = bind(srv->lfd, (struct sockaddr *)&addr, sizeof(addr));
+	umask(mask);
+	if (ret == -1 || listen(srv->lfd, SRV_BACKLOG) == -1)
+		return (server_error(srv->path));
+	return (0);
+}
+
+/**
+ * @brief Removes a socket left behind by a server that is gone.
+ * @param addr Address the server is about to bind.
+ * @return 0 if the path can be bound, -1 (reported) if a server still
+ * answers on it.
+ * @note Anything but a socket is left alone for bind to report.
+ */
+int	server_stale(const struct sockaddr_un *addr)
+{
+	struct stat	st;
+	int			fd;
+	int			ret;
+
+	if (lstat(addr->sun_path, &st) == -1 || !S_ISSOCK(st.st_mode))
+		return (0);
+	fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd == -1)
+		return (server_error("socket"));
+	ret = connect(fd, (const struct sockaddr *)addr, sizeof(*addr));
+	close(fd);
+	if (ret == 0)
+	{
+		ft_putstr_fd("minishell: ", STDERR_FILENO);
+		ft_putstr_fd((char *)addr->sun_path, STDERR_FILENO);
+		ft_putstr_fd(": server already running\n", STDERR_FILENO);
+		return (-1);
+	}
+	unlink(addr->sun_path);
+	return (0);
+}
+
+/**
+ * @brief Checks that a client runs as the server's user.
+ * @param conn Accepted connection.
+ * @return 1 if it does, 0 otherwise.
+ */
+int	server_peer_ok(int conn)
+{
+	struct ucred	cred;
+	socklen_t		len;
+
+	len = sizeof(cred);
+	if (getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &cred, &len) == -1)
+		return (0);
+	return (cred.uid == getuid());
+}
+
+/**
+ * @brief Reads a request: its header and descriptors, then its body.
+ * @param conn Accepted connection (with a receive timeout).
+ * @param req Receives the request; descriptors received are stored even
+ * on failure, for server_req_free to close.
+ * @return 0 on success, -1 on a short, oversized or malformed request
+ * (the body must hold at least the directory and the command line).
+ */
+int	server_recv(int conn, t_srv_req *req)
+{
+	struct msghdr	msg;
+	struct iovec	iov;
+	uint64_t		cbuf[CMSG_SPACE(sizeof(int) * 3) / sizeof(uint64_t)];
+	ssize_t			n;
+
+	ft_bzero(&msg, sizeof(msg));
+	iov.iov_base = &req->head;
+	iov.iov_len = sizeof(t_srv_head);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+	n = recvmsg(conn, &msg, MSG_WAITALL | MSG_CMSG_CLOEXEC);
+	if (server_take_fds(&msg, n, req) == -1 || req->head.magic != SRV_MAGIC
+		|| req->head.len < 2 || req->head.len > SRV_MAX_BODY)
+		return (-1);
+	req->body = malloc(req->head.len);
+	if (!req->body || recv(conn, req->body, req->head.len, MSG_WAITALL)
+		!= (ssize_t)req->head.len || req->body[req->head.len - 1]
+		|| (size_t)ft_strlen(req->body) + 1 >= req->head.len)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Takes the descriptors passed with a request header.
+ * @param msg Message received.
+ * @param n Result of recvmsg.
+ * @param req Receives the descriptors.
+ * @return 0 if the whole header came with exactly three descriptors,
+ * -1 otherwise.
+ */
+int	server_take_fds(struct msghdr *msg, ssize_t n, t_srv_req *req)
+{
+	struct cmsghdr	*cmsg;
+	size_t			nfds;
+
+	nfds = 0;
+	cmsg = CMSG_FIRSTHDR(msg);
+	if (n >= 0 && cmsg && cmsg->cmsg_level == SOL_SOCKET
+		&& cmsg->cmsg_type == SCM_RIGHTS)
+		nfds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+	if (nfds > 3)
+		nfds = 3;
+	if (nfds)
+		ft_memcpy(req->fds, CMSG_DATA(cmsg), nfds * sizeof(int));
+	if (n != sizeof(t_srv_head) || nfds != 3)
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shell_api.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:57:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Parses a script without running it.
+ * @param ctx Shell the script is meant for.
+ * @param text Script text.
+ * @param status Set to 0, or to non-zero on a syntax error (2 when the
+ * text ends inside a compound command).
+ * @return The command list (NULL when empty or on error), to run with
+ * shell_exec and free with shell_tree_free.
+ */
+t_node	*shell_parse(t_shell_ctx *ctx, const char *text, int *status)
+{
+	t_shell_ctx	*prev;
+	t_node		*tree;
+
+	prev = shell_ctx_use(ctx);
+	tree = script_parse(text, 0, status);
+	shell_ctx_use(prev);
+	return (tree);
+}
+
+/**
+ * @brief Expands words the way the list of a `for` loop is expanded.
+ * @param ctx Shell whose variables and parameters are used.
+ * @param words Unexpanded words.
+ * @return NULL-terminated array of fields (free each, then the array),
+ * NULL on allocation failure.
+ * @note Quotes, parameters, `$(...)`, `$((...))`, field splitting and
+ * pathname patterns all apply; substitutions run in the context.
+ */
+char	**shell_expand(t_shell_ctx *ctx, const char *words)
+{
+	t_shell_ctx	*prev;
+	char		**fields;
+
+	prev = shell_ctx_use(ctx);
+	fields = script_expand_words(words);
+	shell_ctx_use(prev);
+	return (fields);
+}
+
+/**
+ * @brief Runs a parsed command list.
+ * @param ctx Shell to run it in.
+ * @param tree Command list from shell_parse (kept, may run again).
+ * @return Exit status of the last command, also given by shell_status.
+ * @note Nothing runs any more once `exit` has (see shell_exited).
+ */
+int	shell_exec(t_shell_ctx *ctx, t_node *tree)
+{
+	t_shell_ctx	*prev;
+	int			should_exit;
+
+	prev = shell_ctx_use(ctx);
+	should_exit = 0;
+	invalidate_stat_cache();
+	cmd_index_expire();
+	script_exec_top(tree, &should_exit);
+	script_exec_end(&should_exit);
+	shell_ctx_use(prev);
+	return (ctx->status);
+}
+
+/**
+ * @brief Parses and runs a script, like one input line of the shell.
+ * @param ctx Shell to run it in.
+ * @param text Script text.
+ * @return Exit status of the last command (2 on a syntax error).
+ * @note Caches that depend on the filesystem are checked again first, as
+ * before each line the shell reads.
+ */
+int	shell_run(t_shell_ctx *ctx, const char *text)
+{
+	t_shell_ctx	*prev;
+	int			should_exit;
+
+	prev = shell_ctx_use(ctx);
+	should_exit = 0;
+	invalidate_stat_cache();
+	cmd_index_expire();
+	script_run(text, &should_exit);
+	shell_ctx_use(prev);
+	return (ctx->status);
+}
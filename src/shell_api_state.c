@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shell_api_state.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:57:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Frees a command list returned by shell_parse.
+ * @param tree Command list (may be NULL).
+ */
+void	shell_tree_free(t_node *tree)
+{
+	node_free(tree);
+}
+
+/**
+ * @brief Returns the exit status of the last command run in a shell.
+ * @param ctx Shell.
+ * @return Value of `$?`.
+ */
+int	shell_status(t_shell_ctx *ctx)
+{
+	return (ctx->status);
+}
+
+/**
+ * @brief Tells whether `exit` has run in a shell.
+ * @param ctx Shell.
+ * @return 1 once `exit` has run (shell_status gives its status), else 0.
+ */
+int	shell_exited(t_shell_ctx *ctx)
+{
+	return (ctx->ctl.exited);
+}
+
+/**
+ * @brief Reads a variable of a shell.
+ * @param ctx Shell.
+ * @param name Variable name.
+ * @return Its value, valid until the variable changes; NULL if unset.
+ */
+const char	*shell_getenv(t_shell_ctx *ctx, const char *name)
+{
+	t_shell_ctx	*prev;
+	char		*value;
+
+	prev = shell_ctx_use(ctx);
+	value = env_value(name);
+	shell_ctx_use(prev);
+	return (value);
+}
+
+/**
+ * @brief Sets and exports a variable of a shell.
+ * @param ctx Shell.
+ * @param name Variable name.
+ * @param value Value (copied).
+ * @return 0 on success, -1 on allocation failure.
+ */
+int	shell_setenv(t_shell_ctx *ctx, const char *name, const char *value)
+{
+	t_shell_ctx	*prev;
+	int			ret;
+
+	prev = shell_ctx_use(ctx);
+	ret = set_env_value(name, value);
+	shell_ctx_use(prev);
+	return (ret);
+}
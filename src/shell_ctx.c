@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shell_ctx.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 10:57:41 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 13:24:51 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the slot holding the calling thread's context.
+ * @return Pointer to a thread-local pointer, NULL until shell_ctx_use.
+ * @note Being thread-local, threads running distinct contexts never see
+ * each other's state; a forked child keeps the context of its thread.
+ */
+t_shell_ctx	**shell_ctx_slot(void)
+{
+	static __thread t_shell_ctx	*current;
+
+	return (&current);
+}
+
+/**
+ * @brief Returns the context the calling thread works on.
+ * @return The current context (see shell_ctx_use).
+ * @note Every accessor of shell state (get_exec_ctl, get_env, ...) goes
+ * through here.
+ */
+t_shell_ctx	*get_shell_ctx(void)
+{
+	return (*shell_ctx_slot());
+}
+
+/**
+ * @brief Makes a context current on the calling thread.
+ * @param ctx Context to use (NULL for none).
+ * @return The context that was current before.
+ * @note The library entry points switch to their context and back, so
+ * they may be called from within one another.
+ */
+t_shell_ctx	*shell_ctx_use(t_shell_ctx *ctx)
+{
+	t_shell_ctx	*prev;
+
+	prev = *shell_ctx_slot();
+	*shell_ctx_slot() = ctx;
+	return (prev);
+}
+
+/**
+ * @brief Creates an independent shell.
+ * @param envp Initial environment (copied; NULL for an empty one).
+ * @return The new context, NULL on allocation failure.
+ */
+t_shell_ctx	*shell_ctx_new(char **envp)
+{
+	t_shell_ctx	*ctx;
+
+	ctx = ft_calloc(1, sizeof(t_shell_ctx));
+	if (!ctx)
+		return (NULL);
+	if (envp)
+		ctx->env = ft_copy_env(envp);
+	else
+		ctx->env = ft_calloc(1, sizeof(char *));
+	if (!ctx->env)
+		return (free(ctx), NULL);
+	ctx->frame = &ctx->root;
+	ctx->fds[STDIN_FILENO] = STDIN_FILENO;
+	ctx->fds[STDOUT_FILENO] = STDOUT_FILENO;
+	ctx->fds[STDERR_FILENO] = STDERR_FILENO;
+	ctx->history.fd = -1;
+	ctx->ev.epfd = -1;
+	ctx->ev.sigfd = -1;
+	ctx->zygote.fd = -1;
+	return (ctx);
+}
+
+/**
+ * @brief Frees a context and everything it owns.
+ * @param ctx Context (may be NULL), not in use on another thread.
+ * @note Children still running are not waited for.
+ */
+void	shell_ctx_free(t_shell_ctx *ctx)
+{
+	t_shell_ctx	*prev;
+
+	if (!ctx)
+		return ;
+	prev = shell_ctx_use(ctx);
+	func_table_free();
+	hist_free();
+	invalidate_stat_cache();
+	cmd_index_unmap(get_cmd_index());
+	complete_free(get_complete());
+	zygote_stop();
+	if (ctx->ev.epfd != -1)
+		close(ctx->ev.epfd);
+	if (ctx->ev.sigfd != -1)
+		close(ctx->ev.sigfd);
+	ft_free_array(ctx->env);
+	if (prev == ctx)
+		prev = NULL;
+	shell_ctx_use(prev);
+	free(ctx);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shell_input.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 06:14:52 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reads one line without readline.
+ * @param fd Descriptor to read from.
+ * @param prompt Prompt shown when the shell runs on a terminal.
+ * @return The line without its newline (to be freed), or NULL at end of
+ * input with nothing read.
+ * @note Shares the readers of the `read` builtin: a script file is read
+ * in blocks and rewound to the end of the line, a pipe one byte at a
+ * time, so commands started by the script see the rest of it.
+ */
+char	*line_read(int fd, const char *prompt)
+{
+	t_read	rd;
+	int		status;
+
+	if (prompt && get_rl_api()->tty)
+		ft_putstr_fd((char *)prompt, STDOUT_FILENO);
+	rd.raw = 1;
+	rd.delim = '\n';
+	rd.escaped = 0;
+	sb_init(&rd.line);
+	if (read_is_seekable(fd))
+		status = read_line_block(&rd, fd);
+	else
+		status = read_line_bytes(&rd, fd);
+	if (status == -1 || (status == 1 && rd.line.len == 0))
+	{
+		sb_free(&rd.line);
+		return (NULL);
+	}
+	return (sb_detach(&rd.line));
+}
+
+/**
+ * @brief Reads a line of shell input.
+ * @param prompt Prompt to display.
+ * @return The line (to be freed), or NULL at end of input.
+ * @note History navigation starts over from the typed line at each
+ * prompt.
+ */
+char	*shell_readline(const char *prompt)
+{
+	if (!get_rl_api()->handle)
+		return (line_read(STDIN_FILENO, prompt));
+	hist_nav_reset();
+	return (evloop_readline(prompt));
+}
+
+/**
+ * @brief Adds a line to the history and its file.
+ * @param line Line to add.
+ * @note Only interactive shells keep a history (see hist_init).
+ */
+void	shell_add_history(const char *line)
+{
+	if (hist_add(line))
+		hist_log_append(get_history(), line);
+}
+
+/**
+ * @brief Releases the history.
+ */
+void	shell_clear_history(void)
+{
+	hist_free();
+}
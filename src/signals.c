@@ -6,57 +6,58 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 18:28:19 by luinasci          #+#    #+#             */
-/*   Updated: 2025/04/28 19:46:39 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 06:14:52 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "minishell.h"
 
 /**
- * @brief Handles SIGINT (Ctrl+C) in interactive mode.
- * Prints a new prompt and resets input buffer.
- * @param sig Signal number (unused).
+ * @brief Fills the set of signals the shell reads from its event loop.
+ * @param set Set to fill with SIGINT, SIGQUIT and SIGCHLD.
  */
-void	handle_sigint(int sig)
+void	shell_sigset(sigset_t *set)
 {
-	(void)sig;
-	write(STDOUT_FILENO, "\n", 1);
-	rl_replace_line("", 0);
-	rl_on_new_line();
-	rl_redisplay();
+	sigemptyset(set);
+	sigaddset(set, SIGINT);
+	sigaddset(set, SIGQUIT);
+	sigaddset(set, SIGCHLD);
 }
 
 /**
- * @brief Manages shell signal handling configurations.
- * @note Sets SIGINT/SIGQUIT handlers for interactive mode.
+ * @brief Blocks the shell's signals so they queue for the signalfd.
+ * @note Also called when `exec` fails and the shell carries on.
  */
 void	setup_parent_signals(void)
 {
-	struct sigaction	sa;
+	sigset_t	set;
 
-	sa.sa_handler = handle_sigint;
-	sa.sa_flags = SA_RESTART;
-	sigemptyset(&sa.sa_mask);
-	sigaction(SIGINT, &sa, NULL);
-	signal(SIGQUIT, SIG_IGN);
+	shell_sigset(&set);
+	sigprocmask(SIG_BLOCK, &set, NULL);
 }
 
 /**
  * @brief Configures child processes to use default signal handlers.
  * SIGINT and SIGQUIT will terminate children normally.
+ * @note The blocked mask survives fork and exec, so it is lifted here.
  */
 void	setup_child_signals(void)
 {
+	sigset_t	set;
+
 	signal(SIGINT, SIG_DFL);
 	signal(SIGQUIT, SIG_DFL);
+	shell_sigset(&set);
+	sigprocmask(SIG_UNBLOCK, &set, NULL);
 }
 
 /**
  * @brief Configures signal handling for heredoc.
- * @note Sets SIGINT to default and ignores SIGQUIT.
+ * @note Sets SIGINT to default and ignores SIGQUIT. The heredoc reader
+ * leaves the shell's event loop and prompts with plain readline.
  */
 void	setup_heredoc_signals(void)
 {
-	signal(SIGINT, SIG_DFL);
+	evloop_child();
 	signal(SIGQUIT, SIG_IGN);
 }
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   subshell.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:10:36 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the flag set in subshell processes.
+ * @return Pointer to the flag of the current shell context.
+ * @note Used to keep interactive-only messages out of captured output,
+ * and to let `exit` end a forked child at once.
+ */
+int	*in_subshell(void)
+{
+	return (&get_shell_ctx()->subshell);
+}
+
+/**
+ * @brief Runs a command list in the current (forked) process and exits
+ * with its status.
+ * @param body Command text, parsed like an input line.
+ * @note Descriptors of the parent's process substitutions are closed
+ * first so they do not leak into the subshell. The final command is
+ * exec'd in place of the subshell (see script_exec_top).
+ */
+void	run_subshell(const char *body)
+{
+	int	should_exit;
+
+	*in_subshell() = 1;
+	evloop_child();
+	procsub_close_others(NULL);
+	should_exit = 0;
+	get_exec_ctl()->last_line = 1;
+	script_run(body, &should_exit);
+	exit(get_exit_status());
+}
+
+/**
+ * @brief Runs a compound command as a pipeline stage and exits.
+ * @param script Compound command node.
+ * @note Called in the forked stage once its pipes are in place.
+ */
+void	run_script_stage(t_node *script)
+{
+	int	should_exit;
+
+	*in_subshell() = 1;
+	should_exit = 0;
+	exit(ast_exec(script, &should_exit));
+}
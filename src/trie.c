@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trie.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 07:22:06 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 07:22:06 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Allocates a trie node.
+ * @param edge Label of the edge leading to the node (copied).
+ * @param len Length of the label.
+ * @return The node, or NULL on allocation failure.
+ */
+t_trie	*trie_node(const char *edge, size_t len)
+{
+	t_trie	*node;
+
+	node = ft_calloc(1, sizeof(t_trie));
+	if (!node)
+		return (NULL);
+	node->edge = ft_substr(edge, 0, len);
+	if (!node->edge)
+	{
+		free(node);
+		return (NULL);
+	}
+	node->len = len;
+	return (node);
+}
+
+/**
+ * @brief Splits the edge leading to a node after its first k bytes.
+ * @param node Node whose edge is split.
+ * @param k Length kept on the edge (0 < k < node->len).
+ * @return 0 on success, -1 on allocation failure.
+ * @note The tail of the edge moves to a new only child that takes over
+ * the node's children and end-of-name mark.
+ */
+int	trie_split(t_trie *node, size_t k)
+{
+	t_trie	*rest;
+
+	rest = trie_node(node->edge + k, node->len - k);
+	if (!rest)
+		return (-1);
+	rest->term = node->term;
+	rest->child = node->child;
+	node->child = rest;
+	node->term = 0;
+	node->len = k;
+	node->edge[k] = '\0';
+	return (0);
+}
+
+/**
+ * @brief Adds a leaf holding the rest of a name under a node.
+ * @param parent Node the leaf hangs from.
+ * @param name Rest of the name (not empty).
+ * @return 0 on success, -1 on allocation failure.
+ */
+int	trie_add(t_trie *parent, const char *name)
+{
+	t_trie	*leaf;
+	t_trie	**link;
+
+	leaf = trie_node(name, ft_strlen(name));
+	if (!leaf)
+		return (-1);
+	leaf->term = 1;
+	link = &parent->child;
+	while (*link && (unsigned char)(*link)->edge[0] < (unsigned char)*name)
+		link = &(*link)->next;
+	leaf->next = *link;
+	*link = leaf;
+	return (0);
+}
+
+/**
+ * @brief Inserts a name into a trie.
+ * @param node Root of the trie.
+ * @param name Name to insert (empty names are ignored).
+ * @return 0 on success, -1 on allocation failure.
+ * @note Names already present are left as they are, so the same command
+ * found in several PATH directories is stored once.
+ */
+int	trie_insert(t_trie *node, const char *name)
+{
+	t_trie	*c;
+	size_t	k;
+
+	if (!*name)
+		return (0);
+	while (*name)
+	{
+		c = node->child;
+		while (c && c->edge[0] != *name)
+			c = c->next;
+		if (!c)
+			return (trie_add(node, name));
+		k = 0;
+		while (k < c->len && c->edge[k] == name[k])
+			k++;
+		if (k < c->len && trie_split(c, k) == -1)
+			return (-1);
+		name += k;
+		node = c;
+	}
+	node->term = 1;
+	return (0);
+}
+
+/**
+ * @brief Frees a trie.
+ * @param node Root of the trie (may be NULL).
+ */
+void	trie_free(t_trie *node)
+{
+	t_trie	*next;
+
+	while (node)
+	{
+		next = node->next;
+		trie_free(node->child);
+		free(node->edge);
+		free(node);
+		node = next;
+	}
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trie_query.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 07:22:06 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 07:22:06 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Finds the node under which every name starts with a prefix.
+ * @param node Root of the trie.
+ * @param prefix Prefix to look up.
+ * @param path Receives the labels from the root to the node found, which
+ * may run past the end of the prefix.
+ * @return The node, or NULL if no name has this prefix.
+ */
+t_trie	*trie_find(t_trie *node, const char *prefix, t_strbuf *path)
+{
+	t_trie	*c;
+	size_t	k;
+
+	while (*prefix)
+	{
+		c = node->child;
+		while (c && c->edge[0] != *prefix)
+			c = c->next;
+		if (!c)
+			return (NULL);
+		k = 0;
+		while (k < c->len && prefix[k] && c->edge[k] == prefix[k])
+			k++;
+		if (k < c->len && prefix[k])
+			return (NULL);
+		sb_append(path, c->edge, c->len);
+		prefix += k;
+		node = c;
+	}
+	return (node);
+}
+
+/**
+ * @brief Lists every name below a node, in byte order.
+ * @param node Node to start from.
+ * @param path Labels from the root to `node`; restored on return.
+ * @param out Receives the names.
+ */
+void	trie_collect(t_trie *node, t_strbuf *path, t_strvec *out)
+{
+	t_trie	*c;
+	size_t	len;
+
+	if (node->term && path->data)
+		strvec_push(out, ft_strdup(path->data));
+	c = node->child;
+	while (c && !out->failed)
+	{
+		len = path->len;
+		sb_append(path, c->edge, c->len);
+		trie_collect(c, path, out);
+		path->len = len;
+		if (path->data)
+			path->data[len] = '\0';
+		c = c->next;
+	}
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   word_expand.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:21:40 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:46:30 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Expands a raw word without splitting it or matching paths.
+ * @param raw Unexpanded word, quotes included.
+ * @param pattern 1 to build a pattern for glob_compile: quoted and
+ * backslashed characters are then escaped so they match literally.
+ * @return The expanded word with its quotes removed, NULL on allocation
+ * failure.
+ * @note Used for the word and the patterns of `case`, which are never
+ * pathname-expanded, so `case 2 in *)` matches whatever the directory
+ * holds while `"*")` only matches a star.
+ */
+char	*word_expand(const char *raw, int pattern)
+{
+	t_strbuf	sb;
+	size_t		i;
+
+	sb_init(&sb);
+	i = 0;
+	while (raw[i] && !sb.failed)
+	{
+		if (raw[i] == '\'' || raw[i] == '"')
+			i = word_expand_quoted(&sb, raw, i, pattern);
+		else
+			i = word_expand_plain(&sb, raw, i, pattern);
+	}
+	return (sb_detach(&sb));
+}
+
+/**
+ * @brief Expands a quoted section of a word.
+ * @param sb Buffer receiving the result.
+ * @param raw Word.
+ * @param i Index of the opening quote.
+ * @param pattern 1 to escape the pattern characters of the result.
+ * @return Index just past the closing quote.
+ * @note Single quotes keep their text as it is; double quotes expand
+ * parameters and substitutions, as in expand_arg.
+ */
+size_t	word_expand_quoted(t_strbuf *sb, const char *raw, size_t i,
+		int pattern)
+{
+	size_t	end;
+	char	*text;
+	char	*value;
+
+	end = script_quote_end(raw, i);
+	text = ft_substr(raw, i + 1, end - i - 1);
+	value = text;
+	if (text && raw[i] == '"')
+	{
+		value = expand_escaped(text, EXPAND_DQUOTE);
+		free(text);
+	}
+	word_append(sb, value, pattern * 2);
+	free(value);
+	return (end + (raw[end] != '\0'));
+}
+
+/**
+ * @brief Expands an unquoted section of a word, up to the next quote.
+ * @param sb Buffer receiving the result.
+ * @param raw Word.
+ * @param i Index of the section.
+ * @param pattern 1 to escape a backslashed character.
+ * @return Index just past the section.
+ * @note A backslash keeps the next character literal; the rest goes
+ * through expand_arg, `$(...)` and `${...}` groups included whole, and
+ * its pattern characters stay special. Backslashes it produces are
+ * literal, so `[$(echo "\\")]` that matches nothing stays `[\]`.
+ */
+size_t	word_expand_plain(t_strbuf *sb, const char *raw, size_t i,
+		int pattern)
+{
+	t_arg	arg;
+	size_t	end;
+	char	*value;
+
+	if (raw[i] == '\\')
+	{
+		if (pattern && raw[i + 1])
+			sb_putc(sb, '\\');
+		sb_putc(sb, raw[i + (raw[i + 1] != '\0')]);
+		return (i + 1 + (raw[i + 1] != '\0'));
+	}
+	end = i;
+	while (raw[end] && !ft_strchr("'\"\\", raw[end]))
+		end = word_group_skip(raw, end) + 1;
+	arg.type = T_WORD;
+	arg.raw = NULL;
+	arg.value = ft_substr(raw, i, end - i);
+	value = NULL;
+	if (arg.value)
+		value = expand_arg(&arg);
+	free(arg.value);
+	word_append(sb, value, pattern);
+	free(value);
+	return (end);
+}
+
+/**
+ * @brief Skips an expansion group starting at an index.
+ * @param raw Word.
+ * @param i Index to look at.
+ * @return Index of the end of the `$(...)`, `${...}`, `<(...)` or
+ * `>(...)` group starting at `i`, or `i` itself if none does.
+ */
+size_t	word_group_skip(const char *raw, size_t i)
+{
+	size_t	end;
+
+	end = 0;
+	if (ft_strchr("$<>", raw[i])
+		&& (raw[i + 1] == '(' || (raw[i] == '$' && raw[i + 1] == '{')))
+		end = match_group_end(raw, i + 1);
+	if (end)
+		return (end);
+	return (i);
+}
+
+/**
+ * @brief Appends an expanded piece of a word.
+ * @param sb Buffer receiving it.
+ * @param value Piece (NULL after an allocation failure).
+ * @param escape 0 to append the piece as it is, 1 to escape its `\`,
+ * 2 to escape `*`, `?`, `[`, `]` and `\` as well, so that a pattern built
+ * from it matches them literally.
+ */
+void	word_append(t_strbuf *sb, const char *value, int escape)
+{
+	size_t	i;
+
+	if (!value)
+	{
+		sb->failed = 1;
+		return ;
+	}
+	i = 0;
+	while (value[i])
+	{
+		if ((escape == 1 && value[i] == '\\')
+			|| (escape == 2 && ft_strchr("*?[]\\", value[i])))
+			sb_putc(sb, '\\');
+		sb_putc(sb, value[i++]);
+	}
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zygote.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:24:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:53:40 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the shell's zygote state.
+ * @return Zygote of the current shell context.
+ */
+t_zygote	*get_zygote(void)
+{
+	return (&get_shell_ctx()->zygote);
+}
+
+/**
+ * @brief Forks the zygote if MINISHELL_ZYGOTE is set to a non-zero value.
+ * @note Called by the front-end at startup, while the shell is still
+ * small. External commands are then forked from the zygote instead of
+ * the shell (see zygote_launch), so their launch no longer copies the
+ * page tables of a shell whose heap grew with history and variables.
+ * The socket is kept out of the way of `exec 3>file`, like the history
+ * file, and the zygote drops the descriptors the shell inherited.
+ */
+void	zygote_start(void)
+{
+	t_zygote	*z;
+	char		*flag;
+	int			sv[2];
+
+	flag = env_value(ZYG_ENV);
+	if (!flag || !*flag || ft_strcmp(flag, "0") == 0
+		|| socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sv) == -1)
+		return ;
+	z = get_zygote();
+	z->pid = fork();
+	if (z->pid == 0)
+	{
+		close(sv[0]);
+		fd_inherit_close();
+		zygote_main(sv[1]);
+	}
+	close(sv[1]);
+	if (z->pid > 0)
+		z->fd = fcntl(sv[0], F_DUPFD_CLOEXEC, FDPLAN_MIN_FD);
+	close(sv[0]);
+	if (z->pid < 0)
+		z->pid = 0;
+}
+
+/**
+ * @brief Ends the zygote and waits for it.
+ * @note Closing the socket is the signal: the zygote exits on EOF.
+ * Commands it started and nobody waited for are left running.
+ */
+void	zygote_stop(void)
+{
+	t_zygote	*z;
+
+	z = get_zygote();
+	if (z->fd != -1)
+		close(z->fd);
+	z->fd = -1;
+	z->watched = 0;
+	if (z->pid > 0)
+		waitpid(z->pid, NULL, 0);
+	z->pid = 0;
+}
+
+/**
+ * @brief Drops the zygote in a forked child of the shell.
+ * @note Subshells fork their commands themselves: replies on a shared
+ * socket could reach the wrong process, and pids left in the table could
+ * match their own children.
+ */
+void	zygote_forget(void)
+{
+	t_zygote	*z;
+
+	z = get_zygote();
+	if (z->fd != -1)
+		close(z->fd);
+	z->fd = -1;
+	z->watched = 0;
+	z->pid = 0;
+	ft_bzero(z->live, sizeof(z->live));
+	ft_bzero(z->done, sizeof(z->done));
+}
+
+/**
+ * @brief Handles a zygote that went away.
+ * @note Commands it started can no longer be waited for; they are
+ * reported as killed so nothing waits forever, and later commands are
+ * forked by the shell again.
+ */
+void	zygote_lost(void)
+{
+	t_zygote	*z;
+	int			i;
+
+	z = get_zygote();
+	if (z->fd != -1)
+		close(z->fd);
+	z->fd = -1;
+	z->watched = 0;
+	i = 0;
+	while (i < ZYG_MAX_LIVE)
+	{
+		if (z->live[i] && !z->done[i])
+		{
+			z->status[i] = SIGKILL;
+			z->done[i] = 1;
+		}
+		i++;
+	}
+}
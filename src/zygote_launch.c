@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zygote_launch.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:24:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 16:46:10 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Starts a pipeline stage through the zygote when it can.
+ * @param pipes Previous and next pipes of the stage.
+ * @param cmd Stage, with its redirection plan compiled.
+ * @return Pid of the command, or -1 to fork it as usual.
+ * @note The path is resolved here, with the shell's caches; a command
+ * that is not found is left to the usual fork for its error message.
+ */
+pid_t	zygote_launch(int *pipes[2], t_cmd *cmd)
+{
+	t_zygote	*z;
+	t_strbuf	body;
+	int			fds[ZYG_NFDS];
+	char		*path;
+	pid_t		pid;
+
+	z = get_zygote();
+	if (z->fd == -1 || zygote_fds(pipes, cmd, fds) == -1)
+		return (-1);
+	pid = -1;
+	sb_init(&body);
+	path = get_cmd_path(cmd->args[0]);
+	if (path && zygote_body(&body, path, cmd->args) == 0
+		&& zygote_send(z->fd, &body, fds) == 0)
+	{
+		pid = zygote_recv(0);
+		while (pid == 0)
+			pid = zygote_recv(0);
+	}
+	free(path);
+	sb_free(&body);
+	close(fds[ZYG_NFDS - 1]);
+	if (pid > 0)
+		z->live[zygote_find(0)] = pid;
+	return (pid);
+}
+
+/**
+ * @brief Works out the descriptors a stage would end up with.
+ * @param pipes Previous and next pipes of the stage.
+ * @param cmd Stage.
+ * @param fds Receives stdin, stdout, stderr and the working directory.
+ * @return 0 if the zygote can run the stage, -1 otherwise.
+ * @note The stages that qualify are those pipe_spawn could start (see
+ * stage_fd_map), as long as the table of live commands has room. A
+ * stage whose redirection failed is never sent: its plan no longer
+ * holds the descriptors, and the fork path exits 1 without running it.
+ */
+int	zygote_fds(int *pipes[2], t_cmd *cmd, int fds[ZYG_NFDS])
+{
+	if (zygote_find(0) == -1 || (cmd->plan && cmd->plan->failed)
+		|| stage_fd_map(pipes, cmd, fds) == -1)
+		return (-1);
+	fds[ZYG_NFDS - 1] = open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	return (-(fds[ZYG_NFDS - 1] == -1));
+}
+
+/**
+ * @brief Builds a launch request: header, path, arguments, environment.
+ * @param body Empty buffer receiving the request.
+ * @param path Resolved command path.
+ * @param args Arguments.
+ * @return 0 on success, -1 on failure or if too large for one message.
+ */
+int	zygote_body(t_strbuf *body, const char *path, char **args)
+{
+	t_zyg_head	head;
+	char		**env;
+
+	head.argc = 0;
+	head.envc = 0;
+	sb_append(body, (char *)&head, sizeof(head));
+	sb_append(body, path, ft_strlen(path) + 1);
+	while (args[head.argc])
+	{
+		sb_append(body, args[head.argc], ft_strlen(args[head.argc]) + 1);
+		head.argc++;
+	}
+	env = *get_env();
+	while (env[head.envc])
+	{
+		sb_append(body, env[head.envc], ft_strlen(env[head.envc]) + 1);
+		head.envc++;
+	}
+	if (body->failed || body->len > ZYG_MAX_MSG)
+		return (-1);
+	ft_memcpy(body->data, &head, sizeof(head));
+	return (0);
+}
+
+/**
+ * @brief Sends a launch request with its descriptors in one message.
+ * @param sock Socket to the zygote.
+ * @param body Request.
+ * @param fds Descriptors of the command.
+ * @return 0 on success, -1 on failure.
+ */
+int	zygote_send(int sock, t_strbuf *body, int fds[ZYG_NFDS])
+{
+	struct msghdr	msg;
+	struct iovec	iov;
+	uint64_t		cbuf[CMSG_SPACE(sizeof(int) * ZYG_NFDS)
+		/ sizeof(uint64_t)];
+	struct cmsghdr	*cmsg;
+
+	ft_bzero(&msg, sizeof(msg));
+	iov.iov_base = body->data;
+	iov.iov_len = body->len;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int) * ZYG_NFDS);
+	ft_memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * ZYG_NFDS);
+	if (sendmsg(sock, &msg, MSG_NOSIGNAL) != (ssize_t)body->len)
+		return (-1);
+	return (0);
+}
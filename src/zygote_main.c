@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zygote_main.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:24:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 13:24:51 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Main loop of the zygote: launch requests and child exits.
+ * @param fd Socket to the shell.
+ * @note Never returns. The zygote ignores Ctrl+C and Ctrl+\ like the
+ * shell; the commands it starts get default signals back. It exits once
+ * the shell closes its end.
+ */
+void	zygote_main(int fd)
+{
+	struct pollfd	pfd[2];
+	sigset_t		set;
+	char			*buf;
+
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	sigemptyset(&set);
+	sigaddset(&set, SIGCHLD);
+	sigprocmask(SIG_BLOCK, &set, NULL);
+	pfd[0].fd = fd;
+	pfd[0].events = POLLIN;
+	pfd[1].fd = signalfd(-1, &set, SFD_NONBLOCK | SFD_CLOEXEC);
+	pfd[1].events = POLLIN;
+	buf = malloc(ZYG_MAX_MSG);
+	if (pfd[1].fd == -1 || !buf)
+		exit(EXIT_FAILURE);
+	while (poll(pfd, 2, -1) >= 0 || errno == EINTR)
+	{
+		if (pfd[1].revents & POLLIN)
+			zygote_exited(fd, pfd[1].fd);
+		if ((pfd[0].revents & (POLLIN | POLLHUP))
+			&& zygote_request(fd, buf) == -1)
+			exit(EXIT_SUCCESS);
+	}
+	exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Reads and runs one launch request.
+ * @param fd Socket to the shell.
+ * @param buf Buffer of ZYG_MAX_MSG bytes.
+ * @return 0 to go on, -1 once the shell is gone.
+ */
+int	zygote_request(int fd, char *buf)
+{
+	struct msghdr	msg;
+	struct iovec	iov;
+	uint64_t		cbuf[CMSG_SPACE(sizeof(int) * ZYG_NFDS)
+		/ sizeof(uint64_t)];
+	struct cmsghdr	*cmsg;
+	ssize_t			n;
+
+	ft_bzero(&msg, sizeof(msg));
+	iov.iov_base = buf;
+	iov.iov_len = ZYG_MAX_MSG;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+	n = recvmsg(fd, &msg, MSG_CMSG_CLOEXEC);
+	if (n == 0 || (n == -1 && errno != EINTR && errno != EAGAIN))
+		return (-1);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	if (n > 0 && cmsg && cmsg->cmsg_type == SCM_RIGHTS
+		&& cmsg->cmsg_len == CMSG_LEN(sizeof(int) * ZYG_NFDS))
+		zygote_fork(fd, buf, n, (int *)CMSG_DATA(cmsg));
+	else if (n > 0)
+		zygote_fork(fd, buf, n, NULL);
+	return (0);
+}
+
+/**
+ * @brief Reaps the zygote's children and relays their exits.
+ * @param fd Socket to the shell.
+ * @param sigfd signalfd reading SIGCHLD.
+ */
+void	zygote_exited(int fd, int sigfd)
+{
+	struct signalfd_siginfo	info;
+	t_zyg_msg				msg;
+	ssize_t					n;
+
+	n = read(sigfd, &info, sizeof(info));
+	while (n == sizeof(info))
+		n = read(sigfd, &info, sizeof(info));
+	msg.exited = 1;
+	msg.status = 0;
+	msg.pid = waitpid(-1, &msg.status, WNOHANG);
+	while (msg.pid > 0)
+	{
+		send(fd, &msg, sizeof(msg), MSG_NOSIGNAL);
+		msg.pid = waitpid(-1, &msg.status, WNOHANG);
+	}
+}
+
+/**
+ * @brief Forks a command and replies with its pid.
+ * @param fd Socket to the shell.
+ * @param buf Request.
+ * @param n Size of the request.
+ * @param fds Descriptors of the command, NULL if they did not come.
+ * @note The reply goes out before the child can be reaped, so the
+ * shell always learns a pid before its exit.
+ */
+void	zygote_fork(int fd, char *buf, ssize_t n, int *fds)
+{
+	t_zyg_msg	reply;
+	int			i;
+
+	reply.pid = -1;
+	reply.status = 0;
+	reply.exited = 0;
+	if (fds && n > (ssize_t) sizeof(t_zyg_head) && !buf[n - 1])
+		reply.pid = fork();
+	if (reply.pid == 0)
+		zygote_exec(buf, n, fds);
+	send(fd, &reply, sizeof(reply), MSG_NOSIGNAL);
+	i = 0;
+	while (fds && i < ZYG_NFDS)
+		close(fds[i++]);
+}
+
+/**
+ * @brief Sets up and execs a command in a child of the zygote.
+ * @param buf Request (see t_zyg_head).
+ * @param n Size of the request.
+ * @param fds stdin, stdout, stderr and the working directory.
+ * @note Failures are reported like the shell's own children would.
+ * Nothing else is inherited: the shell only uses the zygote when its
+ * command would get no descriptor past stderr (see zygote_fds).
+ */
+void	zygote_exec(char *buf, ssize_t n, int *fds)
+{
+	t_zyg_head	head;
+	char		**argv;
+	char		*p;
+	uint32_t	i;
+
+	ft_memcpy(&head, buf, sizeof(head));
+	argv = ft_calloc((size_t)head.argc + head.envc + 2, sizeof(char *));
+	p = buf + sizeof(head) + ft_strlen(buf + sizeof(head)) + 1;
+	i = 0;
+	while (argv && i < head.argc + head.envc + 1 && p < buf + n)
+	{
+		argv[i++] = p;
+		if (i == head.argc)
+			argv[i++] = NULL;
+		p += ft_strlen(p) + 1;
+	}
+	if (!argv || i != head.argc + head.envc + 1 || fchdir(fds[3]) == -1
+		|| dup2(fds[0], 0) == -1 || dup2(fds[1], 1) == -1
+		|| dup2(fds[2], 2) == -1)
+		exit(EXIT_FAILURE);
+	close_range(STDERR_FILENO + 1, ~0U, 0);
+	setup_child_signals();
+	execve(buf + sizeof(head), argv, argv + head.argc + 1);
+	perror("minishell");
+	exit(EXIT_FAILURE);
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   zygote_reap.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 13:24:51 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 15:02:18 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Reads one message from the zygote.
+ * @param flags 0 to block, MSG_DONTWAIT to poll.
+ * @return Pid of the command just launched (-1 if the zygote could not
+ * start it), 0 after recording an exit or an interrupted read, -2 if
+ * there was nothing to read or the zygote is gone.
+ */
+pid_t	zygote_recv(int flags)
+{
+	t_zygote	*z;
+	t_zyg_msg	msg;
+	ssize_t		n;
+	int			i;
+
+	z = get_zygote();
+	n = recv(z->fd, &msg, sizeof(msg), flags);
+	if (n == -1 && errno == EINTR)
+		return (0);
+	if (n == -1 && errno == EAGAIN)
+		return (-2);
+	if (n != sizeof(msg))
+	{
+		zygote_lost();
+		return (-2);
+	}
+	if (!msg.exited)
+		return (msg.pid);
+	i = zygote_find(msg.pid);
+	if (i != -1 && msg.pid)
+	{
+		z->status[i] = msg.status;
+		z->done[i] = 1;
+	}
+	return (0);
+}
+
+/**
+ * @brief Finds a command started by the zygote.
+ * @param pid Pid of the command, 0 to find a free entry.
+ * @return Index in the table, or -1.
+ */
+int	zygote_find(pid_t pid)
+{
+	t_zygote	*z;
+	int			i;
+
+	z = get_zygote();
+	i = 0;
+	while (i < ZYG_MAX_LIVE && z->live[i] != pid)
+		i++;
+	if (i == ZYG_MAX_LIVE)
+		return (-1);
+	return (i);
+}
+
+/**
+ * @brief Takes the wait status of a command once the zygote relayed it.
+ * @param pid Command started by the zygote.
+ * @param status Receives the wait status.
+ * @return 1 if the command was reaped, 0 if it is still running.
+ */
+int	zygote_claim(pid_t pid, int *status)
+{
+	t_zygote	*z;
+	int			i;
+
+	z = get_zygote();
+	i = zygote_find(pid);
+	if (i == -1 || !z->done[i])
+		return (0);
+	*status = z->status[i];
+	z->live[i] = 0;
+	z->done[i] = 0;
+	return (1);
+}
+
+/**
+ * @brief Collects the relayed exits of a set of children.
+ * @param epfd epoll instance of the wait (-1 if none).
+ * @param r Children being waited for, those started by the zygote marked
+ * ZYG_PENDING (NULL once the wait is over).
+ * @return Number of children reaped.
+ * @note The socket is in the epoll set only while such a child is
+ * pending (see evloop_watch_zygote), so it never wakes the prompt.
+ */
+int	zygote_reap(int epfd, t_reap *r)
+{
+	int	reaped;
+	int	pending;
+	int	i;
+
+	while (get_zygote()->fd != -1 && zygote_recv(MSG_DONTWAIT) == 0)
+		continue ;
+	reaped = 0;
+	pending = 0;
+	i = -1;
+	while (r && ++i < r->n)
+	{
+		if (r->fds[i] == ZYG_PENDING
+			&& zygote_claim(r->pids[i], &r->status[i]))
+		{
+			r->fds[i] = EV_REAPED;
+			reaped++;
+		}
+		pending += (r->fds[i] == ZYG_PENDING);
+	}
+	evloop_watch_zygote(epfd, pending);
+	return (reaped);
+}
+
+/**
+ * @brief Waits for one command started by the zygote.
+ * @param pid Command.
+ * @return Its wait status.
+ * @note Used when the event loop could not wait (see evloop_reap_rest).
+ */
+int	zygote_wait(pid_t pid)
+{
+	int	status;
+
+	status = 0;
+	while (zygote_find(pid) != -1 && !zygote_claim(pid, &status))
+		zygote_recv(0);
+	return (status);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_reap.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:02:18 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 15:02:18 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <pthread.h>
+#include <stdio.h>
+#include "libminishell.h"
+
+/**
+ * @brief Runs a short external command many times in a shell of its own.
+ * @param arg Receives the number of runs that did not exit with 0.
+ * @return NULL.
+ */
+void	*reap_thread(void *arg)
+{
+	t_shell_ctx	*ctx;
+	int			*failed;
+	int			i;
+
+	failed = arg;
+	*failed = 100;
+	ctx = shell_ctx_new(NULL);
+	if (!ctx)
+		return (NULL);
+	*failed = 0;
+	i = -1;
+	while (++i < 100)
+		*failed += (shell_run(ctx, "/bin/true") != 0);
+	shell_ctx_free(ctx);
+	return (NULL);
+}
+
+/**
+ * @brief Checks that shells on several threads reap their children.
+ * @return 0 if every run exited with 0, 1 otherwise.
+ * @note Children forked by one thread inherit the pidfds of the others
+ * until they exec, so each wait sees exits that are not its own. A shell
+ * that took them for its own used to hang, or close a wait status as if
+ * it were a descriptor.
+ */
+int	main(void)
+{
+	pthread_t	threads[4];
+	int			failed[4];
+	int			total;
+	int			i;
+
+	i = -1;
+	while (++i < 4)
+	{
+		failed[i] = 100;
+		if (pthread_create(&threads[i], NULL, reap_thread, &failed[i]) != 0)
+			threads[i] = 0;
+	}
+	total = 0;
+	while (i-- > 0)
+	{
+		if (threads[i])
+			pthread_join(threads[i], NULL);
+		total += failed[i];
+	}
+	printf("thread_reap: %d of 400 runs failed\n", total);
+	return (total != 0);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strbuf.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:03:17 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/19 10:03:17 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Initializes an empty growable buffer.
+ * @param sb Buffer to initialize.
+ */
+void	sb_init(t_strbuf *sb)
+{
+	sb->data = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+	sb->failed = 0;
+}
+
+/**
+ * @brief Makes room for at least `extra` more bytes plus a terminator.
+ * @param sb Buffer to grow.
+ * @param extra Number of bytes about to be appended.
+ * @return 0 on success, -1 on allocation failure.
+ * @note Capacity doubles, so appending n bytes costs O(n) amortized.
+ */
+int	sb_reserve(t_strbuf *sb, size_t extra)
+{
+	size_t	new_cap;
+	char	*new_data;
+
+	if (sb->failed)
+		return (-1);
+	if (sb->len + extra + 1 <= sb->cap)
+		return (0);
+	new_cap = sb->cap;
+	if (new_cap < SB_MIN_CAP)
+		new_cap = SB_MIN_CAP;
+	while (new_cap < sb->len + extra + 1)
+		new_cap *= 2;
+	new_data = malloc(new_cap);
+	if (!new_data)
+	{
+		sb->failed = 1;
+		return (-1);
+	}
+	if (sb->data)
+		ft_memcpy(new_data, sb->data, sb->len);
+	free(sb->data);
+	sb->data = new_data;
+	sb->cap = new_cap;
+	return (0);
+}
+
+/**
+ * @brief Appends raw bytes to the buffer.
+ * @param sb Destination buffer.
+ * @param s Bytes to append.
+ * @param n Number of bytes.
+ */
+void	sb_append(t_strbuf *sb, const char *s, size_t n)
+{
+	if (n == 0 || sb_reserve(sb, n) == -1)
+		return ;
+	ft_memcpy(sb->data + sb->len, s, n);
+	sb->len += n;
+	sb->data[sb->len] = '\0';
+}
+
+/**
+ * @brief Appends a single character to the buffer.
+ * @param sb Destination buffer.
+ * @param c Character to append.
+ */
+void	sb_putc(t_strbuf *sb, char c)
+{
+	if (sb_reserve(sb, 1) == -1)
+		return ;
+	sb->data[sb->len++] = c;
+	sb->data[sb->len] = '\0';
+}
+
+/**
+ * @brief Appends `n` copies of a character.
+ * @param sb Destination buffer.
+ * @param c Padding character.
+ * @param n Number of copies (nothing happens if n <= 0).
+ */
+void	sb_pad(t_strbuf *sb, char c, int n)
+{
+	if (n <= 0 || sb_reserve(sb, n) == -1)
+		return ;
+	ft_memset(sb->data + sb->len, c, n);
+	sb->len += n;
+	sb->data[sb->len] = '\0';
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strbuf_io.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:03:17 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 09:48:27 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Writes the whole buffer to a file descriptor and empties it.
+ * @param sb Buffer to flush.
+ * @param fd Destination file descriptor.
+ * @return 0 on success, -1 on write or allocation error.
+ * @note Normally a single write(); loops only on short writes or EINTR.
+ */
+int	sb_flush(t_strbuf *sb, int fd)
+{
+	size_t	done;
+	ssize_t	ret;
+
+	if (sb->failed)
+		return (-1);
+	done = 0;
+	while (done < sb->len)
+	{
+		ret = write(fd, sb->data + done, sb->len - done);
+		if (ret == -1 && errno == EINTR)
+			continue ;
+		if (ret <= 0)
+			return (-1);
+		done += ret;
+	}
+	sb->len = 0;
+	return (0);
+}
+
+/**
+ * @brief Releases the memory owned by a buffer.
+ * @param sb Buffer to free.
+ */
+void	sb_free(t_strbuf *sb)
+{
+	free(sb->data);
+	sb_init(sb);
+}
+
+/**
+ * @brief Transfers ownership of the buffer contents to the caller.
+ * @param sb Buffer to detach (left empty).
+ * @return NUL-terminated string (never NULL unless allocation failed).
+ */
+char	*sb_detach(t_strbuf *sb)
+{
+	char	*result;
+
+	if (sb->failed)
+	{
+		sb_free(sb);
+		return (NULL);
+	}
+	if (!sb->data)
+		return (ft_strdup(""));
+	result = sb->data;
+	sb_init(sb);
+	return (result);
+}
+
+/**
+ * @brief Appends everything readable from a file descriptor.
+ * @param sb Destination buffer.
+ * @param fd Source file descriptor, read until end of file.
+ * @return 0 on success, -1 on read or allocation error.
+ * @note Regular files (and memfds) are sized with fstat so the buffer
+ * is allocated once; reads are SB_READ_CHUNK bytes at a time.
+ */
+int	sb_read_fd(t_strbuf *sb, int fd)
+{
+	struct stat	st;
+	ssize_t		ret;
+
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+		sb_reserve(sb, st.st_size);
+	while (sb_reserve(sb, SB_READ_CHUNK) == 0)
+	{
+		ret = read(fd, sb->data + sb->len, SB_READ_CHUNK);
+		if (ret == -1 && errno == EINTR)
+			continue ;
+		if (ret <= 0)
+			return (-(ret < 0));
+		sb->len += ret;
+		sb->data[sb->len] = '\0';
+	}
+	return (-1);
+}
+
+/**
+ * @brief Replaces a file with the contents of a buffer, atomically.
+ * @param sb File contents.
+ * @param file File to replace.
+ * @param mode Permissions of the new file.
+ * @return 0 on success, -1 on failure.
+ * @note The data goes to "<file>.<pid>" first and is renamed over `file`,
+ * so a concurrent reader sees either the old or the new file, never a
+ * partial one.
+ */
+int	sb_replace_file(t_strbuf *sb, const char *file, mode_t mode)
+{
+	char	*tmp;
+	char	*pid;
+	int		fd;
+	ssize_t	n;
+
+	pid = ft_itoa(getpid());
+	tmp = NULL;
+	if (pid && !sb->failed)
+		tmp = ft_strjoin3(file, ".", pid);
+	free(pid);
+	if (!tmp)
+		return (-1);
+	fd = open(tmp, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, mode);
+	n = -1;
+	if (fd != -1)
+		n = write(fd, sb->data, sb->len);
+	if (fd != -1)
+		close(fd);
+	if (n != (ssize_t)sb->len || rename(tmp, file) == -1)
+	{
+		unlink(tmp);
+		n = -1;
+	}
+	free(tmp);
+	return (-(n == -1));
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strsort.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 00:14:33 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 00:14:33 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Merges two sorted runs of strings.
+ * @param src Array holding both runs.
+ * @param dst Receives the merged run at the same offsets.
+ * @param b Bounds: start of the first run, start of the second run and
+ * end of the second run.
+ */
+void	str_merge(char **src, char **dst, const size_t b[3])
+{
+	size_t	i;
+	size_t	j;
+	size_t	k;
+
+	i = b[0];
+	j = b[1];
+	k = b[0];
+	while (i < b[1] && j < b[2])
+	{
+		if (ft_strcmp(src[j], src[i]) < 0)
+			dst[k++] = src[j++];
+		else
+			dst[k++] = src[i++];
+	}
+	while (i < b[1])
+		dst[k++] = src[i++];
+	while (j < b[2])
+		dst[k++] = src[j++];
+}
+
+/**
+ * @brief Performs one bottom-up merge pass.
+ * @param src Array of sorted runs of `width` strings.
+ * @param dst Receives runs of `2 * width` strings.
+ * @param n Number of strings.
+ * @param width Current run length.
+ */
+void	str_merge_pass(char **src, char **dst, size_t n, size_t width)
+{
+	size_t	b[3];
+
+	b[0] = 0;
+	while (b[0] < n)
+	{
+		b[1] = b[0] + width;
+		if (b[1] > n)
+			b[1] = n;
+		b[2] = b[1] + width;
+		if (b[2] > n)
+			b[2] = n;
+		str_merge(src, dst, b);
+		b[0] = b[2];
+	}
+}
+
+/**
+ * @brief Sorts strings in byte order.
+ * @param v Strings to sort.
+ * @param n Number of strings.
+ * @note A stable bottom-up merge sort comparing bytes, so the order does
+ * not depend on the locale. Passes alternate between `v` and a scratch
+ * array; the result is copied back once at the end if needed. Left
+ * unsorted if the scratch array cannot be allocated.
+ */
+void	str_sort(char **v, size_t n)
+{
+	char	**buf[2];
+	size_t	width;
+	int		cur;
+
+	if (n < 2)
+		return ;
+	buf[0] = v;
+	buf[1] = malloc(sizeof(char *) * n);
+	if (!buf[1])
+		return ;
+	cur = 0;
+	width = 1;
+	while (width < n)
+	{
+		str_merge_pass(buf[cur], buf[!cur], n, width);
+		cur = !cur;
+		width *= 2;
+	}
+	if (cur)
+		ft_memcpy(v, buf[1], sizeof(char *) * n);
+	free(buf[1]);
+}
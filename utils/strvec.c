@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strvec.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 00:14:33 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 00:14:33 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Makes room for one more string and the NULL terminator.
+ * @param v Vector to grow.
+ * @return 0 on success, -1 on allocation failure (sets `failed`).
+ * @note Capacity doubles, so pushing N strings costs O(N) overall.
+ */
+int	strvec_grow(t_strvec *v)
+{
+	char	**grown;
+	size_t	cap;
+
+	if (v->len + 1 < v->cap)
+		return (0);
+	cap = v->cap * 2;
+	if (cap < STRVEC_MIN_CAP)
+		cap = STRVEC_MIN_CAP;
+	grown = malloc(sizeof(char *) * cap);
+	if (!grown)
+	{
+		v->failed = 1;
+		return (-1);
+	}
+	if (v->len)
+		ft_memcpy(grown, v->items, sizeof(char *) * v->len);
+	free(v->items);
+	v->items = grown;
+	v->cap = cap;
+	return (0);
+}
+
+/**
+ * @brief Appends a string to a vector, taking ownership of it.
+ * @param v Vector to append to.
+ * @param s String to append (freed on failure; NULL marks a failure).
+ * @return 0 on success, -1 on failure.
+ */
+int	strvec_push(t_strvec *v, char *s)
+{
+	if (!s || v->failed || strvec_grow(v) == -1)
+	{
+		free(s);
+		v->failed = 1;
+		return (-1);
+	}
+	v->items[v->len++] = s;
+	v->items[v->len] = NULL;
+	return (0);
+}
+
+/**
+ * @brief Frees a vector and its strings.
+ * @param v Vector to clear.
+ */
+void	strvec_free(t_strvec *v)
+{
+	while (v->len)
+		free(v->items[--v->len]);
+	free(v->items);
+	v->items = NULL;
+	v->cap = 0;
+}
+
+/**
+ * @brief Turns a vector into a NULL-terminated array.
+ * @param v Vector (emptied; its storage becomes the array).
+ * @return The array, NULL if an append failed.
+ */
+char	**strvec_finish(t_strvec *v)
+{
+	char	**items;
+
+	if (v->failed)
+	{
+		strvec_free(v);
+		return (NULL);
+	}
+	items = v->items;
+	if (!items)
+		items = ft_calloc(1, sizeof(char *));
+	ft_bzero(v, sizeof(*v));
+	return (items);
+}
+
+/**
+ * @brief Appends the strings of a vector to a NULL-terminated array.
+ * @param words Array (freed, with its strings, on failure).
+ * @param v Vector whose strings move to the array (emptied).
+ * @return The new array, NULL on allocation failure.
+ * @note One allocation for the whole batch, however many strings.
+ */
+char	**strvec_concat(char **words, t_strvec *v)
+{
+	char	**joined;
+	size_t	n;
+
+	n = 0;
+	while (words && words[n])
+		n++;
+	joined = NULL;
+	if (words && !v->failed)
+		joined = malloc(sizeof(char *) * (n + v->len + 1));
+	if (!joined)
+	{
+		ft_free_array(words);
+		strvec_free(v);
+		return (NULL);
+	}
+	ft_memcpy(joined, words, sizeof(char *) * n);
+	if (v->len)
+		ft_memcpy(joined + n, v->items, sizeof(char *) * v->len);
+	joined[n + v->len] = NULL;
+	free(words);
+	free(v->items);
+	ft_bzero(v, sizeof(*v));
+	return (joined);
+}
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/16 14:40:41 by jcologne          #+#    #+#             */
-/*   Updated: 2025/05/02 17:16:09 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -101,26 +101,34 @@ int	is_valid_var_name(const char *name)
 
 /**
  * @brief Prints environment in export format.
- * @note Shows variables with declare -x syntax.
+ * @note Shows variables with declare -x syntax, written at once to the
+ * builtin's stdout.
  */
 void	print_export_declarations(void)
 {
-	extern char	**environ;
+	char		**env;
+	t_strbuf	sb;
 	int			i;
 	char		*eq;
 
-	i = 0;
-	while (environ[i])
+	env = *get_env();
+	sb_init(&sb);
+	i = -1;
+	while (env[++i])
 	{
-		eq = ft_strchr(environ[i], '=');
-		if (eq)
+		sb_append(&sb, "declare -x ", 11);
+		eq = ft_strchr(env[i], '=');
+		if (!eq)
+			eq = env[i] + ft_strlen(env[i]);
+		sb_append(&sb, env[i], eq - env[i]);
+		if (*eq)
 		{
-			*eq = '\0';
-			printf("declare -x %s=\"%s\"\n", environ[i], eq + 1);
-			*eq = '=';
+			sb_append(&sb, "=\"", 2);
+			sb_append(&sb, eq + 1, ft_strlen(eq + 1));
+			sb_putc(&sb, '"');
 		}
-		else
-			printf("declare -x %s\n", environ[i]);
-		i++;
+		sb_putc(&sb, '\n');
 	}
+	sb_flush(&sb, builtin_fd(STDOUT_FILENO));
+	sb_free(&sb);
 }
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/16 15:01:57 by jcologne          #+#    #+#             */
-/*   Updated: 2025/04/28 19:49:07 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 15:57:03 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -88,6 +88,7 @@ void	free_arg(void *arg)
 
 	a = (t_arg *)arg;
 	free(a->value);
+	free(a->raw);
 	free(a);
 }
 
@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/07 16:30:01 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/07 19:47:53 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 01:26:47 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -50,12 +50,13 @@ char	*process_escapes(char *str)
  * @brief Checks if token is redirection operator.
  * @param type Token type to check.
  * @return 1 if redirection token, 0 otherwise.
- * @note Covers all redirection types (>, >>, <, <<).
+ * @note Covers all redirection types (>, >>, <, <<, <<<, >&, <&).
  */
 int	is_redirection(t_token type)
 {
 	return (type == T_REDIR_IN || type == T_REDIR_OUT || type == T_APPEND
-		|| type == T_HEREDOC);
+		|| type == T_HEREDOC || type == T_HERESTRING || type == T_DUP_OUT
+		|| type == T_DUP_IN);
 }
 
 /**
@@ -73,14 +74,16 @@ void	skip_whitespace(t_parse *p)
  * @brief Skips escaped characters in the string.
  * @param str Pointer to the current position in the string.
  * @param delim Delimiter character.
+ * @param in_single Non-zero inside single quotes.
  * @return Updated pointer to the string after skipping.
- * @note Handles escaped delimiters and backslashes.
+ * @note Handles escaped delimiters and backslashes, and jumps to the end
+ * of a `$(...)` group.
  */
-const char	*skip_escaped(const char *str, char delim)
+const char	*skip_escaped(const char *str, char delim, int in_single)
 {
 	if (*str == '\\' && (str[1] == delim || str[1] == '\\'))
 		return (str + 2);
-	return (str);
+	return (skip_subst_group(str, in_single));
 }
 
 /**
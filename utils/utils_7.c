@@ -6,7 +6,7 @@
 /*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/07 16:47:09 by luinasci          #+#    #+#             */
-/*   Updated: 2025/05/13 15:24:41 by luinasci         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:57:41 by luinasci         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,7 +17,7 @@
  * @param str Input string to split.
  * @param delim Delimiter character.
  * @return Array of split tokens.
- * @note Preserves quoted content including delimiters.
+ * @note Preserves quoted content and `$(...)` groups including delimiters.
  */
 char	**split_with_quotes(const char *str, char delim)
 {
@@ -34,7 +34,7 @@ char	**split_with_quotes(const char *str, char delim)
 	quote_char = '\0';
 	while (*str)
 	{
-		str = skip_escaped(str, delim);
+		str = skip_escaped(str, delim, in_quote && quote_char == '\'');
 		if (!*str)
 			break ;
 		process_quote_state(str, &in_quote, &quote_char);
@@ -60,34 +60,33 @@ void	handle_error(char *message)
 }
 
 /**
- * @brief Reads user input and splits it into commands.
- * @param env_copy Copy of the environment variables.
+ * @brief Reads the next command text from the user.
  * @param should_exit Pointer to the exit flag.
- * @return Array of command strings or NULL if the shell should exit.
+ * @return The command text, or NULL for an empty line or at exit.
+ * @note Lines are added until compound commands such as `while ...; do`
+ * are complete, and the whole text goes into the history.
  */
-char	**read_and_split_input(char **env_copy, int *should_exit)
+char	*read_command_text(int *should_exit)
 {
 	char	*input;
-	char	**commands;
 
-	input = readline("minishell> ");
+	input = shell_readline("minishell> ");
 	if (!input)
 	{
 		ft_putstr_fd("Exiting minishell, goodbye!\n", STDOUT_FILENO);
-		free_env_copy(env_copy);
 		*should_exit = 1;
 		return (NULL);
 	}
-	if (ft_strlen(input) > 0)
-		add_history(input);
-	else
+	if (ft_strlen(input) == 0)
 	{
 		free(input);
 		return (NULL);
 	}
-	commands = split_with_quotes(input, ';');
-	free(input);
-	return (commands);
+	input = script_read_more(input);
+	if (input)
+		shell_add_history(input);
+	cmd_index_expire();
+	return (input);
 }
 
 /**
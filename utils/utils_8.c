@@ -0,0 +1,31 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   utils_8.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: luinasci <luinasci@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:03:17 by luinasci          #+#    #+#             */
+/*   Updated: 2026/10/20 17:46:30 by luinasci         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a numbered redirection starts at the current
+ * position.
+ * @param p Parser state.
+ * @return 1 before digits directly followed by `<` or `>` (`2>`, `3<&`).
+ * @note `2 >f` redirects stdout with a "2" argument, as in other shells.
+ */
+int	at_fd_redirection(t_parse *p)
+{
+	size_t	i;
+
+	i = p->pos;
+	while (ft_isdigit(p->input[i]))
+		i++;
+	return (i > (size_t)p->pos && (p->input[i] == '<' || p->input[i] == '>')
+		&& p->input[i + 1] != '(');
+}